@@ -20,6 +20,8 @@ namespace AudioHelm
 
         const double waitToSync = 1.0;
         const double SECONDS_PER_MIN = 60.0;
+        // The native transport counts as running if it moved within this many seconds.
+        const double transportTimeout = 0.5;
 
         /// <summary>
         /// A reset event that is triggered when time restarts.
@@ -100,7 +102,6 @@ namespace AudioHelm
 
         void SetGlobalPause()
         {
-            Native.SetBeatTime(globalBeatTime);
             Native.Pause(pause_);
             lastSampledTime = AudioSettings.dspTime;
             globalPause = pause_;
@@ -116,6 +117,24 @@ namespace AudioHelm
             double deltaTime = timeToStart - lastSampledTime;
             globalBeatTime = -deltaTime * globalBpm / SECONDS_PER_MIN;
             Native.SetBeatTime(globalBeatTime);
+            Native.HelmTransportSeek(timeToStart, 0.0);
+        }
+
+        /// <summary>
+        /// Moves the tempo linearly to a new bpm over rampSeconds, starting at the
+        /// scheduled dsp audio (AudioSettings.dspTime) time.
+        /// </summary>
+        /// <param name="newBpm">The bpm at the end of the ramp.</param>
+        /// <param name="rampSeconds">The length of the ramp in seconds.</param>
+        /// <param name="timeToStart">The audio thread time to start the ramp.</param>
+        public void RampBpm(float newBpm, double rampSeconds, double timeToStart = 0.0)
+        {
+            if (newBpm <= 0.0f)
+                return;
+
+            bpm_ = newBpm;
+            globalBpm = newBpm;
+            Native.HelmTransportSetTempo(timeToStart, newBpm, rampSeconds);
         }
 
         /// <summary>
@@ -131,11 +150,27 @@ namespace AudioHelm
                 OnReset();
         }
 
+        /// <summary>
+        /// Reads the native transport that the synthesizers and native sequencers play from.
+        /// Returns false if no native Helm instance has moved it recently, in which case
+        /// the clock keeps time on the main thread instead.
+        /// </summary>
+        /// <param name="position">The transport position at the end of the last audio block.</param>
+        public static bool GetTransportPosition(out HelmTransportPosition position)
+        {
+            position = new HelmTransportPosition();
+            Native.HelmGetTransportPosition(ref position);
+            return AudioSettings.dspTime - position.time < transportTimeout;
+        }
+
         /// <summary>
         /// Gets the global beats per minute.
         /// </summary>
         public static float GetGlobalBpm()
         {
+            HelmTransportPosition position;
+            if (GetTransportPosition(out position))
+                return (float)position.bpm;
             return globalBpm;
         }
 
@@ -144,6 +179,9 @@ namespace AudioHelm
         /// </summary>
         public static double GetGlobalBeatTime()
         {
+            HelmTransportPosition position;
+            if (GetTransportPosition(out position))
+                return position.beat;
             return globalBeatTime;
         }
 
@@ -160,6 +198,9 @@ namespace AudioHelm
         /// </summary>
         public static double GetLastSampledTime()
         {
+            HelmTransportPosition position;
+            if (GetTransportPosition(out position))
+                return position.time;
             return lastSampledTime;
         }
 
@@ -173,7 +214,6 @@ namespace AudioHelm
             lastSampledTime = time;
 
             globalBeatTime += deltaTime * globalBpm / SECONDS_PER_MIN;
-            Native.SetBeatTime(globalBeatTime);
         }
     }
 }
@@ -39,6 +39,10 @@ namespace AudioHelm
             if (sequencer)
                 return sequencer.channel;
 
+            NativeSampler sampler = GetComponent<NativeSampler>();
+            if (sampler)
+                return sampler.channel;
+
             return 0;
         }
 
@@ -65,39 +65,28 @@ namespace AudioHelm
         public void LoadPatch(HelmPatch patch)
         {
             FieldInfo[] fields = typeof(HelmPatchSettings).GetFields();
-            Native.HelmClearModulations(channel);
 
             List<float> values = new List<float>();
             values.Add(0.0f);
-            int index = 1;
             foreach (FieldInfo field in fields)
             {
                 if (!field.FieldType.IsArray && !field.IsLiteral)
-                {
-                    float val = (float)field.GetValue(patch.patchData.settings);
-                    Native.HelmSetParameterValue(channel, index, val);
-                    values.Add(val);
-                    index++;
-                }
+                    values.Add((float)field.GetValue(patch.patchData.settings));
             }
 
             for (int i = 0; i < synthParameters.Count; ++i)
                 SetParameterAtIndex(i, values[(int)synthParameters[i].parameter]);
 
-            int modulationIndex = 0;
-            foreach (HelmModulationSetting modulation in patch.patchData.settings.modulations)
+            HelmModulationSetting[] modulations = patch.patchData.settings.modulations;
+            if (modulations != null && modulations.Length > HelmPatchSettings.kMaxModulations)
             {
-                if (modulationIndex >= HelmPatchSettings.kMaxModulations)
-                {
-                    Debug.LogWarning("Only " + HelmPatchSettings.kMaxModulations +
-                                     " modulations are currently supported in the Helm Unity plugin.");
-                    break;
-                }
-
-                Native.HelmAddModulation(channel, modulationIndex,
-                                         modulation.source, modulation.destination, modulation.amount);
-                modulationIndex++;
+                Debug.LogWarning("Only " + HelmPatchSettings.kMaxModulations +
+                                 " modulations are currently supported in the Helm Unity plugin.");
             }
+
+            // The native side applies the whole patch between two audio blocks.
+            if (!Native.HelmLoadPatch(channel, JsonUtility.ToJson(patch.patchData)))
+                Debug.LogError("Couldn't load patch " + patch.name + " into the Helm synthesizer.");
         }
 
         /// <summary>
@@ -399,6 +388,29 @@ namespace AudioHelm
             Native.HelmNoteOn(channel, note, velocity);
         }
 
+        /// <summary>
+        /// Triggers a note on event for the Helm instance(s) this points to at the given time
+        /// and turns it off at the given time. Timing is sample accurate.
+        /// </summary>
+        /// <param name="note">The MIDI keyboard note to play. [0, 127]</param>
+        /// <param name="velocity">How hard you hit the key. [0.0, 1.0]</param>
+        /// <param name="timeToStart">DSP time to start the note.</param>
+        /// <param name="timeToEnd">DSP time to end the note.</param>
+        public void NoteOnScheduled(int note, float velocity, double timeToStart, double timeToEnd)
+        {
+            Native.HelmNoteOnScheduled(channel, note, velocity, timeToStart, timeToEnd);
+        }
+
+        /// <summary>
+        /// Triggers a note off event for the Helm instance(s) this points to at the given time.
+        /// </summary>
+        /// <param name="note">The MIDI keyboard note to turn off. [0, 127]</param>
+        /// <param name="timeToEnd">DSP time to end the note.</param>
+        public void NoteOffScheduled(int note, double timeToEnd)
+        {
+            Native.HelmNoteOffScheduled(channel, note, timeToEnd);
+        }
+
         IEnumerator WaitNoteOff(int note, float length)
         {
             yield return new WaitForSeconds(length);
@@ -23,7 +23,11 @@ namespace AudioHelm
                  " This must match the channel set in the Helm Audio plugin.")]
         public int channel = 0;
 
+        // Sixteenths of notes kept ahead of the play position while streaming a MIDI file.
+        const double kMidiStreamLookahead = 32.0;
+
         IntPtr reference = IntPtr.Zero;
+        IntPtr midiStream = IntPtr.Zero;
         int currentChannel = -1;
         int currentLength = -1;
         bool currentLoop = true;
@@ -36,6 +40,7 @@ namespace AudioHelm
 
         void DeleteNativeSequencer()
         {
+            StopMidiStream();
             if (reference != IntPtr.Zero)
                 Native.DeleteSequencer(reference);
             reference = IntPtr.Zero;
@@ -124,6 +129,63 @@ namespace AudioHelm
             Native.HelmNoteOff(channel, note);
         }
 
+        /// <summary>
+        /// Loads a standard MIDI file straight into the native sequencer without creating Note objects.
+        /// The notes play but don't show up in the sequencer's note lists and can't be edited.
+        /// Replaces any notes already in the sequencer and sets its length to fit the file.
+        /// </summary>
+        /// <param name="midiData">The bytes of a type 0 or 1 MIDI file.</param>
+        /// <param name="bpm">0 to keep the file in beats, or the tempo the clock will play at to follow the file's tempo changes.</param>
+        /// <returns>The number of notes loaded or -1 if the file couldn't be read.</returns>
+        public int LoadMidi(byte[] midiData, double bpm = 0.0)
+        {
+            if (reference == IntPtr.Zero || midiData == null)
+                return -1;
+
+            StopMidiStream();
+            Clear();
+            double midiLength = 0.0;
+            int numNotes = Native.LoadSequencerMidi(reference, midiData, midiData.Length, bpm, out midiLength);
+            if (numNotes >= 0)
+                length = Math.Max(1, (int)Math.Ceiling(midiLength));
+            return numNotes;
+        }
+
+        /// <summary>
+        /// Plays a long MIDI file by moving its notes into the native sequencer shortly before they play.
+        /// Like LoadMidi the notes aren't editable. The sequencer stops looping while it streams.
+        /// </summary>
+        /// <param name="midiData">The bytes of a type 0 or 1 MIDI file.</param>
+        /// <param name="bpm">0 to keep the file in beats, or the tempo the clock will play at to follow the file's tempo changes.</param>
+        /// <returns>True if the file could be read.</returns>
+        public bool StreamMidi(byte[] midiData, double bpm = 0.0)
+        {
+            if (reference == IntPtr.Zero || midiData == null)
+                return false;
+
+            StopMidiStream();
+            Clear();
+            double midiLength = 0.0;
+            midiStream = Native.CreateMidiStream(reference, midiData, midiData.Length, bpm, out midiLength);
+            if (midiStream == IntPtr.Zero)
+                return false;
+
+            loop = false;
+            length = Math.Max(1, (int)Math.Ceiling(midiLength));
+            Native.UpdateMidiStream(midiStream, kMidiStreamLookahead);
+            return true;
+        }
+
+        /// <summary>
+        /// Stops streaming a MIDI file. Notes already moved into the sequencer stay.
+        /// </summary>
+        public void StopMidiStream()
+        {
+            if (midiStream != IntPtr.Zero)
+                Native.DeleteMidiStream(midiStream);
+            midiStream = IntPtr.Zero;
+        }
+
         void EnableComponent()
         {
             enabled = true;
@@ -153,6 +215,9 @@ namespace AudioHelm
         {
             UpdatePosition();
 
+            if (midiStream != IntPtr.Zero)
+                Native.UpdateMidiStream(midiStream, kMidiStreamLookahead);
+
             if (length != currentLength)
             {
                 if (reference != IntPtr.Zero)
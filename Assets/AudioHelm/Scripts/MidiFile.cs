@@ -32,10 +32,38 @@ namespace AudioHelm
             #if UNITY_EDITOR
             return ReadMidiFile(midiStream);
             #else
-            return new MidiData();
+            return ReadNativeMidiFile(midiStream);
             #endif
         }
 
+        static MidiData ReadNativeMidiFile(Stream midiStream)
+        {
+            MidiData midiData = new MidiData();
+            MemoryStream memoryStream = new MemoryStream();
+            midiStream.CopyTo(memoryStream);
+            byte[] bytes = memoryStream.ToArray();
+
+            double length = 0.0;
+            int numNotes = Native.ReadMidiNotes(bytes, bytes.Length, 0.0, null, 0, out length);
+            if (numNotes <= 0)
+                return midiData;
+
+            NoteData[] noteData = new NoteData[numNotes];
+            Native.ReadMidiNotes(bytes, bytes.Length, 0.0, noteData, numNotes, out length);
+            midiData.length = (int)length;
+            midiData.notes.Capacity = numNotes;
+            foreach (NoteData data in noteData)
+            {
+                Note note = new Note();
+                note.note = data.note;
+                note.velocity = data.velocity;
+                note.start = (float)data.start;
+                note.end = (float)data.end;
+                midiData.notes.Add(note);
+            }
+            return midiData;
+        }
+
         #if UNITY_EDITOR
         static MidiData ReadMidiFile(Stream midiStream)
         {
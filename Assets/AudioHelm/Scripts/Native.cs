@@ -6,6 +6,117 @@ using System.Runtime.InteropServices;
 
 namespace AudioHelm
 {
+    /// <summary>
+    /// The kind of event in a batch sent with Native.HelmSendEvents.
+    /// </summary>
+    public enum HelmEventType
+    {
+        kNoteOn,
+        kNoteOff,
+        kPitchWheel,
+        kModWheel,
+        kAftertouch,
+        kParameter
+    }
+
+    /// <summary>
+    /// A single event in a batch sent with Native.HelmSendEvents.
+    /// key is the MIDI note for note and aftertouch events and the parameter index for parameter events.
+    /// value is the velocity, wheel position, aftertouch or parameter value.
+    /// Events with a time above zero are scheduled at that AudioSettings.dspTime.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct HelmEvent
+    {
+        public HelmEventType type;
+        public int channel;
+        public int key;
+        public float value;
+        public double time;
+    }
+
+    /// <summary>
+    /// Counters for parallel rendering, read with Native.HelmGetParallelRenderStats.
+    /// savedSeconds is the mixer thread time saved: time rendering on workers minus time spent waiting on them.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ParallelRenderStats
+    {
+        public long blocksRenderedAhead;
+        public long blocksRenderedLate;
+        public double workerSeconds;
+        public double waitSeconds;
+        public double savedSeconds;
+        public int numThreads;
+    }
+
+    /// <summary>
+    /// Health counters of the synthesizer instances on a channel, read with Native.HelmGetStats.
+    /// Counts are summed over the instances and times are the worst of any instance.
+    /// lastLoad is the last render time over the length of audio it rendered, above 1 can't keep up.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct HelmStats
+    {
+        public int numInstances;
+        public int activeVoices;
+        public long blocksRendered;
+        public long chunksRendered;
+        public long silentBlocks;
+        public double lastRenderSeconds;
+        public double averageRenderSeconds;
+        public double maxRenderSeconds;
+        public double lastLoad;
+        public int noteQueueDepth;
+        public int noteQueueHighWater;
+        public int valueQueueDepth;
+        public int valueQueueHighWater;
+        public int scheduledQueueDepth;
+        public int scheduledQueueHighWater;
+        public long lateEvents;
+        public long scheduledOverflows;
+    }
+
+    /// <summary>
+    /// One note of a Native.LoadSequencerNotes batch or Native.ReadMidiNotes result. Times are measured in sixteenths.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct NoteData
+    {
+        public int note;
+        public float velocity;
+        public double start;
+        public double end;
+    }
+
+    /// <summary>
+    /// The native transport as of the last audio block, read with Native.HelmGetTransportPosition.
+    /// time is the DSP time in seconds at the end of that block, when beat and bpm were sampled.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct HelmTransportPosition
+    {
+        public double beat;
+        public double bpm;
+        public double time;
+        public long samples;
+        public int playing;
+    }
+
+    /// <summary>
+    /// One keyzone of a Native.HelmSetSamplerKeyzones call. sample is an id from Native.HelmLoadSample.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct SamplerKeyzoneData
+    {
+        public int sample;
+        public int rootKey;
+        public int minKey;
+        public int maxKey;
+        public float minVelocity;
+        public float maxVelocity;
+    }
+
     /// <summary>
     /// The native plugin interface to synthesizer and sequencer settings.
     /// If you want to control a synthesizer, a better was is through the HelmController class.
@@ -27,6 +138,20 @@ namespace AudioHelm
         #endif
         public static extern void HelmNoteOff(int channel, int note);
 
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmNoteOnScheduled(int channel, int note, float velocity, double startTime, double endTime);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmNoteOffScheduled(int channel, int note, double time);
+
         #if UNITY_IOS
           [DllImport("__Internal")]
         #else
@@ -69,6 +194,69 @@ namespace AudioHelm
         #endif
         public static extern void HelmSetAftertouch(int channel, int note, float value);
 
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmSendEvents(HelmEvent[] events, int numEvents);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmSetParallelRendering(bool enabled, int numThreads);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmSetParallelVoices(bool enabled, int numThreads);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmGetParallelRenderStats(ref ParallelRenderStats stats);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmResetParallelRenderStats();
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmReserveEngines(int numEngines);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern int HelmGetNumReadyEngines();
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern bool HelmGetStats(int channel, ref HelmStats stats);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmResetStats(int channel);
+
         #if UNITY_IOS
           [DllImport("__Internal")]
         #else
@@ -83,6 +271,69 @@ namespace AudioHelm
         #endif
         public static extern void HelmAddModulation(int channel, int index, string source, string dest, float amount);
 
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmAddModulationByIndex(int channel, int index, int sourceIndex, int destIndex, float amount);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern bool HelmLoadPatch(int channel, string json);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern bool HelmLoadBinaryPatch(int channel, byte[] patch, int size);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern int HelmConvertPatch(string json, byte[] buffer, int bufferSize);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern IntPtr HelmOpenPatchPack(string path);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmClosePatchPack(IntPtr pack);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern int HelmGetPatchPackSize(IntPtr pack);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern int HelmFindPackPatch(IntPtr pack, string name);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern bool HelmLoadPackPatch(int channel, IntPtr pack, int index);
+
         #if UNITY_IOS
           [DllImport("__Internal")]
         #else
@@ -203,6 +454,55 @@ namespace AudioHelm
         #endif
         public static extern IntPtr CreateNote(IntPtr sequencer, int note, float velocity, float start, float end);
 
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void LoadSequencerNotes(IntPtr sequencer, NoteData[] notes, int numNotes, [Out] IntPtr[] references);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void ClearSequencerNotes(IntPtr sequencer);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern int LoadSequencerMidi(IntPtr sequencer, byte[] midiData, int size, double bpm, out double length);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern int ReadMidiNotes(byte[] midiData, int size, double bpm, [Out] NoteData[] notes, int maxNotes, out double length);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern IntPtr CreateMidiStream(IntPtr sequencer, byte[] midiData, int size, double bpm, out double length);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void UpdateMidiStream(IntPtr stream, double lookahead);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void DeleteMidiStream(IntPtr stream);
+
         #if UNITY_IOS
           [DllImport("__Internal")]
         #else
@@ -260,5 +560,63 @@ namespace AudioHelm
           [DllImport("AudioPluginHelm")]
         #endif
         public static extern void Pause(bool pause);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmTransportStart(double time);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmTransportStop(double time);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmTransportSeek(double time, double beat);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmTransportSetTempo(double time, double bpm, double rampSeconds);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmGetTransportPosition(ref HelmTransportPosition position);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern int HelmLoadSample(float[] data, int frames, int channels, int sampleRate);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern void HelmDeleteSample(int sample);
+
+        #if UNITY_IOS
+          [DllImport("__Internal")]
+        #else
+          [DllImport("AudioPluginHelm")]
+        #endif
+        public static extern bool HelmSetSamplerKeyzones(int channel, SamplerKeyzoneData[] keyzones, int numKeyzones,
+                                                         int playMode, int interpolation, float velocityTracking,
+                                                         bool useNoteOff, bool loop);
     }
 }
@@ -0,0 +1,239 @@
+// Copyright 2017 Matt Tytel
+
+using UnityEngine;
+using System.Collections.Generic;
+
+namespace AudioHelm
+{
+    /// <summary>
+    /// A Sampler that plays its keyzones inside the native plugin instead of through AudioSources.
+    /// Notes start at their exact sample, polyphony doesn't need extra components and a
+    /// HelmSequencer on the same channel plays it without going through C#.
+    /// Needs a Helm Sampler effect on an AudioMixerGroup set to the same channel.
+    /// Keyzone mixer groups are ignored, everything plays out of the Helm Sampler effect.
+    /// </summary>
+    [RequireComponent(typeof(HelmAudioInit))]
+    [AddComponentMenu("Audio Helm/Native Sampler")]
+    public class NativeSampler : MonoBehaviour, NoteHandler
+    {
+        /// <summary>
+        /// How the sampler reads samples between their frames when they are pitched.
+        /// kLinear - cheapest, a little dull on samples pitched far up.
+        /// kCubic - smoother, costs about twice as much per voice.
+        /// </summary>
+        public enum Interpolation
+        {
+            kLinear,
+            kCubic,
+        }
+
+        /// <summary>
+        /// Specifies which Helm Sampler instance(s) play these keyzones.
+        /// </summary>
+        [Tooltip("The native synth channel to send note events to." +
+                 " This must match the channel set in the Helm Sampler plugin.")]
+        public int channel = 0;
+
+        /// <summary>
+        /// List of all the keyzones in the sampler.
+        /// Call UpdateKeyzones after changing them at runtime.
+        /// </summary>
+        public List<Keyzone> keyzones = new List<Keyzone>() { new Keyzone() };
+
+        /// <summary>
+        /// How Keyzones will play when multiple Keyzones match the input note.
+        /// </summary>
+        public Sampler.KeyzonePlayMode keyzonePlayMode = Sampler.KeyzonePlayMode.kAll;
+
+        /// <summary>
+        /// How the sampler reads samples between their frames when they are pitched.
+        /// </summary>
+        public Interpolation interpolation = Interpolation.kLinear;
+
+        /// <summary>
+        /// How much the velocity of a note on event affects the volume of the samples.
+        /// 0.0 for no effect and 1.0 for full effect.
+        /// </summary>
+        [Tooltip("How much the velocity of a note on event affects the volume of the samples. " +
+                 "0.0 for no effect and 1.0 for full effect")]
+        public float velocityTracking = 1.0f;
+
+        /// <summary>
+        /// Does a voice fade out when it gets a note off event?
+        /// </summary>
+        [Tooltip("Does a voice fade out when it gets a note off event?")]
+        public bool useNoteOff = false;
+
+        /// <summary>
+        /// Do samples loop until their note off instead of playing once?
+        /// </summary>
+        [Tooltip("Do samples loop until their note off instead of playing once?")]
+        public bool loop = false;
+
+        readonly Dictionary<AudioClip, int> loadedSamples = new Dictionary<AudioClip, int>();
+
+        void Awake()
+        {
+            UpdateKeyzones();
+        }
+
+        void Start()
+        {
+            Utils.InitAudioSource(GetComponent<AudioSource>());
+        }
+
+        void OnDestroy()
+        {
+            AllNotesOff();
+            Native.HelmSetSamplerKeyzones(channel, null, 0, (int)keyzonePlayMode, (int)interpolation,
+                                          velocityTracking, useNoteOff, loop);
+            foreach (int sample in loadedSamples.Values)
+                Native.HelmDeleteSample(sample);
+            loadedSamples.Clear();
+        }
+
+        void OnDisable()
+        {
+            AllNotesOff();
+        }
+
+        void OnValidate()
+        {
+            if (Application.isPlaying && isActiveAndEnabled)
+                UpdateKeyzones();
+        }
+
+        int LoadSample(AudioClip clip)
+        {
+            int sample = -1;
+            if (loadedSamples.TryGetValue(clip, out sample))
+                return sample;
+
+            if (clip.loadType != AudioClipLoadType.DecompressOnLoad)
+            {
+                Debug.LogWarning("AudioClip " + clip.name + " needs the Decompress On Load type to play in a NativeSampler.");
+                return -1;
+            }
+
+            clip.LoadAudioData();
+            float[] data = new float[clip.samples * clip.channels];
+            if (!clip.GetData(data, 0))
+                return -1;
+
+            sample = Native.HelmLoadSample(data, clip.samples, clip.channels, clip.frequency);
+            if (sample >= 0)
+                loadedSamples[clip] = sample;
+            return sample;
+        }
+
+        /// <summary>
+        /// Sends the keyzones and settings to the native sampler, loading any new AudioClips.
+        /// Samples no keyzone uses anymore are freed.
+        /// </summary>
+        public void UpdateKeyzones()
+        {
+            List<SamplerKeyzoneData> data = new List<SamplerKeyzoneData>();
+            HashSet<AudioClip> used = new HashSet<AudioClip>();
+            foreach (Keyzone keyzone in keyzones)
+            {
+                if (keyzone.audioClip == null)
+                    continue;
+
+                int sample = LoadSample(keyzone.audioClip);
+                if (sample < 0)
+                    continue;
+
+                used.Add(keyzone.audioClip);
+                SamplerKeyzoneData zone = new SamplerKeyzoneData();
+                zone.sample = sample;
+                zone.rootKey = keyzone.rootKey;
+                zone.minKey = keyzone.minKey;
+                zone.maxKey = keyzone.maxKey;
+                zone.minVelocity = keyzone.minVelocity;
+                zone.maxVelocity = keyzone.maxVelocity;
+                data.Add(zone);
+            }
+
+            Native.HelmSetSamplerKeyzones(channel, data.ToArray(), data.Count, (int)keyzonePlayMode,
+                                          (int)interpolation, velocityTracking, useNoteOff, loop);
+
+            List<AudioClip> unused = new List<AudioClip>();
+            foreach (AudioClip clip in loadedSamples.Keys)
+            {
+                if (!used.Contains(clip))
+                    unused.Add(clip);
+            }
+            foreach (AudioClip clip in unused)
+            {
+                Native.HelmDeleteSample(loadedSamples[clip]);
+                loadedSamples.Remove(clip);
+            }
+        }
+
+        /// <summary>
+        /// Adds an empty keyzone to the sampler.
+        /// </summary>
+        /// <returns>The keyzone created.</returns>
+        public Keyzone AddKeyzone()
+        {
+            Keyzone keyzone = new Keyzone();
+            keyzones.Add(keyzone);
+            return keyzone;
+        }
+
+        /// <summary>
+        /// Removes a keyzone from the sampler and updates the native sampler.
+        /// </summary>
+        /// <returns>The removed keyzones index. -1 if it doesnt exist.</returns>
+        /// <param name="keyzone">The keyzone to remove.</param>
+        public int RemoveKeyzone(Keyzone keyzone)
+        {
+            int index = keyzones.IndexOf(keyzone);
+            keyzones.Remove(keyzone);
+            UpdateKeyzones();
+            return index;
+        }
+
+        /// <summary>
+        /// Silences every note playing in the referenced Helm Sampler instance(s).
+        /// </summary>
+        public void AllNotesOff()
+        {
+            Native.HelmAllNotesOff(channel);
+        }
+
+        /// <summary>
+        /// Triggers a note on event for the Helm Sampler instance(s) this points to.
+        /// Looping samples play until NoteOff is called.
+        /// </summary>
+        /// <param name="note">The MIDI keyboard note to play. [0, 127]</param>
+        /// <param name="velocity">How hard you hit the key. [0.0, 1.0]</param>
+        public void NoteOn(int note, float velocity = 1.0f)
+        {
+            Native.HelmNoteOn(channel, note, velocity);
+        }
+
+        /// <summary>
+        /// Triggers a note on event for the Helm Sampler instance(s) this points to at the given time
+        /// and turns it off at the given time. Timing is sample accurate.
+        /// </summary>
+        /// <param name="note">The MIDI keyboard note to play. [0, 127]</param>
+        /// <param name="velocity">How hard you hit the key. [0.0, 1.0]</param>
+        /// <param name="timeToStart">DSP time to start the note.</param>
+        /// <param name="timeToEnd">DSP time to end the note.</param>
+        public void NoteOnScheduled(int note, float velocity, double timeToStart, double timeToEnd)
+        {
+            Native.HelmNoteOnScheduled(channel, note, velocity, timeToStart, timeToEnd);
+        }
+
+        /// <summary>
+        /// Triggers a note off event for the Helm Sampler instance(s) this points to.
+        /// Only has an effect with useNoteOff set.
+        /// </summary>
+        /// <param name="note">The MIDI keyboard note to turn off. [0, 127]</param>
+        public void NoteOff(int note)
+        {
+            Native.HelmNoteOff(channel, note);
+        }
+    }
+}
@@ -194,6 +194,15 @@ namespace AudioHelm
             }
         }
 
+        /// <summary>
+        /// Uses a native note the parent sequencer already created, e.g. in a bulk load.
+        /// </summary>
+        /// <param name="nativeNote">The native note reference.</param>
+        public void SetNativeReference(IntPtr nativeNote)
+        {
+            reference = nativeNote;
+        }
+
         /// <summary>
         /// Tries to delete the native note representation.
         /// </summary>
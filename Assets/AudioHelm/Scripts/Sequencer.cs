@@ -503,6 +503,11 @@ namespace AudioHelm
         /// <param name="end">The end of the note measured in sixteenths.</param>
         /// <param name="velocity">The velocity of the note (how hard the key is hit).</param>
         public Note AddNote(int note, float start, float end, float velocity = 1.0f)
+        {
+            return AddNote(note, start, end, velocity, true);
+        }
+
+        Note AddNote(int note, float start, float end, float velocity, bool createNative)
         {
             ClampNotesInRange(note, start, end);
             note = Mathf.Clamp(note, 0, Utils.kMidiSize - 1);
@@ -515,7 +520,8 @@ namespace AudioHelm
                 parent = this
             };
 
-            noteObject.TryCreate();
+            if (createNative)
+                noteObject.TryCreate();
 
             if (allNotes[note] == null)
                 allNotes[note] = new NoteRow();
@@ -546,6 +552,39 @@ namespace AudioHelm
             }
         }
 
+        /// <summary>
+        /// Add many notes to the sequencer. Same as calling AddNote for each one, but the native
+        /// sequencer gets all the notes in one call.
+        /// </summary>
+        /// <param name="notes">The notes to copy into the sequencer.</param>
+        public void AddNotes(List<Note> notes)
+        {
+            List<Note> added = new List<Note>(notes.Count);
+            foreach (Note note in notes)
+                added.Add(AddNote(note.note, note.start, note.end, note.velocity, false));
+
+            // Later notes can trim away earlier ones.
+            added.RemoveAll(note => note.parent != this);
+
+            IntPtr nativeSequencer = Reference();
+            if (nativeSequencer == IntPtr.Zero || added.Count == 0)
+                return;
+
+            NoteData[] noteData = new NoteData[added.Count];
+            for (int i = 0; i < added.Count; ++i)
+            {
+                noteData[i].note = added[i].note;
+                noteData[i].velocity = added[i].velocity;
+                noteData[i].start = added[i].start;
+                noteData[i].end = added[i].end;
+            }
+
+            IntPtr[] references = new IntPtr[added.Count];
+            Native.LoadSequencerNotes(nativeSequencer, noteData, added.Count, references);
+            for (int i = 0; i < added.Count; ++i)
+                added[i].SetNativeReference(references[i]);
+        }
+
         void ReadMidiData(MidiFile.MidiData midiData)
         {
             if (midiData == null || midiData.notes == null)
@@ -553,9 +592,7 @@ namespace AudioHelm
 
             Clear();
             length = midiData.length;
-
-            foreach (Note note in midiData.notes)
-                AddNote(note.note, note.start, note.end, note.velocity);
+            AddNotes(midiData.notes);
         }
 
         // TODO: Get MIDI reading out of Beta.
@@ -585,14 +622,19 @@ namespace AudioHelm
         /// </summary>
         public void Clear()
         {
+            IntPtr nativeSequencer = Reference();
+            if (nativeSequencer != IntPtr.Zero)
+                Native.ClearSequencerNotes(nativeSequencer);
+
             for (int i = 0; i < allNotes.Length; ++i)
             {
                 if (allNotes[i] != null)
                 {
                     foreach (Note note in allNotes[i].notes)
                     {
-                        note.TryDelete();
+                        // The native notes are already gone, so only drop the reference.
                         note.parent = null;
+                        note.TryDelete();
                     }
 
                     allNotes[i].notes.Clear();
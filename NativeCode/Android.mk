@@ -14,6 +14,16 @@ LOCAL_PATH      := $(NDK_PROJECT_PATH)
 LOCAL_MODULE    := libAudioPluginHelm
 LOCAL_CFLAGS    := -Werror -I $(MOPO_DIR) -I $(SYNTHESIS_DIR) -I $(HELM_COMMON_DIR) -I $(QUEUE_DIR) -O3 -fPIC -std=c++11 -mfpu=neon
 
+# Build with SAMPLES=float to run the synth in single precision.
+ifeq ($(SAMPLES),float)
+LOCAL_CFLAGS    += -DMOPO_FLOAT_SAMPLES
+endif
+
+# Build with TABLES=float to store the oscillator tables in single precision.
+ifeq ($(TABLES),float)
+LOCAL_CFLAGS    += -DMOPO_FLOAT_WAVE_TABLES
+endif
+
 MOPO_CPPS := $(wildcard $(MOPO_DIR)/*.cpp)
 SYNTHESIS_CPPS := $(wildcard $(SYNTHESIS_DIR)/*.cpp)
 LOCAL_CPPS := $(wildcard $(LOCAL_DIR)/*.cpp)
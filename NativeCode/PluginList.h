@@ -2,4 +2,5 @@
 
 #if PLATFORM_OSX | PLATFORM_WIN  | PLATFORM_LINUX | PLATFORM_ANDROID
 DECLARE_EFFECT("Helm", Helm)
+DECLARE_EFFECT("Helm Sampler", HelmSampler)
 #endif
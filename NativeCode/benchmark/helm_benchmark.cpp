@@ -0,0 +1,578 @@
+/* Copyright 2017 Matt Tytel */
+
+// Headless benchmark for the Helm Unity plugin.
+// Acts as a minimal Unity host: instances are created and driven through the plugin's own
+// effect definition, patches come from the preset folder and each instance plays scripted chords.
+// Build and run on Linux with:
+//   make -f Makefile.benchmark
+//   out/helm_benchmark --presets ../Assets/AudioHelm/Presets --max-patches 4
+//   out/helm_benchmark --modulations
+//   out/helm_benchmark --unison-kernel
+//   out/helm_benchmark --onsets
+
+#include <cstdint>
+#include "AudioPluginInterface.h"
+#include "helm_common.h"
+#include "helm_engine.h"
+#include "helm_oscillators.h"
+#include "helm_patch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+extern "C" int UnityGetAudioEffectDefinitions(UnityAudioEffectDefinition*** definitions);
+extern "C" void HelmNoteOn(int channel, int note, float velocity);
+extern "C" void HelmNoteOnScheduled(int channel, int note, float velocity,
+                                    double start_time, double end_time);
+extern "C" void HelmAllNotesOff(int channel);
+extern "C" void HelmAddModulation(int channel, int index, const char* source, const char* dest,
+                                  float amount);
+extern "C" void HelmSetParallelRendering(bool enabled, int num_threads);
+extern "C" void* CreateSequencer();
+extern "C" void DeleteSequencer(void* sequencer);
+extern "C" void EnableSequencer(void* sequencer, bool enable);
+extern "C" void* CreateNote(void* sequencer, int note, float velocity, float start, float end);
+extern "C" void HelmTransportSeek(double time, double beat);
+extern "C" void HelmTransportSetTempo(double time, double bpm, double ramp_seconds);
+
+namespace {
+  const int kSampleRate = 44100;
+  const int kNumChannels = 2;
+  const int kMaxPluginChannels = 17;
+  const int kMaxModulations = 16;
+  const double kChordSeconds = 0.5;
+  const int kKernelBlocks = 4000;
+  const double kKernelTolerance = 1e-9;
+  const int kOnsetBlockSizes[] = { 256, 512, 1024, 2048 };
+  const int kOnsetNote = 60;
+  const double kOnsetBpm = 120.0;
+  const int kOnsetClockAlign = 2048;
+  const int kOnsetSearch = 8192;
+
+  struct NamedPatch {
+    std::string name;
+    Helm::Patch data;
+  };
+
+  struct Options {
+    std::vector<int> block_sizes;
+    std::vector<int> instance_counts;
+    std::vector<int> polyphonies;
+    std::vector<int> unisons;
+    std::vector<std::string> patch_files;
+    double seconds;
+    int max_patches;
+    int parallel_threads;
+    bool modulations;
+    bool unison_kernel;
+    bool onsets;
+  };
+
+  // A note scheduled on a sample, or played by a sequencer on a sixteenth from beat 0.
+  struct OnsetNote {
+    bool sequenced;
+    double position;
+  };
+
+  const OnsetNote kOnsetNotes[] = {
+    { false, 22050 }, { false, 22100 }, { false, 30000 }, { true, 4 }, { true, 9 }
+  };
+
+  struct Result {
+    double ns_per_sample;
+    double worst_block_us;
+    double worst_block_load;
+    double voices_per_core;
+  };
+
+  bool loadPatch(const std::string& path, NamedPatch* patch) {
+    std::ifstream file(path.c_str());
+    if (!file)
+      return false;
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string text = buffer.str();
+
+    size_t slash = path.find_last_of('/');
+    patch->name = slash == std::string::npos ? path : path.substr(slash + 1);
+    return Helm::readPatch(text.c_str(), &patch->data);
+  }
+
+  void findPatches(const std::string& directory, std::vector<std::string>* files) {
+    DIR* dir = opendir(directory.c_str());
+    if (dir == nullptr)
+      return;
+
+    std::vector<std::string> entries;
+    while (dirent* entry = readdir(dir)) {
+      std::string name = entry->d_name;
+      if (name != "." && name != "..")
+        entries.push_back(name);
+    }
+    closedir(dir);
+
+    std::sort(entries.begin(), entries.end());
+    for (const std::string& name : entries) {
+      std::string path = directory + "/" + name;
+      if (name.size() > 5 && name.substr(name.size() - 5) == ".helm")
+        files->push_back(path);
+      else if (name.find('.') == std::string::npos)
+        findPatches(path, files);
+    }
+  }
+
+  std::vector<int> parseList(const char* text) {
+    std::vector<int> values;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ','))
+      values.push_back(atoi(item.c_str()));
+    return values;
+  }
+
+  // Plugin parameter indices follow the alphabetical parameter list after the channel parameter.
+  int parameterIndex(const std::string& name) {
+    static std::map<std::string, int> indices;
+    if (indices.empty()) {
+      int index = 1;
+      for (auto& parameter : mopo::Parameters::lookup_.getAllDetails())
+        indices[parameter.first] = index++;
+    }
+
+    auto found = indices.find(name);
+    return found == indices.end() ? -1 : found->second;
+  }
+
+  void setParameter(UnityAudioEffectDefinition* definition, UnityAudioEffectState* state,
+                    const std::string& name, float value) {
+    int index = parameterIndex(name);
+    if (index < 0)
+      return;
+
+    const mopo::ValueDetails& details = mopo::Parameters::getDetails(name);
+    value = std::max<float>(details.min, std::min<float>(details.max, value));
+    definition->setfloatparameter(state, index, value);
+  }
+
+  Result run(UnityAudioEffectDefinition* definition, const NamedPatch& patch, const Options& options,
+             int block_size, int num_instances, int polyphony, int unison) {
+    std::vector<UnityAudioEffectState> states(num_instances);
+    std::vector<float> in_buffer(block_size * kNumChannels, 1.0f);
+    std::vector<float> out_buffer(block_size * kNumChannels);
+    int host_data = 0;
+
+    for (int i = 0; i < num_instances; ++i) {
+      UnityAudioEffectState& state = states[i];
+      memset(&state, 0, sizeof(state));
+      state.structsize = sizeof(state);
+      state.samplerate = kSampleRate;
+      state.dspbuffersize = block_size;
+      state.internal = &host_data;
+      definition->create(&state);
+
+      definition->setfloatparameter(&state, 0, i % kMaxPluginChannels);
+      for (auto& setting : patch.data.settings)
+        setParameter(definition, &state, setting.first, setting.second);
+      setParameter(definition, &state, "polyphony", polyphony);
+      if (unison > 0) {
+        setParameter(definition, &state, "osc_1_unison_voices", unison);
+        setParameter(definition, &state, "osc_2_unison_voices", unison);
+      }
+
+      definition->process(&state, in_buffer.data(), out_buffer.data(), block_size,
+                          kNumChannels, kNumChannels);
+    }
+
+    int num_channels = std::min(num_instances, kMaxPluginChannels);
+    for (int channel = 0; channel < num_channels; ++channel) {
+      int index = 0;
+      for (const Helm::PatchModulation& modulation : patch.data.modulations) {
+        if (index >= kMaxModulations)
+          break;
+        HelmAddModulation(channel, index++, modulation.source.c_str(),
+                          modulation.destination.c_str(), modulation.amount);
+      }
+    }
+
+    int num_blocks = options.seconds * kSampleRate / block_size;
+    int chord_blocks = std::max<int>(1, kChordSeconds * kSampleRate / block_size);
+    double block_seconds = (1.0 * block_size) / kSampleRate;
+    long long total_nanoseconds = 0;
+    long long worst_nanoseconds = 0;
+
+    for (int b = 0; b < num_blocks; ++b) {
+      if (b % chord_blocks == 0) {
+        int chord = b / chord_blocks;
+        for (int channel = 0; channel < num_channels; ++channel) {
+          HelmAllNotesOff(channel);
+          for (int n = 0; n < polyphony; ++n)
+            HelmNoteOn(channel, 36 + (n * 7 + chord * 5) % 60, 0.8f);
+        }
+      }
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (UnityAudioEffectState& state : states) {
+        state.currdsptick = (b + 1ULL) * block_size;
+        definition->process(&state, in_buffer.data(), out_buffer.data(), block_size,
+                            kNumChannels, kNumChannels);
+      }
+      std::chrono::steady_clock::duration time = std::chrono::steady_clock::now() - start;
+      long long nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+
+      total_nanoseconds += nanoseconds;
+      worst_nanoseconds = std::max(worst_nanoseconds, nanoseconds);
+    }
+
+    for (UnityAudioEffectState& state : states)
+      definition->release(&state);
+
+    double total_samples = 1.0 * num_blocks * block_size * num_instances;
+    double audio_seconds = num_blocks * block_seconds;
+    double cores = 1.0 + std::max(0, options.parallel_threads);
+    Result result;
+    result.ns_per_sample = total_nanoseconds / total_samples;
+    result.worst_block_us = worst_nanoseconds / 1000.0;
+    result.worst_block_load = worst_nanoseconds / (1000000000.0 * block_seconds);
+    result.voices_per_core = (num_instances * polyphony * audio_seconds) /
+                             (total_nanoseconds / 1000000000.0) / cores;
+    return result;
+  }
+
+  double microseconds(std::chrono::steady_clock::duration time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time).count() / 1000.0;
+  }
+
+  // Connects and disconnects every modulation source to every destination on a full engine.
+  // This is the graph work a modulation change does while holding the instance lock.
+  void runModulations() {
+    mopo::HelmEngine engine;
+    engine.setSampleRate(kSampleRate);
+    mopo::ModulationConnection connection;
+
+    int num_connections = 0;
+    double total_connect = 0.0;
+    double total_disconnect = 0.0;
+    double worst_connect = 0.0;
+    double worst_disconnect = 0.0;
+
+    for (int source = 0; source < engine.getNumModulationSources(); ++source) {
+      for (int destination = 0; destination < engine.getNumModulationDestinations(); ++destination) {
+        connection.source_index = source;
+        connection.destination_index = destination;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        engine.connectModulation(&connection);
+        std::chrono::steady_clock::time_point connected = std::chrono::steady_clock::now();
+        engine.disconnectModulation(&connection);
+        std::chrono::steady_clock::time_point disconnected = std::chrono::steady_clock::now();
+
+        double connect_us = microseconds(connected - start);
+        double disconnect_us = microseconds(disconnected - connected);
+        total_connect += connect_us;
+        total_disconnect += disconnect_us;
+        worst_connect = std::max(worst_connect, connect_us);
+        worst_disconnect = std::max(worst_disconnect, disconnect_us);
+        num_connections++;
+      }
+    }
+
+    printf("%-12s %12s %10s %10s\n", "", "connections", "mean us", "worst us");
+    printf("%-12s %12d %10.2f %10.2f\n", "connect", num_connections,
+           total_connect / num_connections, worst_connect);
+    printf("%-12s %12d %10.2f %10.2f\n", "disconnect", num_connections,
+           total_disconnect / num_connections, worst_disconnect);
+  }
+
+  typedef void (*UnisonKernel)(mopo::mopo_float*, const unsigned int*,
+                               const mopo::wave_float* const*, const unsigned int*,
+                               const int*, int, int);
+
+  double timeUnisonKernel(UnisonKernel kernel, mopo::mopo_float* totals,
+                          const unsigned int* phase_bases, const mopo::wave_float* const* buffers,
+                          const unsigned int* start_phases, const int* detunes, int voices) {
+    std::chrono::steady_clock::duration best = std::chrono::steady_clock::duration::max();
+    for (int run = 0; run < 5; ++run) {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (int b = 0; b < kKernelBlocks; ++b) {
+        mopo::utils::zeroBuffer(totals, mopo::MAX_BUFFER_SIZE);
+        kernel(totals, phase_bases, buffers, start_phases, detunes, voices, mopo::MAX_BUFFER_SIZE);
+      }
+      best = std::min(best, std::chrono::steady_clock::now() - start);
+    }
+    return 1000.0 * microseconds(best) / (1.0 * kKernelBlocks * mopo::MAX_BUFFER_SIZE);
+  }
+
+  // Times the oscillator unison kernel against its one voice at a time reference for every
+  // unison count and checks they agree. Returns false if any count is out of tolerance.
+  bool runUnisonKernel() {
+    const int max_unison = mopo::HelmOscillators::MAX_UNISON;
+    unsigned int phase_inc = UINT_MAX / 200;
+
+    unsigned int phase_bases[mopo::MAX_BUFFER_SIZE];
+    for (int i = 0; i < mopo::MAX_BUFFER_SIZE; ++i)
+      phase_bases[i] = i * phase_inc;
+
+    const mopo::wave_float* buffers[max_unison];
+    unsigned int start_phases[max_unison];
+    int detunes[max_unison];
+    srand(0);
+    for (int v = 0; v < max_unison; ++v) {
+      detunes[v] = (v % 2 ? -1 : 1) * phase_inc / 100 * ((v + 1) / 2);
+      buffers[v] = mopo::FixedPointWave::getBuffer(mopo::FixedPointWaveLookup::kDownSaw,
+                                                   phase_inc + detunes[v]);
+      start_phases[v] = (UINT_MAX / RAND_MAX) * rand();
+    }
+
+    mopo::mopo_float totals[mopo::MAX_BUFFER_SIZE];
+    mopo::mopo_float reference[mopo::MAX_BUFFER_SIZE];
+    bool passed = true;
+
+    printf("%-8s %14s %14s %8s %12s\n", "unison", "reference ns", "kernel ns", "speedup", "max error");
+    for (int voices = 2; voices <= max_unison; ++voices) {
+      double reference_ns = timeUnisonKernel(mopo::HelmOscillators::sumVoicesReference, reference,
+                                             phase_bases, buffers, start_phases, detunes, voices);
+      double kernel_ns = timeUnisonKernel(mopo::HelmOscillators::sumVoices, totals,
+                                          phase_bases, buffers, start_phases, detunes, voices);
+
+      double max_error = 0.0;
+      for (int i = 0; i < mopo::MAX_BUFFER_SIZE; ++i)
+        max_error = std::max<double>(max_error, fabs(totals[i] - reference[i]));
+      passed = passed && max_error <= kKernelTolerance;
+
+      // Times are per sample of the whole unison stack.
+      printf("%-8d %14.2f %14.2f %7.2fx %12.3g%s\n", voices, reference_ns, kernel_ns,
+             reference_ns / kernel_ns, max_error, max_error <= kKernelTolerance ? "" : "  FAILED");
+    }
+    return passed;
+  }
+
+  // Renders a fresh instance on channel 0 in blocks of block_size from beat 0 with one note.
+  // The transport ignores a DSP clock that goes back, so each run starts where *clock is and
+  // moves it on. Returns the first sample heard after the start, or -1 if it stays silent.
+  long long noteOnset(UnityAudioEffectDefinition* definition, int block_size, const OnsetNote& note,
+                      long long* clock) {
+    std::vector<float> in_buffer(block_size * kNumChannels, 1.0f);
+    std::vector<float> out_buffer(block_size * kNumChannels);
+    int host_data = 0;
+
+    UnityAudioEffectState state;
+    memset(&state, 0, sizeof(state));
+    state.structsize = sizeof(state);
+    state.samplerate = kSampleRate;
+    state.dspbuffersize = block_size;
+    state.internal = &host_data;
+    state.currdsptick = *clock;
+
+    double note_sample = note.position;
+    void* sequencer = nullptr;
+    if (note.sequenced) {
+      note_sample = note.position * 15.0 * kSampleRate / kOnsetBpm;
+      sequencer = CreateSequencer();
+      CreateNote(sequencer, kOnsetNote, 1.0f, note.position, note.position + 1.0);
+      EnableSequencer(sequencer, true);
+    }
+    HelmTransportSetTempo(0.0, kOnsetBpm, 0.0);
+    HelmTransportSeek(0.0, 0.0);
+
+    definition->create(&state);
+    definition->process(&state, in_buffer.data(), out_buffer.data(), block_size,
+                        kNumChannels, kNumChannels);
+
+    if (!note.sequenced) {
+      double start_time = (*clock + note_sample) / kSampleRate;
+      HelmNoteOnScheduled(0, kOnsetNote, 1.0f, start_time, start_time + kChordSeconds);
+    }
+
+    long long onset = -1;
+    for (long long tick = block_size; onset < 0 && tick < note_sample + kOnsetSearch; tick += block_size) {
+      state.currdsptick = *clock + tick;
+      definition->process(&state, in_buffer.data(), out_buffer.data(), block_size,
+                          kNumChannels, kNumChannels);
+      for (int i = 0; i < block_size && onset < 0; ++i) {
+        if (out_buffer[i * kNumChannels])
+          onset = tick + i;
+      }
+    }
+    *clock = state.currdsptick + 2 * kSampleRate;
+    *clock -= *clock % kOnsetClockAlign;
+
+    definition->release(&state);
+    if (sequencer)
+      DeleteSequencer(sequencer);
+    return onset;
+  }
+
+  // Checks that scheduled and sequencer notes are heard on the same sample for every block size.
+  // Returns false if any note moves with the block size.
+  bool runOnsets(UnityAudioEffectDefinition* definition) {
+    long long clock = 0;
+    bool passed = true;
+
+    printf("%-14s", "note");
+    for (int block_size : kOnsetBlockSizes)
+      printf(" %10d", block_size);
+    printf("\n");
+
+    for (const OnsetNote& note : kOnsetNotes) {
+      printf("%-9s %4g", note.sequenced ? "sixteenth" : "sample", note.position);
+      long long first_onset = noteOnset(definition, kOnsetBlockSizes[0], note, &clock);
+      bool same = first_onset >= 0;
+      for (int block_size : kOnsetBlockSizes) {
+        long long onset = noteOnset(definition, block_size, note, &clock);
+        same = same && onset == first_onset;
+        printf(" %10lld", onset);
+      }
+      printf("%s\n", same ? "" : "  FAILED");
+      passed = passed && same;
+    }
+    return passed;
+  }
+
+  void printUsage() {
+    printf("Usage: helm_benchmark [options] [patch.helm ...]\n"
+           "  --blocks 256,1024      block sizes in samples\n"
+           "  --instances 1,8        number of Helm instances\n"
+           "  --polyphony 1,8        notes held per instance\n"
+           "  --unison 1,4           oscillator unison voices, 0 keeps the patch setting\n"
+           "  --presets DIR          benchmark every .helm patch found under DIR\n"
+           "  --max-patches N        only use the first N patches found\n"
+           "  --seconds S            audio seconds rendered per run\n"
+           "  --parallel N           render with N worker threads (HelmSetParallelRendering)\n"
+           "  --modulations          time connecting and disconnecting every modulation instead\n"
+           "  --unison-kernel        time and check the oscillator unison kernel instead\n"
+           "  --onsets               check scheduled and sequencer notes start on the same sample\n"
+           "                         for every block size\n");
+  }
+
+  bool parseOptions(int argc, char** argv, Options* options) {
+    options->block_sizes = parseList("256,1024");
+    options->instance_counts = parseList("1,8");
+    options->polyphonies = parseList("1,8");
+    options->unisons = parseList("1,4");
+    options->seconds = 2.0;
+    options->max_patches = 0;
+    options->parallel_threads = 0;
+    options->modulations = false;
+    options->unison_kernel = false;
+    options->onsets = false;
+
+    for (int i = 1; i < argc; ++i) {
+      std::string arg = argv[i];
+      bool has_value = i + 1 < argc;
+      if (arg == "--help" || arg == "-h")
+        return false;
+      else if (arg == "--blocks" && has_value)
+        options->block_sizes = parseList(argv[++i]);
+      else if (arg == "--instances" && has_value)
+        options->instance_counts = parseList(argv[++i]);
+      else if (arg == "--polyphony" && has_value)
+        options->polyphonies = parseList(argv[++i]);
+      else if (arg == "--unison" && has_value)
+        options->unisons = parseList(argv[++i]);
+      else if (arg == "--presets" && has_value)
+        findPatches(argv[++i], &options->patch_files);
+      else if (arg == "--max-patches" && has_value)
+        options->max_patches = atoi(argv[++i]);
+      else if (arg == "--seconds" && has_value)
+        options->seconds = atof(argv[++i]);
+      else if (arg == "--parallel" && has_value)
+        options->parallel_threads = atoi(argv[++i]);
+      else if (arg == "--modulations")
+        options->modulations = true;
+      else if (arg == "--unison-kernel")
+        options->unison_kernel = true;
+      else if (arg == "--onsets")
+        options->onsets = true;
+      else if (arg.size() && arg[0] != '-')
+        options->patch_files.push_back(arg);
+      else
+        return false;
+    }
+    return true;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  Options options;
+  if (!parseOptions(argc, argv, &options)) {
+    printUsage();
+    return 1;
+  }
+
+  if (options.modulations) {
+    runModulations();
+    return 0;
+  }
+
+  if (options.unison_kernel)
+    return runUnisonKernel() ? 0 : 1;
+
+  UnityAudioEffectDefinition** definitions = nullptr;
+  int num_definitions = UnityGetAudioEffectDefinitions(&definitions);
+  UnityAudioEffectDefinition* definition = nullptr;
+  for (int i = 0; i < num_definitions; ++i) {
+    if (strcmp(definitions[i]->name, "Helm") == 0)
+      definition = definitions[i];
+  }
+  if (definition == nullptr) {
+    fprintf(stderr, "Helm effect definition not found.\n");
+    return 1;
+  }
+
+  if (options.onsets)
+    return runOnsets(definition) ? 0 : 1;
+
+  std::vector<NamedPatch> patches;
+  for (const std::string& file : options.patch_files) {
+    if (options.max_patches > 0 && patches.size() >= options.max_patches)
+      break;
+
+    NamedPatch patch;
+    if (loadPatch(file, &patch))
+      patches.push_back(patch);
+    else
+      fprintf(stderr, "Couldn't read patch %s\n", file.c_str());
+  }
+  if (patches.empty()) {
+    NamedPatch init_patch;
+    init_patch.name = "init";
+    patches.push_back(init_patch);
+  }
+
+  if (options.parallel_threads > 0)
+    HelmSetParallelRendering(true, options.parallel_threads);
+
+  printf("%-32s %6s %9s %9s %6s %10s %12s %10s %12s\n", "patch", "block", "instances",
+         "polyphony", "unison", "ns/sample", "worst us", "worst load", "voices/core");
+
+  for (const NamedPatch& patch : patches) {
+    for (int block_size : options.block_sizes) {
+      for (int num_instances : options.instance_counts) {
+        for (int polyphony : options.polyphonies) {
+          for (int unison : options.unisons) {
+            Result result = run(definition, patch, options, block_size, num_instances, polyphony, unison);
+            printf("%-32.32s %6d %9d %9d %6d %10.1f %12.1f %9.1f%% %12.1f\n", patch.name.c_str(),
+                   block_size, num_instances, polyphony, unison, result.ns_per_sample,
+                   result.worst_block_us, 100.0 * result.worst_block_load, result.voices_per_core);
+            fflush(stdout);
+          }
+        }
+      }
+    }
+  }
+
+  if (options.parallel_threads > 0)
+    HelmSetParallelRendering(false, 0);
+  return 0;
+}
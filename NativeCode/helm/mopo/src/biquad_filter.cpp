@@ -55,9 +55,9 @@ namespace mopo {
     MOPO_ASSERT(inputMatchesBufferSize(kAudio));
 
     current_type_ = static_cast<Type>(static_cast<int>(input(kType)->at(0)));
-    mopo_float cutoff = utils::clamp(input(kCutoff)->at(0), MIN_CUTTOFF, sample_rate_);
+    mopo_float cutoff = utils::clamp(input(kCutoff)->at(0), mopo_float(MIN_CUTTOFF), mopo_float(sample_rate_));
     mopo_float resonance = utils::clamp(input(kResonance)->at(0),
-                                        MIN_RESONANCE, MAX_RESONANCE);
+                                        mopo_float(MIN_RESONANCE), mopo_float(MAX_RESONANCE));
     computeCoefficients(current_type_, cutoff, resonance, input(kGain)->at(0));
 
     mopo_float delta_in_0 = (target_in_0_ - in_0_) / buffer_size_;
@@ -39,7 +39,12 @@
 
 namespace mopo {
 
+  // Define MOPO_FLOAT_SAMPLES to run the whole processor graph in single precision.
+#ifdef MOPO_FLOAT_SAMPLES
+  typedef float mopo_float;
+#else
   typedef double mopo_float;
+#endif
 
   const mopo_float PI = 3.1415926535897932384626433832795;
   const int MAX_BUFFER_SIZE = 256;
@@ -48,6 +53,8 @@ namespace mopo {
   const int MAX_SAMPLE_RATE = 192000;
   const int MIDI_SIZE = 128;
   const int MAX_POLYPHONY = 33;
+  // Most voices a batchable Processor renders in one pass.
+  const int MAX_BATCH_VOICES = 4;
 
   const int PPQ = 960; // Pulses per quarter note.
   const mopo_float VOICE_KILL_TIME = 0.02;
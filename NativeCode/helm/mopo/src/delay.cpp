@@ -46,7 +46,7 @@ namespace mopo {
     const mopo_float* audio = input(kAudio)->source->buffer;
     mopo_float* dest = output()->buffer;
 
-    mopo_float wet = utils::clamp(input(kWet)->at(0), 0.0, 1.0);
+    mopo_float wet = utils::clamp(input(kWet)->at(0), mopo_float(0.0), mopo_float(1.0));
     mopo_float new_wet = sqrt(wet);
     mopo_float new_dry = sqrt(1.0 - wet);
     mopo_float wet_inc = (new_wet - current_wet_) / buffer_size_;
@@ -55,7 +55,8 @@ namespace mopo {
     mopo_float new_feedback = input(kFeedback)->at(0);
     mopo_float feedback_inc = (new_feedback - current_feedback_) / buffer_size_;
 
-    mopo_float new_period = utils::clamp(input(kSampleDelay)->at(0), 2.0, memory_->getSize() - 1.0);
+    mopo_float new_period = utils::clamp(input(kSampleDelay)->at(0), mopo_float(2.0),
+                                         mopo_float(memory_->getSize() - 1.0));
     mopo_float period_inc = (new_period - current_period_) / buffer_size_;
 
     for (int i = 0; i < buffer_size_; ++i) {
@@ -72,7 +72,7 @@ namespace mopo {
     for (int i = 0; i < buffer_size; ++i) {
       mopo_float mix = last_mix_ + i * mult_mix;
       mopo_float drive = last_drive_ + i * mult_drive;
-      mopo_float distort = utils::clamp(drive * audio[i], -1.0, 1.0);
+      mopo_float distort = utils::clamp(drive * audio[i], mopo_float(-1.0), mopo_float(1.0));
       dest[i] = utils::interpolate(audio[i], distort, mix);
     }
 
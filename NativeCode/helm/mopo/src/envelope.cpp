@@ -53,7 +53,7 @@ namespace mopo {
     int samples = 0;
 
     if (state_ == kAttacking) {
-      mopo_float attack = utils::max(input(kAttack)->at(0), 0.000000001);
+      mopo_float attack = utils::max(input(kAttack)->at(0), mopo_float(0.000000001));
       mopo_float attack_increment = 1.0 / (sample_rate_ * attack);
       samples = (ATTACK_DONE - current_value_) / attack_increment;
 
@@ -89,7 +89,7 @@ namespace mopo {
     }
     else if (state_ == kKilling) {
       mopo_float decrement = samples_to_process_ / (VOICE_KILL_TIME * sample_rate_);
-      current_value_ = utils::max(0.0, current_value_ - decrement);
+      current_value_ = utils::max(mopo_float(0.0), current_value_ - decrement);
       output(kValue)->buffer[0] = current_value_;
     }
   }
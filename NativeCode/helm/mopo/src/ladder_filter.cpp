@@ -36,7 +36,7 @@ namespace mopo {
   void LadderFilter::process() {
     MOPO_ASSERT(inputMatchesBufferSize(kAudio));
 
-    mopo_float cutoff = utils::clamp(input(kCutoff)->at(0), MIN_CUTTOFF, sample_rate_);
+    mopo_float cutoff = utils::clamp(input(kCutoff)->at(0), mopo_float(MIN_CUTTOFF), mopo_float(sample_rate_));
 
     mopo_float g = g_;
     computeCoefficients(cutoff);
@@ -18,5 +18,519 @@
 
 namespace mopo {
 
-  const MagnitudeLookupSingleton MagnitudeLookup::lookup_;
+  // Generated by tables/helm_tables.cpp, regenerate with make -f Makefile.tables generate.
+  const mopo_float MagnitudeLookup::lookup_[MAGNITUDE_LOOKUP_RESOLUTION + 2] = {
+    0.00099999999999999937, 0.0010067752981368562, 0.0010135965009385565, 0.0010204639194228895,
+    0.0010273778667148853, 0.0010343386580610866, 0.0010413466108439272, 0.0010484020445961995,
+    0.0010555052810156292, 0.0010626566439795372, 0.0010698564595596103, 0.0010771050560367682,
+    0.0010844027639161332, 0.0010917499159420968, 0.0010991468471134931, 0.0011065938946988724,
+    0.0011140913982518831, 0.0011216396996267474, 0.0011292391429938535, 0.0011368900748554448,
+    0.0011445928440614241, 0.0011523478018252533, 0.0011601553017399711, 0.0011680156997943138,
+    0.0011759293543889499, 0.0011838966263528169, 0.0011919178789595764, 0.0011999934779441765,
+    0.0012081237915195324, 0.0012163091903933073, 0.0012245500477848211, 0.0012328467394420648,
+    0.0012411996436588366, 0.001249609141291986, 0.001258075615778781, 0.0012665994531543912,
+    0.0012751810420694922, 0.001283820773807981, 0.0012925190423048207, 0.0013012762441639994,
+    0.00131009277867662, 0.0013189690478390976, 0.0013279054563714939, 0.0013369024117359687,
+    0.0013459603241553631, 0.0013550796066318963, 0.0013642606749660025, 0.0013735039477752869,
+    0.0013828098465136134, 0.0013921787954903244, 0.0014016112218895819, 0.0014111075557898484,
+    0.0014206682301834948, 0.0014302936809965491, 0.0014399843471085633, 0.0014497406703726312,
+    0.0014595630956355315, 0.0014694520707580162, 0.0014794080466352237, 0.0014894314772172425,
+    0.0014995228195298072, 0.0015096825336951422, 0.0015199110829529324, 0.0015302089336814517,
+    0.0015405765554188243, 0.0015510144208844389, 0.0015615230060004957, 0.0015721027899137103,
+    0.0015827542550171589, 0.0015934778869722791, 0.0016042741747310052, 0.001615143610558068,
+    0.0016260866900534372, 0.0016371039121749241, 0.0016481957792609243, 0.0016593627970533265,
+    0.0016706054747205703, 0.0016819243248808677, 0.0016933198636255673, 0.0017047926105426927,
+    0.0017163430887406287, 0.0017279718248719804, 0.001739679349157577, 0.0017514661954106529,
+    0.0017633329010611851, 0.0017752800071804038, 0.0017873080585054527, 0.0017994176034642341,
+    0.001811609194200413, 0.0018238833865985905, 0.0018362407403096563, 0.0018486818187762972,
+    0.0018612071892586937, 0.0018738174228603813, 0.0018865130945542976, 0.0018992947832089876,
+    0.0019121630716150057, 0.001925118546511484, 0.0019381617986128921, 0.0019512934226359614,
+    0.0019645140173268081, 0.0019778241854882302, 0.0019912245340071993, 0.0020047156738825225,
+    0.0020182982202527067, 0.0020319727924240048, 0.0020457400138986595, 0.0020596005124033207,
+    0.0020735549199176768, 0.0020876038727032638, 0.0021017480113324858, 0.0021159879807178096,
+    0.0021303244301411786, 0.0021447580132836134, 0.0021592893882550227, 0.0021739192176242024,
+    0.002188648168449049, 0.0022034769123069754, 0.0022184061253255364, 0.0022334364882132468,
+    0.0022485686862906266, 0.0022638034095214445, 0.0022791413525441854, 0.0022945832147037138,
+    0.0023101297000831574, 0.0023257815175360269, 0.002341539380718525, 0.0023574040081220868,
+    0.0023733761231061333, 0.0023894564539310732, 0.0024056457337914934, 0.0024219447008495911,
+    0.0024383540982688256, 0.0024548746742478244, 0.0024715071820544708, 0.0024882523800602752,
+    0.0025051110317749255, 0.0025220839058811301, 0.0025391717762696412, 0.0025563754220745633,
+    0.0025736956277088497, 0.0025911331829001024, 0.0026086888827265516, 0.0026263635276533308,
+    0.0026441579235689473, 0.0026620728818220621, 0.0026801092192584438, 0.0026982677582582612,
+    0.0027165493267735275, 0.0027349547583658987, 0.0027534848922446385, 0.0027721405733049298,
+    0.002790922652166346, 0.0028098319852116831, 0.002828869434625964, 0.0028480358684357995,
+    0.0028673321605489121, 0.0028867591907940321, 0.0029063178449609682, 0.0029260090148410492,
+    0.0029458335982677259, 0.0029657924991575626, 0.0029858866275514042, 0.0030061168996559223,
+    0.0030264842378853324, 0.0030469895709035067, 0.0030676338336662668, 0.003088417967464068,
+    0.0031093429199648601, 0.0031304096452573504, 0.0031516191038944564, 0.0031729722629371582,
+    0.0031944700959985325, 0.0032161135832881995, 0.0032379037116569667, 0.0032598414746418817,
+    0.0032819278725114719, 0.003304163912311398, 0.0033265506079103485, 0.0033490889800462842,
+    0.0033717800563729601, 0.0033946248715067953, 0.0034176244670740407, 0.0034407798917582845,
+    0.0034640922013482495, 0.003487562458785945, 0.0035111917342151269, 0.0035349811050301022,
+    0.0035589316559248374, 0.0035830444789424266, 0.0036073206735248776, 0.0036317613465632567,
+    0.0036563676124481358, 0.0036811405931204202, 0.0037060814181224945, 0.0037311912246497433,
+    0.0037564711576023664, 0.003781922369637627, 0.0038075460212223674, 0.0038333432806859562,
+    0.0038593153242735172, 0.0038854633361996116, 0.0039117885087021874, 0.0039382920420969799,
+    0.0039649751448321948, 0.0039918390335436605, 0.0040188849331102621, 0.0040461140767098069,
+    0.0040735277058752458, 0.0041011270705512979, 0.0041289134291514181, 0.0041568880486151909,
+    0.0041850522044660932, 0.0042134071808696619, 0.0042419542706920279, 0.0042706947755588804,
+    0.0042996300059148056, 0.0043287612810830539, 0.0043580899293256753, 0.0043876172879040911,
+    0.0044173447031400645, 0.0044472735304771048, 0.0044774051345422396, 0.0045077408892082579,
+    0.0045382821776563413, 0.0045690303924391471, 0.004599986935544283, 0.0046311532184582426,
+    0.0046625306622307587, 0.0046941206975396089, 0.004725924764755831, 0.0047579443140094079,
+    0.0047901808052553804, 0.0048226357083404354, 0.0048553105030698946, 0.0048882066792752064,
+    0.0049213257368818679, 0.0049546691859778296, 0.0049882385468823284, 0.0050220353502152182,
+    0.0050560611369667614, 0.0050903174585678872, 0.0051248058769609289, 0.0051595279646708559,
+    0.0051944853048769522, 0.005229679491485016, 0.0052651121292000289, 0.0053007848335993408,
+    0.005336699231206307, 0.0053728569595644649, 0.0054092596673121964, 0.0054459090142579122,
+    0.0054828066714557068, 0.0055199543212815678, 0.0055573536575100778, 0.0055950063853916618,
+    0.0056329142217303087, 0.0056710788949618784, 0.0057095021452328726, 0.0057481857244798496,
+    0.0057871313965092265, 0.0058263409370777472, 0.0058658161339734134, 0.0059055587870970689,
+    0.0059455707085443871, 0.0059858537226885455, 0.0060264096662633647, 0.0060672403884471362,
+    0.0061083477509468456, 0.006149733628083116, 0.0061913999068756234, 0.0062333484871292142,
+    0.0062755812815204412, 0.0063181002156848269, 0.0063609072283046207, 0.0064040042711972734,
+    0.0064473933094043407, 0.0064910763212811381, 0.0065350552985868988, 0.0065793322465756724,
+    0.0066239091840876599, 0.0066687881436413247, 0.00671397117152602, 0.0067594603278953724,
+    0.0068052576868611204, 0.0068513653365877489, 0.0068977853793876463, 0.0069445199318170503,
+    0.0069915711247724574, 0.007038941103587837, 0.0070866320281324164, 0.0071346460729092131,
+    0.0071829854271541222, 0.007231652294935797, 0.007280648895256067, 0.007329977462151205,
+    0.0073796402447937155, 0.0074296395075949479, 0.0074799775303082752, 0.0075306566081330987,
+    0.0075816790518194862, 0.0076330471877735333, 0.0076847633581633972, 0.0077368299210261414,
+    0.0077892492503752429, 0.0078420237363088317, 0.0078951557851186342, 0.007948647819399737,
+    0.008002502278161041, 0.0080567216169364665, 0.0081113083078968723, 0.0081662648399628314,
+    0.0082215937189181049, 0.008277297467523894, 0.0083333786256338197, 0.0083898397503097931,
+    0.0084466834159385874, 0.0085039122143492248, 0.0085615287549311008, 0.0086195356647530263,
+    0.0086779355886829924, 0.0087367311895087691, 0.0087959251480592675, 0.0088555201633268403,
+    0.0089155189525903199, 0.0089759242515389265, 0.0090367388143969482, 0.0090979654140493863,
+    0.0091596068421683774, 0.0092216659093404714, 0.0092841454451947428, 0.009347048298531873,
+    0.0094103773374540189, 0.009474135449495602, 0.0095383255417548999, 0.009602950541026679,
+    0.0096680133939356181, 0.0097335170670706673, 0.0097994645471202579, 0.0098658588410085492,
+    0.0099327029760325203, 0.009999999999999995, 0.010067752981368566, 0.010135965009385569,
+    0.010204639194228898, 0.010273778667148854, 0.01034338658061087, 0.010413466108439275,
+    0.010484020445961997, 0.010555052810156295, 0.010626566439795374, 0.010698564595596106,
+    0.010771050560367684, 0.010844027639161336, 0.01091749915942097, 0.010991468471134934,
+    0.011065938946988726, 0.011140913982518832, 0.011216396996267477, 0.011292391429938537,
+    0.011368900748554449, 0.011445928440614242, 0.011523478018252535, 0.011601553017399714,
+    0.01168015699794314, 0.011759293543889502, 0.011838966263528171, 0.011919178789595766,
+    0.011999934779441768, 0.012081237915195326, 0.012163091903933075, 0.012245500477848214,
+    0.01232846739442065, 0.012411996436588369, 0.012496091412919862, 0.012580756157787814,
+    0.012665994531543915, 0.012751810420694926, 0.012838207738079813, 0.012925190423048209,
+    0.013012762441639998, 0.013100927786766204, 0.01318969047839098, 0.013279054563714943,
+    0.013369024117359692, 0.013459603241553634, 0.013550796066318968, 0.013642606749660027,
+    0.013735039477752871, 0.013828098465136137, 0.013921787954903248, 0.014016112218895822,
+    0.014111075557898487, 0.014206682301834951, 0.014302936809965493, 0.014399843471085636,
+    0.014497406703726316, 0.014595630956355318, 0.014694520707580164, 0.014794080466352239,
+    0.014894314772172427, 0.014995228195298076, 0.015096825336951425, 0.015199110829529327,
+    0.01530208933681452, 0.015405765554188246, 0.015510144208844393, 0.01561523006000496,
+    0.015721027899137107, 0.015827542550171592, 0.015934778869722794, 0.016042741747310057,
+    0.016151436105580685, 0.016260866900534375, 0.016371039121749247, 0.016481957792609248,
+    0.016593627970533268, 0.016706054747205719, 0.01681924324880868, 0.016933198636255694,
+    0.017047926105426946, 0.017163430887406305, 0.017279718248719808, 0.017396793491575788,
+    0.017514661954106548, 0.017633329010611872, 0.017752800071804041, 0.017873080585054546,
+    0.017994176034642363, 0.018116091942004135, 0.018238833865985907, 0.018362407403096574,
+    0.018486818187762995, 0.018612071892586943, 0.018738174228603827, 0.018865130945542988,
+    0.018992947832089897, 0.01912163071615006, 0.019251185465114853, 0.019381617986128932,
+    0.019512934226359635, 0.019645140173268086, 0.019778241854882316, 0.019912245340072007,
+    0.020047156738825244, 0.02018298220252707, 0.020319727924240062, 0.020457400138986608,
+    0.020596005124033229, 0.020735549199176771, 0.020876038727032652, 0.021017480113324872,
+    0.021159879807178119, 0.021303244301411794, 0.021447580132836149, 0.021592893882550243,
+    0.021739192176242046, 0.021886481684490498, 0.022034769123069772, 0.02218406125325538,
+    0.022334364882132491, 0.022485686862906279, 0.022638034095214459, 0.022791413525441881,
+    0.022945832147037146, 0.023101297000831588, 0.023257815175360283, 0.023415393807185277,
+    0.023574040081220871, 0.02373376123106135, 0.023894564539310745, 0.02405645733791496,
+    0.024219447008495914, 0.024383540982688273, 0.024548746742478235, 0.024715071820544735,
+    0.024882523800602758, 0.025051110317749273, 0.025220839058811305, 0.025391717762696442,
+    0.025563754220745638, 0.025736956277088524, 0.025911331829001041, 0.026086888827265557,
+    0.026263635276533314, 0.026441579235689502, 0.026620728818220613, 0.026801092192584478,
+    0.026982677582582618, 0.027165493267735302, 0.027349547583658991, 0.027534848922446425,
+    0.027721405733049317, 0.027909226521663489, 0.028098319852116839, 0.028288694346259684,
+    0.028480358684358015, 0.028673321605489153, 0.028867591907940325, 0.02906317844960973,
+    0.029260090148410512, 0.029458335982677292, 0.029657924991575633, 0.029858866275514089,
+    0.030061168996559241, 0.030264842378853359, 0.030469895709035074, 0.030676338336662716,
+    0.030884179674640702, 0.031093429199648637, 0.03130409645257351, 0.03151619103894461,
+    0.031729722629371605, 0.031944700959985362, 0.032161135832882, 0.032379037116569719,
+    0.032598414746418836, 0.032819278725114726, 0.033041639123113989, 0.033265506079103509,
+    0.033490889800462866, 0.033717800563729611, 0.033946248715067961, 0.03417624467074043,
+    0.034407798917582867, 0.034640922013482504, 0.034875624587859456, 0.035111917342151293,
+    0.03534981105030105, 0.035589316559248386, 0.035830444789424272, 0.036073206735248803,
+    0.036317613465632594, 0.036563676124481366, 0.036811405931204209, 0.037060814181224984,
+    0.037311912246497422, 0.037564711576023695, 0.037819223696376282, 0.038075460212223716,
+    0.038333432806859552, 0.038593153242735198, 0.03885463336199612, 0.039117885087021916,
+    0.039382920420969789, 0.039649751448321988, 0.039918390335436614, 0.040188849331102644,
+    0.040461140767098058, 0.040735277058752503, 0.041011270705512984, 0.041289134291514207,
+    0.041568880486151906, 0.041850522044660977, 0.042134071808696626, 0.042419542706920305,
+    0.042706947755588788, 0.042996300059148097, 0.043287612810830552, 0.043580899293256779,
+    0.043876172879040894, 0.044173447031400699, 0.044472735304771062, 0.044774051345422429,
+    0.045077408892082574, 0.045382821776563456, 0.045690303924391482, 0.045999869355442861,
+    0.046311532184582421, 0.046625306622307634, 0.046941206975396103, 0.047259247647558345,
+    0.047579443140094067, 0.047901808052553861, 0.048226357083404371, 0.048553105030698977,
+    0.048882066792752053, 0.049213257368818729, 0.04954669185977837, 0.049882385468823315,
+    0.050220353502152239, 0.050560611369667628, 0.050903174585678911, 0.05124805876960932,
+    0.051595279646708618, 0.051944853048769529, 0.052296794914850196, 0.052651121292000322,
+    0.053007848335993472, 0.053366992312063079, 0.053728569595644683, 0.054092596673122002,
+    0.054459090142579186, 0.054828066714557082, 0.055199543212815713, 0.055573536575100814,
+    0.055950063853916675, 0.056329142217303098, 0.056710788949618771, 0.057095021452328761,
+    0.057481857244798561, 0.057871313965092278, 0.058263409370777459, 0.058658161339734172,
+    0.059055587870970754, 0.059455707085443885, 0.059858537226885437, 0.060264096662633687,
+    0.060672403884471426, 0.061083477509468492, 0.061497336280831143, 0.061913999068756297,
+    0.062333484871292213, 0.062755812815204454, 0.063181002156848257, 0.063609072283046283,
+    0.064040042711972806, 0.064473933094043451, 0.064910763212811362, 0.065350552985869059,
+    0.065793322465756796, 0.066239091840876646, 0.066687881436413229, 0.067139711715260272,
+    0.067594603278953794, 0.068052576868611256, 0.068513653365877475, 0.06897785379387654,
+    0.069445199318170586, 0.069915711247724624, 0.070389411035878355, 0.070866320281324183,
+    0.071346460729092148, 0.071829854271541274, 0.072316522949357961, 0.072806488952560686,
+    0.073299774621512076, 0.073796402447937212, 0.07429639507594947, 0.074799775303082711,
+    0.075306566081331031, 0.075816790518194982, 0.076330471877735354, 0.076847633581633989,
+    0.077368299210261463, 0.077892492503752547, 0.078420237363088341, 0.078951557851186349,
+    0.079486478193997415, 0.080025022781610528, 0.080567216169364686, 0.081113083078968737,
+    0.081662648399628363, 0.082215937189181174, 0.082772974675238947, 0.083333786256338208,
+    0.083898397503097979, 0.084466834159386009, 0.085039122143492268, 0.085615287549311025,
+    0.086195356647530308, 0.086779355886830056, 0.087367311895087701, 0.087959251480592693,
+    0.088555201633268452, 0.089155189525903331, 0.089759242515389276, 0.090367388143969496,
+    0.090979654140493929, 0.091596068421683954, 0.092216659093404735, 0.092841454451947497,
+    0.093470482985318779, 0.094103773374540386, 0.094741354494956034, 0.095383255417549065,
+    0.096029505410266849, 0.096680133939356372, 0.097335170670706697, 0.097994645471202638,
+    0.098658588410085554, 0.099327029760325397, 0.099999999999999978, 0.10067752981368568,
+    0.10135965009385567, 0.10204639194228904, 0.10273778667148857, 0.10343386580610872,
+    0.10413466108439272, 0.10484020445962004, 0.10555052810156297, 0.10626566439795376,
+    0.10698564595596104, 0.1077105056036769, 0.10844027639161337, 0.10917499159420974,
+    0.10991468471134931, 0.11065938946988735, 0.11140913982518835, 0.11216396996267479,
+    0.11292391429938534, 0.11368900748554457, 0.11445928440614245, 0.11523478018252538,
+    0.11601553017399721, 0.11680156997943147, 0.11759293543889514, 0.11838966263528172,
+    0.11919178789595773, 0.11999934779441776, 0.12081237915195339, 0.12163091903933078,
+    0.12245500477848222, 0.12328467394420657, 0.12411996436588384, 0.12496091412919866,
+    0.12580756157787823, 0.12665994531543923, 0.1275181042069494, 0.12838207738079815,
+    0.12925190423048216, 0.13012762441640013, 0.13100927786766217, 0.13189690478390989,
+    0.13279054563714951, 0.13369024117359707, 0.1345960324155365, 0.13550796066318974,
+    0.13642606749660038, 0.13735039477752872, 0.13828098465136154, 0.13921787954903253,
+    0.14016112218895835, 0.14111075557898486, 0.14206682301834969, 0.143029368099655,
+    0.14399843471085649, 0.14497406703726315, 0.14595630956355338, 0.14694520707580169,
+    0.14794080466352252, 0.14894314772172429, 0.14995228195298096, 0.15096825336951436,
+    0.15199110829529341, 0.15302089336814523, 0.15405765554188267, 0.15510144208844404,
+    0.15615230060004975, 0.15721027899137108, 0.15827542550171614, 0.15934778869722804,
+    0.16042741747310071, 0.16151436105580688, 0.16260866900534396, 0.16371039121749256,
+    0.16481957792609261, 0.16593627970533273, 0.16706054747205729, 0.16819243248808691,
+    0.16933198636255692, 0.17047926105426933, 0.17163430887406314, 0.17279718248719819,
+    0.17396793491575788, 0.17514661954106536, 0.17633329010611878, 0.17752800071804054,
+    0.17873080585054546, 0.17994176034642365, 0.18116091942004142, 0.18238833865985937,
+    0.18362407403096587, 0.18486818187762999, 0.18612071892586954, 0.18738174228603846,
+    0.18865130945543002, 0.18992947832089901, 0.19121630716150073, 0.19251185465114873,
+    0.19381617986128946, 0.19512934226359641, 0.196451401732681, 0.19778241854882336,
+    0.19912245340072021, 0.2004715673882525, 0.20182982202527083, 0.20319727924240083,
+    0.2045740013898662, 0.20596005124033234, 0.20735549199176784, 0.20876038727032675,
+    0.21017480113324885, 0.21159879807178122, 0.21303244301411806, 0.21447580132836172,
+    0.21592893882550257, 0.21739192176242053, 0.21886481684490511, 0.22034769123069795,
+    0.22184061253255394, 0.22334364882132499, 0.22485686862906284, 0.22638034095214482,
+    0.22791413525441886, 0.22945832147037148, 0.23101297000831594, 0.23257815175360308,
+    0.23415393807185281, 0.23574040081220882, 0.23733761231061354, 0.23894564539310778,
+    0.24056457337914966, 0.24219447008495926, 0.24383540982688279, 0.2454874674247827,
+    0.24715071820544746, 0.24882523800602768, 0.25051110317749281, 0.25220839058811334,
+    0.25391717762696453, 0.25563754220745655, 0.25736956277088524, 0.25911331829001061,
+    0.26086888827265559, 0.26263635276533331, 0.264415792356895, 0.26620728818220629,
+    0.2680109219258448, 0.26982677582582637, 0.27165493267735302, 0.27349547583658995,
+    0.27534848922446425, 0.2772140573304932, 0.2790922652166351, 0.28098319852116843,
+    0.28288694346259702, 0.2848035868435802, 0.28673321605489172, 0.28867591907940332,
+    0.29063178449609756, 0.29260090148410517, 0.29458335982677319, 0.2965792499157564,
+    0.29858866275514112, 0.30061168996559245, 0.30264842378853385, 0.30469895709035089,
+    0.3067633833666274, 0.30884179674640716, 0.31093429199648664, 0.31304096452573527,
+    0.31516191038944641, 0.31729722629371609, 0.31944700959985389, 0.3216113583288201,
+    0.32379037116569748, 0.32598414746418847, 0.32819278725114753, 0.33041639123113992,
+    0.33265506079103535, 0.3349088980046287, 0.33717800563729639, 0.33946248715067967,
+    0.34176244670740463, 0.34407798917582877, 0.34640922013482534, 0.34875624587859466,
+    0.35111917342151322, 0.35349811050301055, 0.35589316559248413, 0.35830444789424282,
+    0.36073206735248831, 0.36317613465632609, 0.36563676124481398, 0.36811405931204222,
+    0.37060814181225005, 0.37311912246497436, 0.37564711576023713, 0.37819223696376292,
+    0.38075460212223738, 0.38333432806859563, 0.38593153242735223, 0.38854633361996138,
+    0.39117885087021942, 0.39382920420969802, 0.3964975144832199, 0.39918390335436632,
+    0.4018884933110265, 0.40461140767098075, 0.40735277058752506, 0.41011270705513003,
+    0.41289134291514207, 0.41568880486151921, 0.41850522044660987, 0.42134071808696644,
+    0.42419542706920316, 0.42706947755588848, 0.42996300059148113, 0.43287612810830611,
+    0.43580899293256792, 0.43876172879040953, 0.44173447031400709, 0.44472735304771122,
+    0.44774051345422439, 0.45077408892082638, 0.4538282177656347, 0.45690303924391551,
+    0.45999869355442874, 0.46311532184582488, 0.46625306622307644, 0.46941206975396171,
+    0.47259247647558356, 0.47579443140094135, 0.47901808052553874, 0.48226357083404436,
+    0.48553105030698995, 0.48882066792752127, 0.49213257368818747, 0.4954669185977838,
+    0.49882385468823331, 0.50220353502152248, 0.50560611369667652, 0.50903174585678912,
+    0.51248058769609339, 0.51595279646708625, 0.51944853048769557, 0.52296794914850209,
+    0.52651121292000347, 0.53007848335993479, 0.533669923120631, 0.53728569595644693,
+    0.54092596673122029, 0.54459090142579192, 0.54828066714557111, 0.55199543212815727,
+    0.55573536575100846, 0.55950063853916687, 0.56329142217303119, 0.56710788949618784,
+    0.57095021452328787, 0.57481857244798573, 0.57871313965092297, 0.58263409370777475,
+    0.58658161339734194, 0.59055587870970772, 0.5945570708544391, 0.59858537226885455,
+    0.60264096662633715, 0.60672403884471438, 0.61083477509468498, 0.61497336280831161,
+    0.61913999068756298, 0.62333484871292233, 0.62755812815204459, 0.63181002156848276,
+    0.63609072283046286, 0.64040042711972822, 0.64473933094043456, 0.64910763212811384,
+    0.65350552985869126, 0.65793322465756821, 0.66239091840876707, 0.66687881436413265,
+    0.67139711715260342, 0.67594603278953824, 0.68052576868611314, 0.68513653365877492,
+    0.68977853793876609, 0.69445199318170614, 0.69915711247724688, 0.70389411035878391,
+    0.70866320281324247, 0.71346460729092176, 0.71829854271541338, 0.72316522949357986,
+    0.72806488952560766, 0.73299774621512104, 0.73796402447937282, 0.74296395075949495,
+    0.74799775303082783, 0.75306566081331039, 0.75816790518194987, 0.76330471877735351,
+    0.76847633581634001, 0.77368299210261471, 0.77892492503752564, 0.78420237363088341,
+    0.78951557851186371, 0.79486478193997423, 0.80025022781610555, 0.80567216169364686,
+    0.81113083078968751, 0.81662648399628368, 0.82215937189181199, 0.82772974675238953,
+    0.83333786256338227, 0.83898397503097988, 0.84466834159386028, 0.85039122143492274,
+    0.85615287549311059, 0.86195356647530319, 0.86779355886830079, 0.87367311895087718,
+    0.87959251480592726, 0.88555201633268465, 0.89155189525903367, 0.89759242515389293,
+    0.90367388143969518, 0.90979654140493937, 0.9159606842168394, 0.9221665909340474,
+    0.9284145445194748, 0.93470482985318804, 0.94103773374540378, 0.94741354494956054,
+    0.95383255417549051, 0.96029505410266869, 0.96680133939356372, 0.97335170670706717,
+    0.97994645471202635, 0.98658588410085579, 0.99327029760325392, 1,
+    1.0067752981368572, 1.0135965009385577, 1.0204639194228908, 1.0273778667148867,
+    1.0343386580610876, 1.0413466108439282, 1.0484020445962008, 1.0555052810156307,
+    1.062656643979538, 1.0698564595596116, 1.0771050560367696, 1.0844027639161349,
+    1.0917499159420978, 1.0991468471134944, 1.106593894698874, 1.1140913982518847,
+    1.1216396996267486, 1.1292391429938546, 1.1368900748554462, 1.1445928440614259,
+    1.1523478018252544, 1.1601553017399724, 1.1680156997943154, 1.1759293543889517,
+    1.1838966263528179, 1.1919178789595777, 1.1999934779441783, 1.2081237915195344,
+    1.2163091903933085, 1.2245500477848226, 1.2328467394420664, 1.2411996436588388,
+    1.2496091412919872, 1.2580756157787827, 1.2665994531543929, 1.2751810420694945,
+    1.2838207738079823, 1.2925190423048221, 1.3012762441640013, 1.3100927786766223,
+    1.318969047839099, 1.3279054563714956, 1.3369024117359709, 1.3459603241553655,
+    1.355079606631898, 1.3642606749660042, 1.3735039477752877, 1.3828098465136156,
+    1.3921787954903262, 1.4016112218895838, 1.4111075557898494, 1.4206682301834974,
+    1.4302936809965507, 1.4399843471085652, 1.4497406703726323, 1.4595630956355341,
+    1.4694520707580179, 1.4794080466352255, 1.4894314772172434, 1.4995228195298098,
+    1.509682533695144, 1.5199110829529345, 1.5302089336814528, 1.5405765554188271,
+    1.551014420884441, 1.5615230060004979, 1.5721027899137128, 1.5827542550171618,
+    1.593477886972281, 1.6042741747310074, 1.6151436105580708, 1.6260866900534416,
+    1.6371039121749262, 1.6481957792609268, 1.6593627970533291, 1.6706054747205745,
+    1.6819243248808697, 1.6933198636255697, 1.7047926105426956, 1.7163430887406335,
+    1.7279718248719826, 1.7396793491575795, 1.7514661954106558, 1.76333290106119,
+    1.775280007180406, 1.7873080585054553, 1.7994176034642371, 1.8116091942004164,
+    1.8238833865985928, 1.8362407403096592, 1.8486818187763006, 1.8612071892586972,
+    1.8738174228603839, 1.8865130945543005, 1.899294783208991, 1.9121630716150093,
+    1.9251185465114864, 1.9381617986128954, 1.9512934226359648, 1.9645140173268121,
+    1.9778241854882328, 1.9912245340072026, 2.0047156738825258, 2.0182982202527104,
+    2.0319727924240079, 2.0457400138986626, 2.0596005124033243, 2.0735549199176808,
+    2.0876038727032671, 2.1017480113324889, 2.1159879807178137, 2.130324430141183,
+    2.1447580132836168, 2.1592893882550266, 2.1739192176242064, 2.1886481684490535,
+    2.2034769123069791, 2.21840612532554, 2.2334364882132509, 2.2485686862906311,
+    2.2638034095214477, 2.2791413525441895, 2.2945832147037164, 2.310129700083162,
+    2.3257815175360301, 2.3415393807185292, 2.3574040081220891, 2.3733761231061385,
+    2.3894564539310768, 2.4056457337914976, 2.4219447008495933, 2.4383540982688308,
+    2.4548746742478293, 2.4715071820544749, 2.488252380060278, 2.5051110317749306,
+    2.5220839058811357, 2.5391717762696455, 2.556375422074566, 2.573695627708855,
+    2.5911331829001085, 2.6086888827265566, 2.6263635276533335, 2.6441579235689532,
+    2.6620728818220658, 2.6801092192584486, 2.6982677582582641, 2.7165493267735332,
+    2.7349547583659026, 2.7534848922446433, 2.7721405733049327, 2.7909226521663522,
+    2.8098319852116873, 2.8288694346259695, 2.8480358684358027, 2.8673321605489184,
+    2.8867591907940362, 2.9063178449609741, 2.9260090148410525, 2.9458335982677326,
+    2.9657924991575673, 2.9858866275514102, 3.0061168996559253, 3.0264842378853394,
+    3.0469895709035115, 3.0676338336662727, 3.0884179674640722, 3.1093429199648672,
+    3.1304096452573553, 3.1516191038944625, 3.1729722629371624, 3.1944700959985401,
+    3.2161135832882044, 3.2379037116569727, 3.259841474641886, 3.2819278725114769,
+    3.3041639123114033, 3.3265506079103524, 3.3490889800462886, 3.3717800563729652,
+    3.3946248715068008, 3.4176244670740448, 3.440779891758289, 3.4640922013482549,
+    3.4875624587859506, 3.5111917342151306, 3.534981105030107, 3.5589316559248432,
+    3.5830444789424329, 3.6073206735248817, 3.6317613465632612, 3.6563676124481415,
+    3.6811405931204266, 3.7060814181225048, 3.731191224649745, 3.7564711576023733,
+    3.7819223696376336, 3.8075460212223784, 3.8333432806859578, 3.8593153242735241,
+    3.8854633361996185, 3.9117885087021986, 3.9382920420969811, 3.9649751448322013,
+    3.9918390335436675, 4.0188849331102698, 4.0461140767098085, 4.0735277058752528,
+    4.1011270705513052, 4.1289134291514262, 4.156888048615194, 4.1850522044661007,
+    4.2134071808696687, 4.2419542706920366, 4.2706947755588827, 4.2996300059148131,
+    4.3287612810830618, 4.3580899293256836, 4.3876172879040931, 4.4173447031400723,
+    4.4472735304771129, 4.4774051345422503, 4.5077408892082609, 4.5382821776563489,
+    4.5690303924391555, 4.5999869355442931, 4.6311532184582465, 4.6625306622307665,
+    4.694120697539617, 4.7259247647558418, 4.7579443140094106, 4.7901808052553889,
+    4.822635708340445, 4.855310503069906, 4.8882066792752097, 4.9213257368818759,
+    4.9546691859778393, 4.9882385468823394, 5.0220353502152211, 5.0560611369667665,
+    5.0903174585678927, 5.1248058769609397, 5.1595279646708594, 5.1944853048769577,
+    5.2296794914850215, 5.2651121292000402, 5.3007848335993444, 5.3366992312063122,
+    5.3728569595644711, 5.4092596673122086, 5.4459090142579161, 5.4828066714557133,
+    5.519954321281574, 5.5573536575100899, 5.5950063853916658, 5.6329142217303145,
+    5.6710788949618793, 5.7095021452328849, 5.7481857244798649, 5.7871313965092321,
+    5.8263409370777479, 5.8658161339734258, 5.9055587870970845, 5.9455707085443938,
+    5.985853722688546, 6.0264096662633797, 6.0672403884471517, 6.1083477509468525,
+    6.1497336280831174, 6.1913999068756382, 6.2333484871292306, 6.2755812815204477,
+    6.3181002156848285, 6.3609072283046366, 6.4040042711972909, 6.4473933094043474,
+    6.4910763212811409, 6.535055298586915, 6.5793322465756896, 6.6239091840876672,
+    6.6687881436413283, 6.7139711715260368, 6.7594603278953898, 6.8052576868611299,
+    6.8513653365877518, 6.8977853793876625, 6.9445199318170694, 6.9915711247724666,
+    7.0389411035878409, 7.0866320281324269, 7.1346460729092254, 7.182985427154132,
+    7.2316522949358006, 7.2806488952560784, 7.3299774621512199, 7.3796402447937259,
+    7.42963950759495, 7.4799775303082807, 7.5306566081331141, 7.5816790518194948,
+    7.6330471877735384, 7.6847633581634023, 7.7368299210261569, 7.7892492503752546,
+    7.8420237363088372, 7.8951557851186385, 7.9486478193997518, 8.0025022781610531,
+    8.0567216169364713, 8.1113083078968771, 8.1662648399628477, 8.2215937189181183,
+    8.2772974675238995, 8.3333786256338254, 8.3898397503098092, 8.4466834159386011,
+    8.5039122143492314, 8.561528754931107, 8.6195356647530428, 8.6779355886830043,
+    8.7367311895087738, 8.7959251480592737, 8.8555201633268563, 8.9155189525903449,
+    8.9759242515389328, 9.0367388143969531, 9.0979654140494048, 9.1596068421684027,
+    9.2216659093404765, 9.2841454451947527, 9.3470482985318917, 9.4103773374540456,
+    9.4741354494956074, 9.5383255417549098, 9.6029505410266989, 9.668013393935647,
+    9.7335170670706734, 9.7994645471202677, 9.8658588410085688, 9.932702976032548,
+    10.000000000000002, 10.067752981368576, 10.135965009385579, 10.204639194228923,
+    10.273778667148861, 10.343386580610881, 10.413466108439286, 10.484020445962022,
+    10.555052810156301, 10.626566439795385, 10.698564595596117, 10.77105056036771,
+    10.844027639161343, 10.917499159420982, 10.991468471134946, 11.065938946988753,
+    11.140913982518841, 11.216396996267489, 11.292391429938554, 11.368900748554477,
+    11.445928440614249, 11.523478018252547, 11.601553017399732, 11.680156997943168,
+    11.759293543889509, 11.838966263528183, 11.919178789595785, 11.999934779441798,
+    12.081237915195334, 12.163091903933088, 12.245500477848232, 12.328467394420679,
+    12.411996436588378, 12.496091412919876, 12.580756157787834, 12.665994531543946,
+    12.751810420694934, 12.838207738079827, 12.925190423048228, 13.01276244164003,
+    13.100927786766212, 13.189690478390993, 13.279054563714963, 13.369024117359723,
+    13.459603241553667, 13.550796066318982, 13.642606749660048, 13.735039477752894,
+    13.82809846513617, 13.921787954903264, 14.016112218895843, 14.111075557898515,
+    14.206682301834986, 14.302936809965509, 14.399843471085658, 14.497406703726345,
+    14.595630956355352, 14.69452070758018, 14.794080466352261, 14.894314772172457,
+    14.995228195298113, 15.096825336951442, 15.199110829529351, 15.302089336814552,
+    15.405765554188283, 15.510144208844411, 15.615230060004984, 15.721027899137137,
+    15.82754255017163, 15.934778869722813, 16.042741747310082, 16.151436105580718,
+    16.26086690053442, 16.371039121749263, 16.481957792609272, 16.593627970533301,
+    16.706054747205755, 16.819243248808707, 16.933198636255703, 17.047926105426964,
+    17.163430887406346, 17.279718248719835, 17.396793491575799, 17.514661954106568,
+    17.633329010611913, 17.752800071804067, 17.873080585054556, 17.994176034642379,
+    18.116091942004179, 18.238833865985939, 18.362407403096597, 18.486818187763014,
+    18.612071892586986, 18.738174228603846, 18.865130945543008, 18.992947832089918,
+    19.121630716150108, 19.251185465114872, 19.381617986128955, 19.512934226359658,
+    19.645140173268135, 19.778241854882339, 19.91224534007203, 20.047156738825269,
+    20.182982202527121, 20.319727924240084, 20.457400138986639, 20.596005124033251,
+    20.735549199176823, 20.8760387270327, 21.017480113324904, 21.159879807178143,
+    21.303244301411844, 21.447580132836201, 21.592893882550278, 21.739192176242071,
+    21.886481684490551, 22.034769123069825, 22.184061253255415, 22.334364882132515,
+    22.485686862906324, 22.638034095214515, 22.791413525441904, 22.945832147037169,
+    23.101297000831636, 23.257815175360349, 23.415393807185303, 23.574040081220897,
+    23.733761231061397, 23.894564539310817, 24.056457337914985, 24.219447008495941,
+    24.38354098268832, 24.548746742478308, 24.715071820544761, 24.882523800602787,
+    25.05111031774932, 25.220839058811368, 25.391717762696469, 25.563754220745675,
+    25.736956277088566, 25.911331829001092, 26.086888827265572, 26.263635276533353,
+    26.441579235689542, 26.620728818220666, 26.801092192584498, 26.98267758258266,
+    27.165493267735346, 27.349547583659035, 27.534848922446443, 27.721405733049348,
+    27.909226521663534, 28.09831985211688, 28.288694346259703, 28.480358684358045,
+    28.673321605489196, 28.867591907940369, 29.063178449609747, 29.260090148410544,
+    29.458335982677337, 29.65792499157568, 29.858866275514107, 30.061168996559275,
+    30.264842378853405, 30.469895709035121, 30.676338336662734, 30.884179674640734,
+    31.0934291996487, 31.30409645257356, 31.516191038944633, 31.729722629371636,
+    31.944700959985422, 32.161135832882053, 32.379037116569798, 32.598414746418875,
+    32.819278725114792, 33.041639123114038, 33.265506079103588, 33.490889800462902,
+    33.717800563729675, 33.946248715068016, 34.176244670740516, 34.407798917582909,
+    34.640922013482573, 34.875624587859512, 35.111917342151379, 35.349811050301085,
+    35.589316559248452, 35.830444789424327, 36.073206735248888, 36.317613465632633,
+    36.563676124481439, 36.811405931204263, 37.060814181225055, 37.311912246497464,
+    37.564711576023747, 37.819223696376334, 38.075460212223788, 38.333432806859591,
+    38.593153242735262, 38.854633361996186, 39.117885087021996, 39.382920420969832,
+    39.649751448322029, 39.918390335436676, 40.188849331102709, 40.461140767098101,
+    40.735277058752544, 41.011270705513049, 41.289134291514266, 41.568880486151947,
+    41.850522044661027, 42.13407180869671, 42.419542706920367, 42.706947755588835,
+    42.996300059148147, 43.287612810830637, 43.580899293256849, 43.876172879040944,
+    44.173447031400748, 44.472735304771149, 44.7740513454225, 45.077408892082637,
+    45.38282177656351, 45.690303924391571, 45.999869355442932, 46.311532184582489,
+    46.62530662230769, 46.941206975396192, 47.259247647558418, 47.579443140094142,
+    47.90180805255391, 48.226357083404466, 48.553105030699058, 48.882066792752127,
+    49.21325736881878, 49.546691859778406, 49.882385468823394, 50.220353502152314,
+    50.560611369667683, 50.90317458567894, 51.248058769609422, 51.595279646708697,
+    51.944853048769588, 52.296794914850224, 52.651121292000425, 53.00784833599355,
+    53.366992312063132, 53.728569595644721, 54.09259667312211, 54.459090142579271,
+    54.828066714557167, 55.199543212815726, 55.573536575100924, 55.95006385391676,
+    56.329142217303186, 56.710788949618831, 57.095021452328872, 57.481857244798647,
+    57.871313965092362, 58.263409370777524, 58.658161339734285, 59.055587870970847,
+    59.455707085443976, 59.858537226885502, 60.264096662633804, 60.672403884471521,
+    61.083477509468558, 61.497336280831213, 61.913999068756397, 62.333484871292306,
+    62.755812815204521, 63.181002156848322, 63.60907228304638, 64.040042711972902,
+    64.473933094043517, 64.910763212811432, 65.350552985869172, 65.793322465756901,
+    66.239091840876711, 66.687881436413306, 67.139711715260376, 67.594603278953898,
+    68.052576868611325, 68.513653365877545, 68.977853793876648, 69.445199318170694,
+    69.915711247724687, 70.389411035878439, 70.866320281324292, 71.346460729092257,
+    71.82985427154135, 72.316522949358031, 72.806488952560798, 73.299774621512185,
+    73.796402447937282, 74.296395075949548, 74.799775303082825, 75.306566081331127,
+    75.816790518194992, 76.330471877735405, 76.847633581634042, 77.368299210261554,
+    77.892492503752706, 78.42023736308839, 78.951557851186408, 79.486478193997499,
+    80.025022781610687, 80.567216169364741, 81.113083078968785, 81.662648399628452,
+    82.215937189181332, 82.772974675238999, 83.333786256338257, 83.898397503098153,
+    84.466834159386181, 85.039122143492321, 85.615287549311077, 86.195356647530488,
+    86.779355886830217, 87.367311895087767, 87.959251480592755, 88.555201633268624,
+    89.155189525903509, 89.759242515389346, 90.367388143969549, 90.979654140494105,
+    91.596068421684095, 92.216659093404786, 92.841454451947513, 93.470482985318966,
+    94.103773374540523, 94.741354494956099, 95.38325541754908, 96.029505410267049,
+    96.680133939356523, 97.335170670706759, 97.994645471202659, 98.658588410085756,
+    99.327029760325544, 100.00000000000004, 100.67752981368584, 101.35965009385586,
+    102.04639194228915, 102.73778667148864, 103.43386580610888, 104.13466108439293,
+    104.84020445962015, 105.55052810156303, 106.26566439795393, 106.98564595596125,
+    107.71050560367702, 108.44027639161345, 109.1749915942099, 109.91468471134954,
+    110.65938946988746, 111.40913982518843, 112.16396996267497, 112.92391429938557,
+    113.68900748554479, 114.45928440614253, 115.23478018252555, 116.01553017399735,
+    116.8015699794317, 117.59293543889532, 118.38966263528191, 119.19178789595786,
+    119.999347794418, 120.81237915195358, 121.63091903933096, 122.45500477848235,
+    123.28467394420682, 124.11996436588403, 124.96091412919885, 125.80756157787836,
+    126.65994531543949, 127.5181042069497, 128.38207738079836, 129.25190423048232,
+    130.12762441640032, 131.00927786766249, 131.89690478391003, 132.79054563714965,
+    133.69024117359726, 134.59603241553683, 135.50796066318992, 136.42606749660052,
+    137.35039477752895, 138.28098465136185, 139.21787954903272, 140.16112218895847,
+    141.11075557898511, 142.06682301835002, 143.02936809965519, 143.99843471085663,
+    144.97406703726341, 145.9563095635537, 146.9452070758019, 147.94080466352264,
+    148.94314772172453, 149.95228195298128, 150.96825336951451, 151.99110829529354,
+    153.02089336814547, 154.05765554188301, 155.1014420884442, 156.15230060004987,
+    157.21027899137133, 158.27542550171648, 159.34778869722822, 160.42741747310083,
+    161.51436105580711, 162.60866900534432, 163.71039121749274, 164.81957792609276,
+    165.93627970533296, 167.06054747205764, 168.19243248808709, 169.33198636255707,
+    170.47926105426961, 171.63430887406352, 172.7971824871984, 173.96793491575804,
+    175.14661954106563, 176.33329010611919, 177.52800071804072, 178.73080585054561,
+    179.94176034642376, 181.16091942004181, 182.38833865985973, 183.624074030966,
+    184.86818187763009, 186.12071892586991, 187.38174228603884, 188.65130945543012,
+    189.92947832089914, 191.21630716150113, 192.51185465114912, 193.81617986128958,
+    195.12934226359653, 196.45140173268138, 197.78241854882376, 199.12245340072033,
+    200.47156738825262, 201.82982202527123, 203.19727924240124, 204.57400138986634,
+    205.96005124033249, 207.35549199176825, 208.76038727032716, 210.17480113324899,
+    211.59879807178137, 213.03244301411848, 214.47580132836214, 215.92893882550271,
+    217.39192176242065, 218.86481684490556, 220.34769123069839, 221.84061253255408,
+    223.3436488213251, 224.85686862906329, 226.38034095214527, 227.91413525441899,
+    229.45832147037163, 231.01297000831639, 232.57815175360355, 234.15393807185296,
+    235.74040081220892, 237.33761231061402, 238.94564539310821, 240.56457337914981,
+    242.19447008495936, 243.83540982688328, 245.48746742478312, 247.15071820544756,
+    248.8252380060278, 250.51110317749325, 252.20839058811373, 253.91717762696462,
+    255.63754220745682, 257.36956277088569, 259.11331829001097, 260.86888827265568,
+    262.63635276533358, 264.41579235689545, 266.2072881822067, 268.01092192584491,
+    269.82677582582664, 271.65493267735349, 273.4954758365904, 275.34848922446463,
+    277.21405733049352, 279.09226521663538, 280.98319852116884, 282.88694346259774,
+    284.80358684358055, 286.73321605489201, 288.67591907940374, 290.63178449609819,
+    292.60090148410552, 294.58335982677346, 296.57924991575686, 298.5886627551418,
+    300.6116899655928, 302.6484237885341, 304.69895709035131, 306.76338336662809,
+    308.84179674640768, 310.93429199648693, 313.04096452573566, 315.16191038944709,
+    317.29722629371673, 319.44700959985414, 321.61135832882059, 323.79037116569816,
+    325.98414746418911, 328.19278725114782, 330.41639123114044, 332.65506079103614,
+    334.90889800462935, 337.17800563729668, 339.4624871506802, 341.76244670740539,
+    344.07798917582943, 346.4092201348256, 348.75624587859522, 351.11917342151401,
+    353.49811050301128, 355.89316559248448, 358.30444789424337, 360.73206735248914,
+    363.17613465632672, 365.63676124481429, 368.11405931204274, 370.60814181225084,
+    373.11912246497508, 375.6471157602374, 378.19223696376343, 380.75460212223817,
+    383.33432806859634, 385.93153242735252, 388.5463336199619, 391.17885087022023,
+    393.82920420969873, 396.49751448322024, 399.18390335436681, 401.88849331102733,
+    404.61140767098146, 407.35277058752536, 410.11270705513056, 412.89134291514296,
+    415.68880486151994, 418.50522044661051, 421.340718086967, 424.19542706920402,
+    427.06947755588925, 429.96300059148177, 432.87612810830632, 435.80899293256874,
+    438.7617287904103, 441.73447031400775, 444.7273530477114, 447.74051345422527,
+    450.77408892082713, 453.82821776563537, 456.90303924391566, 459.99869355442962,
+    463.11532184582563, 466.25306622307716, 469.41206975396182, 472.59247647558448,
+    475.79443140094213, 479.01808052553946, 482.26357083404451, 485.53105030699089,
+    488.82066792752204, 492.13257368818813, 495.46691859778394, 498.82385468823423,
+    502.20353502152324, 505.60611369667714, 509.03174585678931, 512.48058769609429,
+    515.95279646708707, 519.44853048769619, 522.96794914850216, 526.51121292000437,
+    530.0784833599356, 533.66992312063167, 537.28569595644706, 540.92596673122114,
+    544.59090142579282, 548.28066714557178, 551.9954321281574, 555.73536575100934,
+    559.50063853916777, 563.29142217303195, 567.10788949618848, 570.95021452328888,
+    574.81857244798664, 578.71313965092372, 582.63409370777538, 586.58161339734295,
+    590.55587870970862, 594.55707085443987, 598.58537226885517, 602.64096662633824,
+    606.72403884471532, 610.83477509468571, 614.97336280831223, 619.13999068756414,
+    623.33484871292319, 627.55812815204536, 631.81002156848342, 636.09072283046453,
+    640.40042711972922, 644.73933094043537, 649.10763212811446, 653.5055298586924,
+    657.9332246575691, 662.39091840876847, 666.87881436413318, 671.39711715260455,
+    675.94603278953912, 680.52576868611459, 685.13653365877565, 689.77853793876716,
+    694.45199318170705, 699.15711247724835, 703.89411035878447, 708.66320281324363,
+    713.46460729092269, 718.2985427154149, 723.16522949358045, 728.06488952560881,
+    732.99774621512199, 737.9640244793743, 742.96395075949567, 747.99775303082902,
+    753.06566081331141, 758.16790518195148, 763.3047187773542, 768.47633581634125,
+    773.68299210261569, 778.92492503752715, 784.20237363088404, 789.51557851186487,
+    794.86478193997527, 800.2502278161071, 805.67216169364758, 811.13083078968873,
+    816.62648399628472, 822.15937189181352, 827.72974675239027, 833.33786256338351,
+    838.9839750309817, 844.6683415938619, 850.39122143492341, 856.15287549311176,
+    861.95356647530502, 867.7935588683024, 873.67311895087778, 879.59251480592854,
+    885.55201633268643, 891.55189525903529, 897.5924251538936, 903.67388143969652,
+    909.79654140494119, 915.96068421684106, 922.16659093404814, 928.41454451947618,
+    934.70482985318995, 941.03773374540629, 947.41354494956113, 953.83255417549185,
+    960.29505410267063, 966.80133939356631, 973.35170670706782, 979.94645471202773,
+    986.5858841008577, 993.27029760325661, 1000.0000000000007, 1006.7752981368585,
+  };
 } // namespace mopo
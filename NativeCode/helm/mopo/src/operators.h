@@ -711,7 +711,9 @@ namespace mopo {
     // A processor that will square root and scale a signal
     class Root : public Operator {
       public:
-        Root(mopo_float offset) : Operator(1, 1, true), offset_(offset) { }
+        Root(mopo_float offset) : Operator(1, 1, true), offset_(offset) {
+          setLazy();
+        }
         virtual Processor* clone() const override { return new Root(*this); }
 
         void process() override {
@@ -734,7 +736,9 @@ namespace mopo {
     class ExponentialScale : public Operator {
       public:
         ExponentialScale(mopo_float scale = 1, mopo_float offset = 0.0) :
-            Operator(1, 1, true), scale_(scale), offset_(offset) { }
+            Operator(1, 1, true), scale_(scale), offset_(offset) {
+          setLazy();
+        }
 
         virtual Processor* clone() const override {
           return new ExponentialScale(*this);
@@ -810,7 +814,9 @@ namespace mopo {
 
     class FrequencyToSamples : public Operator {
       public:
-        FrequencyToSamples() : Operator(1, 1, true) { }
+        FrequencyToSamples() : Operator(1, 1, true) {
+          setLazy();
+        }
 
         virtual Processor* clone() const override {
           return new FrequencyToSamples(*this);
@@ -854,7 +860,9 @@ namespace mopo {
     // magnitudes.
     class MagnitudeScale : public Operator {
       public:
-        MagnitudeScale() : Operator(1, 1, true) { }
+        MagnitudeScale() : Operator(1, 1, true) {
+          setLazy();
+        }
 
         virtual Processor* clone() const override {
           return new MagnitudeScale(*this);
@@ -876,7 +884,9 @@ namespace mopo {
     // A processor that will convert a stream of midi to a stream of frequencies.
     class MidiScale : public Operator {
       public:
-        MidiScale() : Operator(1, 1, true) { }
+        MidiScale() : Operator(1, 1, true) {
+          setLazy();
+        }
 
         virtual Processor* clone() const override {
           return new MidiScale(*this);
@@ -899,7 +909,9 @@ namespace mopo {
     // q resonance values.
     class ResonanceScale : public Operator {
       public:
-        ResonanceScale() : Operator(1, 1, true) { }
+        ResonanceScale() : Operator(1, 1, true) {
+          setLazy();
+        }
 
         virtual Processor* clone() const override {
           return new ResonanceScale(*this);
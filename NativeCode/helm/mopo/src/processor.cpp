@@ -26,9 +26,9 @@ namespace mopo {
   Processor::Processor(int num_inputs, int num_outputs, bool control_rate) :
       sample_rate_(DEFAULT_SAMPLE_RATE), buffer_size_(DEFAULT_BUFFER_SIZE),
       samples_to_process_(DEFAULT_BUFFER_SIZE),
-      control_rate_(control_rate), enabled_(new bool(true)),
+      control_rate_(control_rate), enabled_(new bool(true)), lazy_state_(0),
       inputs_(new std::vector<Input*>()), outputs_(new std::vector<Output*>()),
-      router_(0) {
+      shared_inputs_(0), shared_outputs_(0), shared_lazy_state_(0), router_(0) {
         
     setControlRate(control_rate);
     for (int i = 0; i < num_inputs; ++i)
@@ -48,6 +48,58 @@ namespace mopo {
     delete inputs_;
     delete outputs_;
     delete enabled_;
+    delete lazy_state_;
+  }
+
+  void Processor::setLazy() {
+    if (lazy_state_ == 0)
+      lazy_state_ = new LazyState(inputs_, outputs_);
+  }
+
+  void Processor::separate(const OutputMap& outputs) {
+    MOPO_ASSERT(!separated());
+    shared_inputs_ = inputs_;
+    shared_outputs_ = outputs_;
+    shared_lazy_state_ = lazy_state_;
+
+    inputs_ = new std::vector<Input*>();
+    for (const Input* input : *shared_inputs_) {
+      Input* separate_input = 0;
+      if (input) {
+        separate_input = new Input();
+        OutputMap::const_iterator copy = outputs.find(input->source);
+        separate_input->source = copy == outputs.end() ? input->source : copy->second;
+      }
+      inputs_->push_back(separate_input);
+    }
+
+    outputs_ = new std::vector<Output*>();
+    for (Output* output : *shared_outputs_) {
+      OutputMap::const_iterator copy = outputs.find(output);
+      outputs_->push_back(copy == outputs.end() ? output : copy->second);
+    }
+
+    if (shared_lazy_state_)
+      lazy_state_ = new LazyState(inputs_, outputs_);
+  }
+
+  void Processor::rejoin() {
+    if (!separated())
+      return;
+
+    for (Input* input : *inputs_)
+      delete input;
+    delete inputs_;
+    delete outputs_;
+    if (shared_lazy_state_)
+      delete lazy_state_;
+
+    inputs_ = shared_inputs_;
+    outputs_ = shared_outputs_;
+    lazy_state_ = shared_lazy_state_;
+    shared_inputs_ = 0;
+    shared_outputs_ = 0;
+    shared_lazy_state_ = 0;
   }
 
   bool Processor::inputMatchesBufferSize(int input) {
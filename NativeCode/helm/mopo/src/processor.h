@@ -21,12 +21,17 @@
 #include "common.h"
 
 #include <cstring>
+#include <map>
 #include <vector>
 
 namespace mopo {
 
   class Processor;
   class ProcessorRouter;
+  struct Output;
+
+  // Outputs of a graph mapped to copies of them.
+  typedef std::map<const Output*, Output*> OutputMap;
 
   // An output port from the Processor.
   struct Output {
@@ -88,6 +93,60 @@ namespace mopo {
     };
   } // namespace cr
 
+  // The first samples a lazy Processor last read from its inputs and wrote to
+  // its outputs. Clones share it like they share their outputs, so while all
+  // of those samples are unchanged processing again would write the same values.
+  class LazyState {
+    public:
+      LazyState(const std::vector<Input*>* inputs,
+                const std::vector<Output*>* outputs) :
+          inputs_(inputs), outputs_(outputs), valid_(false) { }
+
+      inline bool unchanged() const {
+        size_t num_inputs = inputs_->size();
+        size_t num_outputs = outputs_->size();
+        if (!valid_ || input_values_.size() != num_inputs)
+          return false;
+
+        for (size_t i = 0; i < num_inputs; ++i) {
+          if (!same((*inputs_)[i]->source->buffer[0], input_values_[i]))
+            return false;
+        }
+        for (size_t i = 0; i < num_outputs; ++i) {
+          if (!same((*outputs_)[i]->buffer[0], output_values_[i]))
+            return false;
+        }
+        return true;
+      }
+
+      void update() {
+        size_t num_inputs = inputs_->size();
+        size_t num_outputs = outputs_->size();
+        input_values_.resize(num_inputs);
+        output_values_.resize(num_outputs);
+
+        for (size_t i = 0; i < num_inputs; ++i)
+          input_values_[i] = (*inputs_)[i]->source->buffer[0];
+        for (size_t i = 0; i < num_outputs; ++i)
+          output_values_[i] = (*outputs_)[i]->buffer[0];
+        valid_ = true;
+      }
+
+      void reset() { valid_ = false; }
+
+    private:
+      // Compares bits so -0 and 0 differ and a NaN matches itself.
+      static inline bool same(mopo_float a, mopo_float b) {
+        return memcmp(&a, &b, sizeof(mopo_float)) == 0;
+      }
+
+      const std::vector<Input*>* inputs_;
+      const std::vector<Output*>* outputs_;
+      std::vector<mopo_float> input_values_;
+      std::vector<mopo_float> output_values_;
+      bool valid_;
+  };
+
   class Processor {
     public:
       Processor(int num_inputs, int num_outputs, bool control_rate = false);
@@ -108,6 +167,8 @@ namespace mopo {
       // sample rate.
       virtual void setSampleRate(int sample_rate) {
         sample_rate_ = sample_rate;
+        if (lazy_state_)
+          lazy_state_->reset();
       }
 
       virtual void setBufferSize(int buffer_size) {
@@ -132,6 +193,16 @@ namespace mopo {
         *enabled_ = enable;
       }
 
+      // Shared by every clone, so a router can keep it and check it without this Processor.
+      inline const bool* enabledFlag() const {
+        return enabled_;
+      }
+
+      // Null unless this Processor is lazy. Shared by every clone like enabledFlag().
+      inline LazyState* lazyState() const {
+        return lazy_state_;
+      }
+
       int getSampleRate() const {
         return sample_rate_;
       }
@@ -150,6 +221,40 @@ namespace mopo {
 
       bool inputMatchesBufferSize(int input = 0);
 
+      // Voice batching. A batchable Processor can render the clones of several
+      // voices in one pass. Voice handlers then call _prepareBatch_ on each
+      // voice's clone instead of _process_, which reads the inputs and returns
+      // false if that clone had to process alone. _processBatch_ is then called
+      // once with the clones that returned true and may only write their output
+      // buffers. Voices run one at a time for any block _shouldBatch_ is false.
+      // Control rate Processors like Envelope, and ones that already vectorize
+      // over samples like LinearSmoothBuffer, have too little work to batch.
+      virtual bool batchable() const { return false; }
+      virtual bool shouldBatch() const { return true; }
+      virtual bool prepareBatch() {
+        process();
+        return false;
+      }
+      virtual void processBatch(Processor* const* clones, int num_clones) { }
+
+      // True if output buffers can point at an input's buffer instead of
+      // their own.
+      virtual bool aliasesInputs() const { return false; }
+
+      // Parallel voices. _separate_ moves this clone to Inputs, Outputs and
+      // lazy state of its own so it can run alongside its other clones. Each
+      // Output in _outputs_ is swapped for its copy, and each Input reads the
+      // copy of its source if there is one. _rejoin_ goes back to the ones
+      // shared with the other clones. Never called on the original.
+      virtual void separate(const OutputMap& outputs);
+      virtual void rejoin();
+      bool separated() const { return shared_inputs_ != 0; }
+
+      // Adds this Processor, and for routers everything they hold, to _processors_.
+      virtual void collectProcessors(std::vector<const Processor*>* processors) const {
+        processors->push_back(this);
+      }
+
       virtual bool isPolyphonic() const;
 
       // Attaches an output to an input in this processor.
@@ -214,12 +319,19 @@ namespace mopo {
     protected:
       Output* addOutput();
       Input* addInput();
+
+      // Lets routers skip process() while the first samples of the inputs and
+      // outputs are what they were after the last run. Only for Processors whose
+      // outputs depend on nothing but those input samples and the sample rate,
+      // and only worth it when process() costs more than comparing them.
+      void setLazy();
     
       int sample_rate_;
       int buffer_size_;
       int samples_to_process_;
       bool control_rate_;
       bool* enabled_;
+      LazyState* lazy_state_;
 
       std::vector<Input*> owned_inputs_;
       std::vector<Output*> owned_outputs_;
@@ -227,6 +339,11 @@ namespace mopo {
       std::vector<Input*>* inputs_;
       std::vector<Output*>* outputs_;
 
+      // What _separate_ swapped out, null unless separated.
+      std::vector<Input*>* shared_inputs_;
+      std::vector<Output*>* shared_outputs_;
+      LazyState* shared_lazy_state_;
+
       ProcessorRouter* router_;
 
       static const Output null_source_;
@@ -19,22 +19,42 @@
 #include "feedback.h"
 
 #include <algorithm>
+#include <set>
 #include <vector>
 
 namespace mopo {
 
+  namespace {
+    // Adds _output_ and every buffer it could be pointing at to _outputs_.
+    void addAliases(const Output* output, std::set<const Output*>* outputs) {
+      if (!outputs->insert(output).second)
+        return;
+
+      const Processor* owner = output->owner;
+      if (owner == nullptr || !owner->aliasesInputs())
+        return;
+
+      for (int i = 0; i < owner->numInputs(); ++i) {
+        const Input* input = owner->input(i);
+        if (input && input->source)
+          addAliases(input->source, outputs);
+      }
+    }
+  } // namespace
+
   ProcessorRouter::ProcessorRouter(int num_inputs, int num_outputs) :
       Processor(num_inputs, num_outputs),
       global_order_(new std::vector<const Processor*>()),
       global_feedback_order_(new std::vector<const Feedback*>()),
-      global_changes_(new int(0)), local_changes_(0) {
+      global_changes_(new int(0)), local_changes_(0), topology_changes_(0) {
   }
 
   ProcessorRouter::ProcessorRouter(const ProcessorRouter& original) :
       Processor(original), global_order_(original.global_order_),
       global_feedback_order_(original.global_feedback_order_),
       global_changes_(original.global_changes_),
-      local_changes_(original.local_changes_) {
+      local_changes_(original.local_changes_),
+      topology_changes_(original.topology_changes_) {
     local_order_.assign(global_order_->size(), 0);
     local_feedback_order_.assign(global_feedback_order_->size(), 0);
 
@@ -45,6 +65,7 @@ namespace mopo {
       local_order_[i] = clone;
       processors_[next] = clone;
     }
+    rebuildSchedule();
 
     size_t num_feedbacks = global_feedback_order_->size();
     for (size_t i = 0; i < num_feedbacks; ++i) {
@@ -69,26 +90,56 @@ namespace mopo {
 
   void ProcessorRouter::process() {
     updateAllProcessors();
+    refreshFeedback();
+    processSteps(0, schedule_.size());
+    storeFeedback();
+
+    MOPO_ASSERT(schedule_.size() != 0);
+  }
+
+  void ProcessorRouter::processHead(int step) {
+    updateAllProcessors();
+    refreshFeedback();
+    processSteps(0, step);
+  }
+
+  void ProcessorRouter::processTail(int step) {
+    processSteps(step + 1, schedule_.size());
+    storeFeedback();
+  }
+
+  void ProcessorRouter::topologyChanged() {
+    for (ProcessorRouter* router = this; router; router = router->router_)
+      router->topology_changes_++;
+  }
+
+  inline void ProcessorRouter::processSteps(int start, int end) {
+    const Step* steps = schedule_.data();
+    for (int i = start; i < end; ++i) {
+      const Step& step = steps[i];
+      if (!*step.enabled || (step.lazy && step.lazy->unchanged()))
+        continue;
+
+      step.processor->process();
+      if (step.lazy)
+        step.lazy->update();
+    }
+  }
 
-    // First make sure all the Feedback loops are ready to be read.
+  inline void ProcessorRouter::refreshFeedback() {
+    // Make sure all the Feedback loops are ready to be read.
     int num_feedbacks = local_feedback_order_.size();
     for (int i = 0; i < num_feedbacks; ++i)
       local_feedback_order_[i]->refreshOutput();
+  }
 
-    // Run all the main processors.
-    int num_processors = local_order_.size();
-    for (int i = 0; i < num_processors; ++i) {
-      if (local_order_[i]->enabled())
-        local_order_[i]->process();
-    }
-
+  inline void ProcessorRouter::storeFeedback() {
     // Store the outputs into the Feedback objects for next time.
+    int num_feedbacks = local_feedback_order_.size();
     for (int i = 0; i < num_feedbacks; ++i) {
       if (global_feedback_order_->at(i)->enabled())
         local_feedback_order_[i]->process();
     }
-
-    MOPO_ASSERT(num_processors != 0);
   }
 
   void ProcessorRouter::destroy() {
@@ -134,12 +185,26 @@ namespace mopo {
 
     processor->router(this);
     processor->setBufferSize(getBufferSize());
-    global_order_->push_back(processor);
+
+    // Run as early as the inputs allow. Processors plugged into _processor_
+    // before it was added then already come after it.
+    int index = 0;
+    for (int i = 0; i < processor->numInputs(); ++i) {
+      const Output* source = processor->input(i)->source;
+      if (source && source->owner)
+        index = std::max(index, getOrderIndex(getContext(source->owner)) + 1);
+    }
+
+    global_order_->insert(global_order_->begin() + index, processor);
+    for (int i = index; i < global_order_->size(); ++i)
+      order_index_[global_order_->at(i)] = i;
     processors_[processor] = processor;
     local_order_.push_back(processor);
+    rebuildSchedule();
 
     for (int i = 0; i < processor->numInputs(); ++i)
       connect(processor, processor->input(i)->source, i);
+    topologyChanged();
   }
 
   void ProcessorRouter::addIdleProcessor(Processor *processor) {
@@ -156,14 +221,19 @@ namespace mopo {
     std::vector<const Processor*>::iterator pos =
         std::find(global_order_->begin(), global_order_->end(), processor);
     MOPO_ASSERT(pos != global_order_->end());
-    global_order_->erase(pos, pos + 1);
+    pos = global_order_->erase(pos, pos + 1);
+    order_index_.erase(processor);
+    for (; pos != global_order_->end(); ++pos)
+      order_index_[*pos]--;
 
     std::vector<Processor*>::iterator local_pos =
         std::find(local_order_.begin(), local_order_.end(), processor);
     MOPO_ASSERT(local_pos != local_order_.end());
     local_order_.erase(local_pos, local_pos + 1);
+    rebuildSchedule();
 
     processors_.erase(processor);
+    topologyChanged();
   }
 
   void ProcessorRouter::connect(Processor* destination,
@@ -181,8 +251,9 @@ namespace mopo {
     }
     else {
       // Not introducing a cycle so just make sure _destination_ is in order.
-      reorder(destination);
+      reorder(destination, source->owner);
     }
+    topologyChanged();
   }
 
   void ProcessorRouter::disconnect(const Processor* destination,
@@ -200,52 +271,105 @@ namespace mopo {
         }
       }
     }
+    topologyChanged();
   }
 
-  void ProcessorRouter::reorder(Processor* processor) {
-    (*global_changes_)++;
-    local_changes_++;
-
-    // Get all the dependencies inside this router.
-    std::set<const Processor*> dependencies = getDependencies(processor);
-
-    // Stably reorder putting dependencies first.
-    std::vector<const Processor*> new_order;
-    new_order.reserve(global_order_->size());
-    int num_processors = processors_.size();
+  void ProcessorRouter::reorder(const Processor* destination,
+                                const Processor* source) {
+    // Everything ordered before _destination_ can stay where it is. Only the
+    // dependencies of _source_ between the two have to move in front of it.
+    int start = getOrderIndex(getContext(destination));
+    int end = getOrderIndex(getContext(source));
 
-    // First put the dependencies.
-    for (int i = 0; i < num_processors; ++i) {
-      if (global_order_->at(i) != processor &&
-          dependencies.find(global_order_->at(i)) != dependencies.end()) {
-        new_order.push_back(global_order_->at(i));
-      }
+    if (start >= 0 && end > start && moveDependencies(source, start, end)) {
+      (*global_changes_)++;
+      local_changes_++;
     }
 
-    // Then the processor if it is in this router.
-    if (processors_.find(processor) != processors_.end())
-      new_order.push_back(processor);
+    // Make sure our parent is ordered as well.
+    if (router_)
+      router_->reorder(destination, source);
+  }
 
-    // Then the remaining processors.
-    for (int i = 0; i < num_processors; ++i) {
-      if (global_order_->at(i) != processor &&
-          dependencies.find(global_order_->at(i)) == dependencies.end()) {
-        new_order.push_back(global_order_->at(i));
+  bool ProcessorRouter::moveDependencies(const Processor* source,
+                                         int start, int end) {
+    std::vector<bool> moving(end - start + 1, false);
+    std::vector<const Processor*> inputs;
+    std::set<const Processor*> visited;
+
+    inputs.push_back(source);
+    visited.insert(source);
+    while (!inputs.empty()) {
+      const Processor* next = inputs.back();
+      inputs.pop_back();
+
+      // Processors outside this router or already before _start_ are fine.
+      int index = getOrderIndex(getContext(next));
+      if (index < start || index > end)
+        continue;
+      if (index == start)
+        return false;
+
+      moving[index - start] = true;
+      for (int i = 0; i < next->numInputs(); ++i) {
+        const Input* input = next->input(i);
+        if (input->source && input->source->owner &&
+            visited.insert(input->source->owner).second) {
+          inputs.push_back(input->source->owner);
+        }
       }
     }
 
-    MOPO_ASSERT(new_order.size() == processors_.size());
-    (*global_order_) = new_order;
+    // Stably put the dependencies first, then the rest of the range.
+    std::vector<const Processor*> range(global_order_->begin() + start,
+                                        global_order_->begin() + end + 1);
+    int index = start;
+    for (size_t i = 0; i < range.size(); ++i) {
+      if (moving[i])
+        global_order_->at(index++) = range[i];
+    }
+    for (size_t i = 0; i < range.size(); ++i) {
+      if (!moving[i])
+        global_order_->at(index++) = range[i];
+    }
 
-    // Make sure our parent is ordered as well.
-    if (router_)
-      router_->reorder(processor);
+    for (int i = start; i <= end; ++i)
+      order_index_[global_order_->at(i)] = i;
+    return true;
   }
 
   bool ProcessorRouter::isDownstream(const Processor* first,
                                      const Processor* second) const {
-    std::set<const Processor*> dependencies = getDependencies(second);
-    return dependencies.find(first) != dependencies.end();
+    // Only Processors in this router can be dependencies and our own context
+    // doesn't count.
+    if (processors_.find(first) == processors_.end() ||
+        getContext(second) == first) {
+      return false;
+    }
+
+    std::vector<const Processor*> inputs;
+    std::set<const Processor*> visited;
+
+    inputs.push_back(second);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      // If _inputs[i]_ has an ancestor in this context, then it is a
+      // dependency. If it is outside this router context, we don't need to
+      // check its inputs.
+      const Processor* dependency = getContext(inputs[i]);
+      if (dependency == first)
+        return true;
+
+      if (dependency) {
+        for (int j = 0; j < inputs[i]->numInputs(); ++j) {
+          const Input* input = inputs[i]->input(j);
+          if (input->source && input->source->owner &&
+              visited.insert(input->source->owner).second) {
+            inputs.push_back(input->source->owner);
+          }
+        }
+      }
+    }
+    return false;
   }
 
   bool ProcessorRouter::areOrdered(const Processor* first,
@@ -284,6 +408,149 @@ namespace mopo {
     return this;
   }
 
+  void ProcessorRouter::collectProcessors(
+      std::vector<const Processor*>* processors) const {
+    Processor::collectProcessors(processors);
+    for (const Processor* processor : *global_order_)
+      processor->collectProcessors(processors);
+    for (const Feedback* feedback : *global_feedback_order_)
+      feedback->collectProcessors(processors);
+  }
+
+  void ProcessorRouter::separate(const OutputMap& outputs) {
+    updateAllProcessors();
+    Processor::separate(outputs);
+
+    for (Processor* processor : local_order_)
+      processor->separate(outputs);
+    for (Feedback* feedback : local_feedback_order_)
+      feedback->separate(outputs);
+    rebuildSchedule();
+  }
+
+  void ProcessorRouter::rejoin() {
+    Processor::rejoin();
+
+    for (auto& processor : processors_)
+      processor.second->rejoin();
+    for (auto& feedback : feedback_processors_)
+      feedback.second->rejoin();
+    rebuildSchedule();
+  }
+
+  int ProcessorRouter::getBatchSplit(
+      std::vector<Output*>* live, std::set<const Output*>* pinned,
+      const std::vector<const Output*>& read_each,
+      const std::vector<const Output*>& read_last) const {
+    live->clear();
+    pinned->clear();
+
+    int split = -1;
+    int num_processors = global_order_->size();
+    for (int i = 0; i < num_processors && split < 0; ++i) {
+      if (global_order_->at(i)->batchable())
+        split = i;
+    }
+    if (split < 0)
+      return split;
+
+    std::vector<const Processor*> processors;
+    for (const Processor* processor : *global_order_)
+      processor->collectProcessors(&processors);
+
+    // The batched step reads what the steps before it wrote once every voice
+    // has run them, and the steps after it read what it wrote. Both have to
+    // be kept for each voice. Our own Feedback nodes are stored after the
+    // last step. Nothing up to the batched step may read what is written
+    // after it, that would be the previous voice's value when run in order.
+    std::set<const Output*> outputs;
+    std::set<const Output*> shared;
+    for (const Processor* processor : processors) {
+      int index = getOrderIndex(getContext(processor));
+      if (index < 0)
+        continue;
+
+      if (processor->aliasesInputs()) {
+        for (int i = 0; i < processor->numOutputs(); ++i)
+          shared.insert(processor->output(i));
+      }
+
+      for (int i = 0; i < processor->numInputs(); ++i) {
+        const Input* input = processor->input(i);
+        if (input == nullptr || input->source == nullptr)
+          continue;
+
+        std::set<const Output*> sources;
+        addAliases(input->source, &sources);
+        if (processor->aliasesInputs())
+          shared.insert(sources.begin(), sources.end());
+
+        for (const Output* source : sources) {
+          int source_index = getWriteIndex(source);
+          if (index <= split && source_index > split)
+            return -1;
+          if (index < split && readsAhead(processor, source))
+            shared.insert(source);
+          if (source_index >= 0 && index >= split &&
+              (index > split || source_index < split))
+            outputs.insert(source);
+        }
+      }
+    }
+
+    for (const Feedback* feedback : *global_feedback_order_)
+      addAliases(feedback->input()->source, &outputs);
+
+    for (const Output* output : read_each)
+      addAliases(output, &outputs);
+
+    for (const Output* output : read_last)
+      addAliases(output, &shared);
+
+    const Processor* batched = global_order_->at(split);
+    for (int i = 0; i < batched->numOutputs(); ++i)
+      outputs.insert(batched->output(i));
+
+    for (const Output* output : outputs) {
+      int index = getWriteIndex(output);
+      if (index < 0 || index > split)
+        continue;
+
+      live->push_back(const_cast<Output*>(output));
+      if (shared.count(output))
+        pinned->insert(output);
+    }
+
+    std::stable_sort(live->begin(), live->end(),
+                     [this](const Output* a, const Output* b) {
+      return getWriteIndex(a) < getWriteIndex(b);
+    });
+    return split;
+  }
+
+  bool ProcessorRouter::readsAhead(const Processor* processor,
+                                   const Output* source) const {
+    if (source->owner == nullptr)
+      return false;
+
+    // Compare the two in the innermost router holding both of them.
+    std::set<const ProcessorRouter*> routers;
+    for (const ProcessorRouter* router = processor->router(); router;
+         router = router->router()) {
+      routers.insert(router);
+    }
+
+    const ProcessorRouter* router = source->owner->router();
+    while (router && routers.count(router) == 0)
+      router = router->router();
+    if (router == nullptr)
+      return false;
+
+    int source_index = router->getOrderIndex(router->getContext(source->owner));
+    int index = router->getOrderIndex(router->getContext(processor));
+    return source_index >= 0 && source_index >= index;
+  }
+
   void ProcessorRouter::addFeedback(Feedback* feedback) {
     feedback->router(this);
     global_feedback_order_->push_back(feedback);
@@ -331,6 +598,16 @@ namespace mopo {
     }
 
     local_changes_ = *global_changes_;
+    rebuildSchedule();
+  }
+
+  void ProcessorRouter::rebuildSchedule() {
+    schedule_.resize(local_order_.size());
+    for (size_t i = 0; i < local_order_.size(); ++i) {
+      schedule_[i].processor = local_order_[i];
+      schedule_[i].enabled = local_order_[i]->enabledFlag();
+      schedule_[i].lazy = local_order_[i]->lazyState();
+    }
   }
 
   const Processor* ProcessorRouter::getContext(const Processor* processor)
@@ -342,38 +619,18 @@ namespace mopo {
     return context;
   }
 
-  std::set<const Processor*> ProcessorRouter::getDependencies(
-      const Processor* processor) const {
-    std::vector<const Processor*> inputs;
-    std::set<const Processor*> visited;
-    std::set<const Processor*> dependencies;
-    const Processor* context = getContext(processor);
-
-    inputs.push_back(processor);
-    for (size_t i = 0; i < inputs.size(); ++i) {
-      // Find the parent that is inside this router.
-      const Processor* dependency = getContext(inputs[i]);
-
-      // If _inputs[i]_ has an ancestor in this context, then it is a
-      // dependency. If it is outside this router context, we don't need to
-      // check its inputs.
-      if (dependency) {
-        dependencies.insert(dependency);
-
-        for (int j = 0; j < inputs[i]->numInputs(); ++j) {
-          const Input* input = inputs[i]->input(j);
-          if (input->source && input->source->owner &&
-              visited.find(input->source->owner) == visited.end()) {
-            inputs.push_back(input->source->owner);
-            visited.insert(input->source->owner);
-          }
-        }
-      }
-    }
-
-    // Make sure our context isn't listed as a dependency.
-    dependencies.erase(context);
+  int ProcessorRouter::getWriteIndex(const Output* output) const {
+    // Our Feedback nodes write their outputs before the first step runs.
+    if (feedback_processors_.count(output->owner))
+      return 0;
+    return getOrderIndex(getContext(output->owner));
+  }
 
-    return dependencies;
+  int ProcessorRouter::getOrderIndex(const Processor* processor) const {
+    std::map<const Processor*, int>::const_iterator index =
+        order_index_.find(processor);
+    if (index == order_index_.end())
+      return -1;
+    return index->second;
   }
 } // namespace mopo
@@ -51,6 +51,8 @@ namespace mopo {
       // should call _connect_ on the destination Processor and source Output.
       void connect(Processor* destination, const Output* source, int index);
       void disconnect(const Processor* destination, const Output* source);
+      // Returns true if _first_ is upstream of _second_ within this router.
+      // Stops walking up from _second_ as soon as _first_ is found.
       bool isDownstream(const Processor* first, const Processor* second) const;
       bool areOrdered(const Processor* first, const Processor* second) const;
 
@@ -59,15 +61,73 @@ namespace mopo {
       virtual ProcessorRouter* getMonoRouter();
       virtual ProcessorRouter* getPolyRouter();
 
+      virtual void collectProcessors(
+          std::vector<const Processor*>* processors) const override;
+
+      // Separates every Processor we hold as well. Rejoins every one we ever
+      // held so ones dropped from local_order_ since are not left separated.
+      virtual void separate(const OutputMap& outputs) override;
+      virtual void rejoin() override;
+
+      // Voice batching splits process() around one step of the schedule.
+      // _processHead_ runs the steps before _step_ and _processTail_ the ones
+      // after it. Whatever runs _step_ itself has to check stepEnabled().
+      void processHead(int step);
+      void processTail(int step);
+      Processor* getStep(int step) const { return schedule_[step].processor; }
+      bool stepEnabled(int step) const { return *schedule_[step].enabled; }
+
+      // Returns the index of the first batchable step, or -1 if there is none
+      // or a step up to it reads a buffer written after it. Fills _live_ with
+      // the Outputs written before or by that step which are read after it, in
+      // the order they are written. Outputs in _read_each_ are read after each
+      // voice and ones in _read_last_ only after the last voice. Live Outputs
+      // that can't move to a buffer of their own for each voice go in
+      // _pinned_: ones a Gate or ValueSwitch could point at, ones read before
+      // they are written and ones in _read_last_.
+      int getBatchSplit(std::vector<Output*>* live,
+                        std::set<const Output*>* pinned,
+                        const std::vector<const Output*>& read_each,
+                        const std::vector<const Output*>& read_last) const;
+
+      // Changes whenever a Processor or connection is added to or removed from
+      // this router or any router inside it.
+      int getTopologyChanges() const { return topology_changes_; }
+
     protected:
+      // One entry of local_order_ with the flag that enables it, so process() runs down a
+      // single array without reaching into each Processor to check it. Lazy Processors
+      // also carry their state so unchanged ones are skipped without a call. Each step
+      // still calls process(), which finds its own buffers, and nested routers run their
+      // own schedule_.
+      struct Step {
+        Processor* processor;
+        const bool* enabled;
+        LazyState* lazy;
+      };
+
+      // Rebuilds schedule_ from local_order_. Must be called whenever local_order_ changes.
+      void rebuildSchedule();
+
+      void topologyChanged();
+      void processSteps(int start, int end);
+      void refreshFeedback();
+      void storeFeedback();
+
       // When we create a cycle into the ProcessorRouter graph, we must insert
       // a Feedback node and add it here.
       virtual void addFeedback(Feedback* feedback);
       virtual void removeFeedback(Feedback* feedback);
 
-      // Makes sure _processor_ runs in a topologically sorted order in
-      // relation to all other Processors in _this_.
-      void reorder(Processor* processor);
+      // Makes sure the new connection from _source_ into _destination_ keeps
+      // _this_ and its parents topologically sorted. Only the Processors
+      // ordered between the two move, the rest of the order is untouched.
+      void reorder(const Processor* destination, const Processor* source);
+
+      // Moves the dependencies of _source_ ordered in (start, end] in front of
+      // the Processor at _start_. Returns false if the one at _start_ is one of
+      // them, in which case the order can't be fixed and is left alone.
+      bool moveDependencies(const Processor* source, int start, int end);
 
       // Ensures we have all copies of all processors and feedback processors.
       virtual void updateAllProcessors();
@@ -75,11 +135,19 @@ namespace mopo {
       // Returns the ancestor of _processor_ which is a child of _this_.
       // Returns null if _processor_ is not a descendant of _this_.
       const Processor* getContext(const Processor* processor) const;
-      std::set<const Processor*>
-          getDependencies(const Processor* processor) const;
+      int getOrderIndex(const Processor* processor) const;
+      // Index of the step that writes _output_, or -1 if none of ours does.
+      int getWriteIndex(const Output* output) const;
+      // True if _processor_ runs before _source_ is written, so reads the
+      // value left from the last time it ran.
+      bool readsAhead(const Processor* processor, const Output* source) const;
 
       std::vector<const Processor*>* global_order_;
       std::vector<Processor*> local_order_;
+      std::vector<Step> schedule_;
+      // Index of each Processor in global_order_. Only kept by the original
+      // router since clones never reorder.
+      std::map<const Processor*, int> order_index_;
       std::map<const Processor*, Processor*> processors_;
       std::vector<Processor*> idle_processors_;
 
@@ -89,6 +157,7 @@ namespace mopo {
 
       int* global_changes_;
       int local_changes_;
+      int topology_changes_;
   };
 } // namespace mopo
 
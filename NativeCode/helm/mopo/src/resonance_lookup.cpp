@@ -18,5 +18,519 @@
 
 namespace mopo {
 
-  const ResonanceLookupSingleton ResonanceLookup::lookup_;
+  // Generated by tables/helm_tables.cpp, regenerate with make -f Makefile.tables generate.
+  const mopo_float ResonanceLookup::lookup_[Q_RESOLUTION + 2] = {
+    0.5, 0.5008476717692788, 0.50169678063341439, 0.5025473290287763,
+    0.50339931939586458, 0.50425275417931659, 0.5051076358279144, 0.50596396679459132,
+    0.50682174953643944, 0.50768098651471638, 0.50854168019485269, 0.5094038330464582,
+    0.51026744754332987, 0.51113252616345872, 0.51199907138903655, 0.51286708570646333,
+    0.51373657160635466, 0.51460753158354811, 0.51547996813711139, 0.51635388377034841,
+    0.51722928099080756, 0.51810616231028805, 0.5189845302448477, 0.51986438731480955,
+    0.52074573604476992, 0.52162857896360471, 0.52251291860447768, 0.52339875750484655,
+    0.52428609820647143, 0.52517494325542136, 0.52606529520208167, 0.52695715660116194,
+    0.52785053001170235, 0.52874541799708186, 0.52964182312502506, 0.53053974796760994,
+    0.53143919510127469, 0.53234016710682586, 0.53324266656944508, 0.53414669607869669,
+    0.53505225822853564, 0.53595935561731389, 0.53686799084778924, 0.5377781665271314,
+    0.5386898852669304, 0.539603149683204, 0.54051796239640471, 0.54143432603142772,
+    0.54235224321761832, 0.54327171658877949, 0.54419274878317936, 0.54511534244355875,
+    0.54603950021713898, 0.54696522475562925, 0.54789251871523437, 0.5488213847566622,
+    0.54975182554513169, 0.55068384375037982, 0.55161744204666996, 0.5525526231127994,
+    0.5534893896321067, 0.55442774429247965, 0.55536768978636297, 0.55630922881076583,
+    0.55725236406727008, 0.55819709826203745, 0.55914343410581757, 0.56009137431395573,
+    0.56104092160640062, 0.56199207870771239, 0.56294484834707004, 0.56389923325827951,
+    0.56485523617978151, 0.56581285985465923, 0.56677210703064651, 0.56773298046013565,
+    0.56869548290018468, 0.56965961711252633, 0.57062538586357525, 0.57159279192443591,
+    0.5725618380709111, 0.57353252708350921, 0.57450486174745274, 0.57547884485268619,
+    0.57645447919388371, 0.57743176757045755, 0.57841071278656597, 0.57939131765112117,
+    0.58037358497779734, 0.58135751758503884, 0.58234311829606855, 0.58333038993889519,
+    0.5843193353463223, 0.58530995735595592, 0.5863022588102127, 0.58729624255632829,
+    0.58829191144636528, 0.58928926833722151, 0.59028831609063825, 0.59128905757320849,
+    0.59229149565638506, 0.59329563321648859, 0.5943014731347166, 0.59530901829715077,
+    0.5963182715947658, 0.59732923592343778, 0.59834191418395211, 0.599356309282012,
+    0.60037242412824687, 0.60139026163822085, 0.60240982473244065, 0.60343111633636437,
+    0.60445413938040971, 0.60547889679996258, 0.60650539153538541, 0.60753362653202514,
+    0.60856360474022264, 0.60959532911532022, 0.61062880261767072, 0.61166402821264576,
+    0.61270100887064405, 0.61373974756710059, 0.61478024728249436, 0.61582251100235763,
+    0.61686654171728372, 0.61791234242293636, 0.61895991612005807, 0.62000926581447824,
+    0.62106039451712269, 0.6221133052440212, 0.62316800101631731, 0.62422448486027615,
+    0.62528275980729342, 0.62634282889390414, 0.6274046951617912, 0.62846836165779441,
+    0.62953383143391872, 0.63060110754734355, 0.63167019306043115, 0.63274109104073561,
+    0.63381380456101133, 0.6348883366992224, 0.63596469053855098, 0.63704286916740627,
+    0.63812287567943338, 0.63920471317352223, 0.64028838475381644, 0.64137389352972218,
+    0.64246124261591731, 0.64355043513235988, 0.6446414742042974, 0.64573436296227582,
+    0.64682910454214848, 0.64792570208508493, 0.64902415873758024, 0.65012447765146364,
+    0.65122666198390811, 0.65233071489743899, 0.65343663955994291, 0.65454443914467764,
+    0.6556541168302803, 0.65676567580077716, 0.65787911924559228, 0.65899445035955728,
+    0.66011167234291956, 0.66123078840135252, 0.66235180174596409, 0.66347471559330606,
+    0.66459953316538345, 0.66572625768966376, 0.66685489239908591, 0.66798544053207021,
+    0.66911790533252669, 0.67025229004986542, 0.67138859793900474, 0.6725268322603819,
+    0.67366699627996107, 0.67480909326924376, 0.67595312650527761, 0.67709909927066603,
+    0.67824701485357763, 0.6793968765477556, 0.68054868765252696, 0.6817024514728125,
+    0.68285817131913573, 0.68401585050763281, 0.68517549236006192, 0.68633710020381244,
+    0.68750067737191534, 0.68866622720305171, 0.68983375304156314, 0.691003258237461,
+    0.69217474614643615, 0.69334822012986819, 0.69452368355483562, 0.69570113979412551,
+    0.69688059222624255, 0.69806204423541951, 0.69924549921162626, 0.70043096055058007,
+    0.70161843165375515, 0.7028079159283922, 0.70399941678750844, 0.70519293764990743,
+    0.70638848194018855, 0.70758605308875733, 0.70878565453183473, 0.70998728971146752,
+    0.71119096207553778, 0.71239667507777305, 0.71360443217775604, 0.71481423684093459,
+    0.71602609253863181, 0.71724000274805577, 0.71845597095230962, 0.71967400064040166,
+    0.72089409530725523, 0.72211625845371863, 0.72334049358657548, 0.72456680421855446,
+    0.72579519386833968, 0.72702566606058039, 0.7282582243259017, 0.72949287220091397,
+    0.73072961322822361, 0.7319684509564427, 0.7332093889401996, 0.7344524307401491,
+    0.73569757992298224, 0.73694484006143701, 0.73819421473430857, 0.73944570752645888,
+    0.74069932202882793, 0.74195506183844351, 0.7432129305584313, 0.74447293179802598,
+    0.7457350691725807, 0.74699934630357812, 0.74826576681864065, 0.74953433435154038,
+    0.7508050525422103, 0.75207792503675408, 0.75335295548745684, 0.75463014755279567,
+    0.75590950489745001, 0.75719103119231213, 0.75847473011449773, 0.75976060534735645,
+    0.76104866058048259, 0.76233889950972555, 0.7636313258372005, 0.7649259432712987,
+    0.76622275552669872, 0.76752176632437663, 0.76882297939161681, 0.77012639846202291,
+    0.77143202727552806, 0.77273986957840601, 0.77404992912328152, 0.7753622096691416,
+    0.77667671498134583, 0.77799344883163757, 0.77931241499815429, 0.78063361726543912,
+    0.78195705942445082, 0.78328274527257546, 0.78461067861363698, 0.7859408632579078,
+    0.7872733030221204, 0.78860800172947776, 0.78994496320966456, 0.79128419129885808,
+    0.79262568983973936, 0.79396946268150381, 0.79531551367987285, 0.79666384669710466,
+    0.79801446560200495, 0.79936737426993876, 0.80072257658284096, 0.80208007642922774,
+    0.80343987770420777, 0.80480198430949301, 0.80616640015341046, 0.80753312915091269,
+    0.80890217522358987, 0.81027354229968029, 0.81164723431408214, 0.8130232552083646,
+    0.81440160893077906, 0.81578229943627067, 0.81716533068648955, 0.81855070664980212,
+    0.81993843130130251, 0.82132850862282414, 0.82272094260295092, 0.8241157372370288,
+    0.82551289652717719, 0.8269124244823004, 0.82831432511809944, 0.82971860245708295,
+    0.8311252605285796, 0.83253430336874856, 0.83394573502059233, 0.83535955953396701,
+    0.83677578096559524, 0.83819440337907658, 0.83961543084490042, 0.84103886744045653,
+    0.84246471725004735, 0.8438929843648999, 0.845323672883177, 0.84675678690998923,
+    0.84819233055740673, 0.84963030794447125, 0.85107072319720756, 0.85251358044863546,
+    0.85395888383878149, 0.85540663751469137, 0.85685684563044118, 0.85830951234714947,
+    0.85976464183298962, 0.86122223826320143, 0.86268230582010297, 0.86414484869310293,
+    0.86560987107871257, 0.86707737718055744, 0.86854737120938996, 0.87001985738310084,
+    0.87149483992673205, 0.87297232307248807, 0.87445231105974852, 0.87593480813508029,
+    0.87741981855224971, 0.87890734657223468, 0.88039739646323667, 0.88188997250069345,
+    0.88338507896729113, 0.88488272015297642, 0.88638290035496903, 0.88788562387777359,
+    0.88939089503319291, 0.89089871814033927, 0.89240909752564768, 0.89392203752288779,
+    0.89543754247317631, 0.89695561672499002, 0.89847626463417762, 0.89999949056397244,
+    0.9015252988850051, 0.90305369397531599, 0.90458468022036753, 0.90611826201305723,
+    0.90765444375373006, 0.90919322985019091, 0.91073462471771771, 0.9122786327790734,
+    0.91382525846451956, 0.91537450621182803, 0.91692638046629449, 0.91848088568075092,
+    0.92003802631557841, 0.92159780683871972, 0.9231602317256925, 0.92472530545960185,
+    0.92629303253115347, 0.92786341743866596, 0.9294364646880845, 0.93101217879299314,
+    0.93259056427462816, 0.93417162566189094, 0.93575536749136057, 0.93734179430730757,
+    0.93893091066170631, 0.94052272111424862, 0.94211723023235616, 0.9437144425911943,
+    0.94531436277368464, 0.94691699537051865, 0.9485223449801703, 0.95013041620890981,
+    0.95174121367081654, 0.95335474198779224, 0.95497100578957439, 0.95659000971374952,
+    0.95821175840576656, 0.95983625651894955, 0.96146350871451214, 0.9630935196615702,
+    0.96472629403715504, 0.96636183652622742, 0.96800015182169075, 0.96964124462440426,
+    0.97128511964319719, 0.97293178159488136, 0.97458123520426543, 0.97623348520416842,
+    0.97788853633543271, 0.97954639334693849, 0.9812070609956165, 0.98287054404646246,
+    0.98453684727255009, 0.9862059754550454, 0.98787793338321994, 0.98955272585446474,
+    0.99123035767430401, 0.9929108336564092, 0.99459415862261236, 0.99628033740292021,
+    0.99796937483552817, 0.99966127576683383, 1.0013560450514514, 1.0030536875522249,
+    1.0047542081402427, 1.0064576116948518, 1.0081639031036707, 1.0098730872626043,
+    1.0115851690758582, 1.0133001534559516, 1.0150180453237323, 1.0167388496083913,
+    1.0184625712474753, 1.0201892151869023, 1.0219187863809756, 1.0236512897923971,
+    1.0253867303922826, 1.0271251131601757, 1.0288664430840619, 1.0306107251603831,
+    1.0323579643940519, 1.0341081657984659, 1.0358613343955219, 1.0376174752156309,
+    1.0393765932977319, 1.0411386936893072, 1.0429037814463955, 1.0446718616336079,
+    1.0464429393241412, 1.0482170195997935, 1.049994107550978, 1.0517742082767381,
+    1.0535573268847616, 1.0553434684913954, 1.0571326382216613, 1.0589248412092687,
+    1.0607200825966308, 1.062518367534879, 1.0643197011838781, 1.0661240887122396,
+    1.0679315352973384, 1.0697420461253266, 1.0715556263911483, 1.0733722812985556,
+    1.0751920160601218, 1.077014835897258, 1.0788407460402269, 1.0806697517281587,
+    1.0825018582090657, 1.084337070739857, 1.0861753945863541, 1.0880168350233062,
+    1.0898613973344047, 1.0917090868122992, 1.0935599087586108, 1.0954138684839503,
+    1.0972709713079309, 1.0991312225591845, 1.100994627575377, 1.1028611917032234,
+    1.1047309202985034, 1.106603818726076, 1.1084798923598964, 1.1103591465830296,
+    1.1122415867876674, 1.1141272183751429, 1.1160160467559461, 1.1179080773497403,
+    1.1198033155853766, 1.1217017669009095, 1.1236034367436134, 1.1255083305699978,
+    1.1274164538458222, 1.1293278120461132, 1.1312424106551788, 1.1331602551666253,
+    1.1350813510833722, 1.1370057039176686, 1.1389333191911084, 1.1408642024346469,
+    1.1427983591886159, 1.1447357950027406, 1.146676515436154, 1.1486205260574143,
+    1.1505678324445203, 1.1525184401849271, 1.1544723548755631, 1.1564295821228445,
+    1.1583901275426933, 1.1603539967605516, 1.162321195411399, 1.1642917291397681,
+    1.1662656035997612, 1.168242824455066, 1.170223397378972, 1.1722073280543872,
+    1.174194622173854, 1.1761852854395656, 1.178179323563382, 1.180176742266847,
+    1.1821775472812051, 1.1841817443474161, 1.1861893392161731, 1.1882003376479191,
+    1.1902147454128624, 1.1922325682909938, 1.1942538120721038, 1.1962784825557979,
+    1.1983065855515143, 1.20033812687854, 1.2023731123660277, 1.2044115478530129,
+    1.2064534391884294, 1.2084987922311279, 1.2105476128498915, 1.2125999069234528,
+    1.2146556803405111, 1.2167149389997485, 1.218777688809848, 1.2208439356895098,
+    1.2229136855674683, 1.2249869443825085, 1.2270637180834847, 1.229144012629336,
+    1.2312278339891036, 1.2333151881419493, 1.2354060810771705, 1.2375005187942194,
+    1.2395985073027187, 1.24170005262248, 1.2438051607835201, 1.2459138378260788,
+    1.2480260898006366, 1.2501419227679313, 1.2522613427989757, 1.2543843559750754,
+    1.2565109683878453, 1.2586411861392284, 1.2607750153415118, 1.2629124621173458,
+    1.2650535325997603, 1.2671982329321825, 1.2693465692684556, 1.2714985477728551,
+    1.2736541746201071, 1.275813455995406, 1.2779763980944325, 1.2801430071233708,
+    1.2823132892989271, 1.2844872508483465, 1.2866648980094317, 1.2888462370305607,
+    1.2910312741707046, 1.2932200156994456, 1.2954124678969949, 1.297608637054211,
+    1.2998085294726174, 1.3020121514644207, 1.3042195093525293, 1.3064306094705707,
+    1.3086454581629103, 1.3108640617846696, 1.3130864267017435, 1.3153125592908197,
+    1.3175424659393971, 1.3197761530458025, 1.3220136270192111, 1.324254894279663,
+    1.3264999612580832, 1.3287488343962988, 1.3310015201470584, 1.33325802497405,
+    1.3355183553519197, 1.3377825177662905, 1.3400505187137808, 1.3423223647020228,
+    1.3445980622496816, 1.3468776178864736, 1.3491610381531851, 1.3514483296016917,
+    1.3537394987949762, 1.3560345523071484, 1.358333496723463, 1.3606363386403393,
+    1.3629430846653798, 1.3652537414173889, 1.3675683155263922, 1.3698868136336559,
+    1.3722092423917049, 1.3745356084643425, 1.3768659185266698, 1.3792001792651041,
+    1.3815383973773985, 1.3838805795726614, 1.3862267325713751, 1.3885768631054156,
+    1.3909309779180719, 1.3932890837640648, 1.395651187409567, 1.3980172956322219,
+    1.4003874152211635, 1.4027615529770359, 1.4051397157120125, 1.4075219102498153,
+    1.4099081434257354, 1.4122984220866519, 1.4146927530910516, 1.4170911433090485,
+    1.4194935996224045, 1.4219001289245481, 1.4243107381205946, 1.4267254341273654,
+    1.4291442238734089, 1.4315671142990194, 1.4339941123562576, 1.4364252250089704,
+    1.4388604592328103, 1.4412998220152566, 1.4437433203556342, 1.4461909612651347,
+    1.4486427517668359, 1.451098698895722, 1.453558809698704, 1.4560230912346399,
+    1.4584915505743552, 1.4609641948006622, 1.4634410310083812, 1.4659220663043613,
+    1.4684073078074993, 1.4708967626487612, 1.4733904379712031, 1.4758883409299899,
+    1.478390478692418, 1.4808968584379341, 1.4834074873581569, 1.4859223726568973,
+    1.4884415215501794, 1.4909649412662602, 1.4934926390456515, 1.4960246221411408,
+    1.4985608978178109, 1.5011014733530612, 1.5036463560366293, 1.5061955531706117,
+    1.5087490720694836, 1.5113069200601212, 1.5138691044818224, 1.5164356326863275,
+    1.5190065120378407, 1.5215817499130506, 1.5241613537011527, 1.5267453308038692,
+    1.5293336886354703, 1.5319264346227968, 1.53452357620528, 1.5371251208349637,
+    1.5397310759765257, 1.5423414491072986, 1.5449562477172925, 1.547575479309214,
+    1.550199151398491, 1.5528272715132916, 1.5554598471945476, 1.5580968859959745,
+    1.5607383954840943, 1.563384383238257, 1.5660348568506617, 1.5686898239263793,
+    1.5713492920833738, 1.5740132689525241, 1.5766817621776466, 1.5793547794155161,
+    1.5820323283358879, 1.5847144166215212, 1.5874010519681996, 1.5900922420847532,
+    1.5927879946930821, 1.5954883175281769, 1.5981932183381422, 1.6009027048842184,
+    1.603616784940803, 1.6063354662954747, 1.6090587567490144, 1.6117866641154284,
+    1.6145191962219696, 1.6172563609091617, 1.61999816603082, 1.6227446194540753,
+    1.6254957290593957, 1.6282515027406095, 1.6310119484049272, 1.6337770739729656,
+    1.6365468873787692, 1.639321396569833, 1.6421006095071269, 1.6448845341651162,
+    1.6476731785317862, 1.6504665506086644, 1.6532646584108441, 1.6560675099670064,
+    1.6588751133194442, 1.6616874765240841, 1.664504607650511, 1.6673265147819905,
+    1.6701532060154918, 1.6729846894617113, 1.6758209732450957, 1.678662065503866,
+    1.6815079743900396, 1.6843587080694546, 1.6872142747217933, 1.690074682540605,
+    1.6929399397333298, 1.6958100545213226, 1.6986850351398761, 1.7015648898382449,
+    1.7044496268796685, 1.7073392545413957, 1.7102337811147079, 1.7131332149049436,
+    1.7160375642315209, 1.7189468374279628, 1.7218610428419201, 1.7247801888351961,
+    1.7277042837837699, 1.7306333360778208, 1.7335673541217524, 1.7365063463342172,
+    1.7394503211481389, 1.7423992870107392, 1.74535325238356, 1.7483122257424888,
+    1.7512762155777826, 1.7542452303940916, 1.7572192787104857, 1.7601983690604761,
+    1.7631825099920424, 1.7661717100676548, 1.7691659778643012, 1.7721653219735092,
+    1.7751697510013726, 1.7781792735685755, 1.781193898310417, 1.7842136338768355,
+    1.7872384889324349, 1.7902684721565079, 1.7933035922430616, 1.7963438579008428,
+    1.7993892778533624, 1.8024398608389207, 1.8054956156106325, 1.8085565509364518,
+    1.811622675599198, 1.8146939983965793, 1.81777052814122, 1.8208522736606845,
+    1.8239392437975028, 1.8270314474091964, 1.8301288933683029, 1.8332315905624024,
+    1.836339547894142, 1.8394527742812621, 1.8425712786566215, 1.8456950699682235,
+    1.8488241571792416, 1.8519585492680446, 1.8550982552282225, 1.8582432840686129,
+    1.8613936448133266, 1.8645493465017728, 1.8677103981886862, 1.8708768089441521,
+    1.8740485878536326, 1.8772257440179931, 1.8804082865535279, 1.8835962245919864,
+    1.8867895672805997, 1.8899883237821065, 1.8931925032747796, 1.8964021149524521,
+    1.8996171680245435, 1.9028376717160869, 1.9060636352677545, 1.9092950679358851,
+    1.9125319789925099, 1.9157743777253795, 1.9190222734379903, 1.9222756754496113,
+    1.9255345930953109, 1.9287990357259841, 1.9320690127083782, 1.9353445334251205,
+    1.9386256072747452, 1.9419122436717207, 1.9452044520464753, 1.9485022418454254,
+    1.951805622531003, 1.9551146035816811, 1.9584291944920027, 1.9617494047726072,
+    1.9650752439502575, 1.9684067215678678, 1.971743847184531, 1.9750866303755459,
+    1.9784350807324445, 1.9817892078630197, 1.9851490213913532, 1.9885145309578427,
+    1.9918857462192299, 1.9952626768486275, 1.9986453325355478, 2.0020337229859302,
+    2.0054278579221685, 2.0088277470831399, 2.0122334002242326, 2.0156448271173724,
+    2.0190620375510524, 2.0224850413303614, 2.02591384827701, 2.0293484682293608,
+    2.0327889110424548, 2.0362351865880419, 2.0396873047546076, 2.0431452754474009,
+    2.046609108588465, 2.0500788141166635, 2.0535544019877099, 2.0570358821741959,
+    2.0605232646656209, 2.0640165594684192, 2.0675157766059895, 2.0710209261187242,
+    2.074532018064037, 2.0780490625163925, 2.0815720695673354, 2.0851010493255182,
+    2.0886360119167318, 2.0921769674839332, 2.0957239261872758, 2.0992768982041379,
+    2.1028358937291514, 2.1064009229742315, 2.1099719961686079, 2.1135491235588493,
+    2.1171323154088988, 2.1207215820000984, 2.124316933631222, 2.1279183806185018,
+    2.1315259332956611, 2.1351396020139419, 2.1387593971421341, 2.1423853290666086,
+    2.1460174081913417, 2.1496556449379511, 2.1533000497457202, 2.1569506330716322,
+    2.1606074053903979, 2.164270377194486, 2.1679395589941537, 2.171614961317478,
+    2.1752965947103822, 2.1789844697366707, 2.182678596978056, 2.1863789870341903,
+    2.1900856505226969, 2.1937985980791979, 2.1975178403573481, 2.2012433880288627,
+    2.2049752517835497, 2.2087134423293402, 2.2124579703923182, 2.2162088467167531,
+    2.2199660820651284, 2.2237296872181744, 2.2274996729748979, 2.2312760501526152,
+    2.2350588295869795, 2.2388480221320157, 2.2426436386601494, 2.2464456900622389,
+    2.2502541872476063, 2.2540691411440683, 2.2578905626979688, 2.2617184628742089,
+    2.2655528526562789, 2.2693937430462903, 2.2732411450650067, 2.2770950697518755,
+    2.2809555281650606, 2.2848225313814723, 2.2886960904968006, 2.2925762166255459,
+    2.2964629209010528, 2.3003562144755394, 2.3042561085201312, 2.3081626142248921,
+    2.3120757427988585, 2.315995505470068, 2.3199219134855951, 2.3238549781115809,
+    2.3277947106332668, 2.3317411223550275, 2.3356942246004007, 2.3396540287121232,
+    2.3436205460521604, 2.3475937880017406, 2.3515737659613869, 2.3555604913509511,
+    2.3595539756096442, 2.3635542301960717, 2.3675612665882646, 2.3715750962837143,
+    2.3755957307994029, 2.3796231816718381, 2.3836574604570879, 2.3876985787308085,
+    2.3917465480882827, 2.3958013801444511, 2.3998630865339461, 2.4039316789111242,
+    2.4080071689501001, 2.4120895683447796, 2.4161788888088949, 2.420275142076036,
+    2.4243783398996861, 2.4284884940532541, 2.4326056163301084, 2.4367297185436123,
+    2.440860812527156, 2.4449989101341925, 2.4491440232382686, 2.4532961637330621,
+    2.4574553435324149, 2.4616215745703665, 2.4657948688011877, 2.4699752381994182,
+    2.4741626947598965, 2.478357250497798, 2.4825589174486664, 2.4867677076684513,
+    2.4909836332335407, 2.4952067062407957, 2.4994369388075861, 2.5036743430718258,
+    2.5079189311920045, 2.512170715347227, 2.5164297077372444, 2.520695920582491,
+    2.5249693661241186, 2.5292500566240328, 2.5335380043649267, 2.5378332216503168,
+    2.5421357208045778, 2.5464455141729805, 2.5507626141217221, 2.5550870330379674,
+    2.5594187833298805, 2.5637578774266614, 2.5681043277785829, 2.5724581468570236,
+    2.5768193471545073, 2.5811879411847358, 2.5855639414826257, 2.5899473606043459,
+    2.5943382111273503, 2.5987365056504181, 2.6031422567936859, 2.6075554771986873,
+    2.6119761795283862, 2.6164043764672158, 2.6208400807211132, 2.6252833050175561,
+    2.6297340621056002, 2.6341923647559158, 2.6386582257608224, 2.6431316579343274,
+    2.6476126741121631, 2.6521012871518224, 2.6565975099325949, 2.6611013553556071,
+    2.6656128363438563, 2.6701319658422475, 2.6746587568176339, 2.679193222258851,
+    2.6837353751767545, 2.6882852286042587, 2.6928427955963725, 2.6974080892302381,
+    2.7019811226051673, 2.7065619088426804, 2.7111504610865427, 2.7157467925028032,
+    2.7203509162798309, 2.724962845628355, 2.7295825937815001, 2.7342101739948266,
+    2.7388455995463672, 2.7434888837366644, 2.7481400398888121, 2.7527990813484884,
+    2.7574660214839999, 2.7621408736863144, 2.766823651369104, 2.771514367968781,
+    2.7762130369445361, 2.7809196717783791, 2.7856342859751759, 2.7903568930626883,
+    2.7950875065916114, 2.7998261401356146, 2.8045728072913776, 2.8093275216786333,
+    2.8140902969402029, 2.8188611467420377, 2.8236400847732579, 2.8284271247461903,
+    2.8332222803964093, 2.8380255654827766, 2.8428369937874787, 2.8476565791160686,
+    2.852484335297504, 2.8573202761841872, 2.8621644156520052, 2.8670167676003699,
+    2.8718773459522575, 2.8767461646542474, 2.881623237676564, 2.8865085790131162,
+    2.8914022026815367, 2.8963041227232238, 2.9012143532033798, 2.9061329082110539,
+    2.9110598018591785, 2.9159950482846151, 2.92093866164819, 2.925890656134738,
+    2.9308510459531418, 2.9358198453363733, 2.9407970685415332, 2.9457827298498938,
+    2.9507768435669393, 2.9557794240224053, 2.9607904855703229, 2.9658100425890574,
+    2.9708381094813494, 2.9758747006743591, 2.9809198306197042, 2.9859735137935033,
+    2.991035764696417, 2.9961065978536894, 3.0011860278151903, 3.0062740691554559,
+    3.0113707364737312, 3.0164760443940133, 3.0215900075650901, 3.0267126406605858,
+    3.031843958379, 3.0369839754437522, 3.0421327066032235, 3.0472901666307979,
+    3.0524563703249052, 3.057631332509064, 3.0628150680319246, 3.0680075917673091,
+    3.0732089186142568, 3.078419063497067, 3.0836380413653388, 3.0888658671940177,
+    3.0941025559834361, 3.0993481227593569, 3.1046025825730172, 3.1098659505011712,
+    3.1151382416461337, 3.1204194711358215, 3.125709654123801, 3.1310088057893264,
+    3.1363169413373879, 3.1416340759987529, 3.1469602250300093, 3.1522954037136115,
+    3.1576396273579217, 3.1629929112972563, 3.1683552708919271, 3.1737267215282885,
+    3.1791072786187788, 3.1844969576019664, 3.189895773942593, 3.1953037431316185,
+    3.2007208806862653, 3.2061472021500625, 3.2115827230928922, 3.2170274591110304,
+    3.2224814258271963, 3.2279446388905941, 3.2334171139769587, 3.2388988667886007,
+    3.244389913054452, 3.2498902685301099, 3.2553999489978835, 3.2609189702668373,
+    3.2664473481728389, 3.2719850985786021, 3.2775322373737339, 3.2830887804747793,
+    3.2886547438252678, 3.2942301433957586, 3.299814995183886, 3.3054093152144062,
+    3.3110131195392425, 3.3166264242375325, 3.3222492454156729, 3.3278815992073656,
+    3.3335235017736662, 3.3391749693030279, 3.3448360180113488, 3.3505066641420189,
+    3.3561869239659656, 3.3618768137817026, 3.3675763499153737, 3.3732855487208031,
+    3.3790044265795363, 3.384732999900895, 3.3904712851220196, 3.3962192987079156,
+    3.4019770571515044, 3.4077445769736672, 3.413521874723294, 3.4193089669773307,
+    3.4251058703408277, 3.4309126014469853, 3.4367291769572037, 3.4425556135611304,
+    3.4483919279767061, 3.4542381369502153, 3.4600942572563329, 3.465960305698172,
+    3.4718362991073342, 3.4777222543439552, 3.483618188296755, 3.4895241178830854,
+    3.495440060048979, 3.5013660317691979, 3.5073020500472829, 3.5132481319156001,
+    3.5192042944353923, 3.5251705546968273, 3.5311469298190454, 3.5371334369502114,
+    3.5431300932675609, 3.5491369159774506, 3.5551539223154087, 3.5611811295461835,
+    3.5672185549637927, 3.5732662158915729, 3.5793241296822305, 3.5853923137178905,
+    3.5914707854101455, 3.5975595622001091, 3.6036586615584607, 3.6097681009855007,
+    3.6158878980111973, 3.6220180701952387, 3.6281586351270829, 3.6343096104260071,
+    3.6404710137411604, 3.6466428627516123, 3.6528251751664054, 3.6590179687246036,
+    3.665221261195347, 3.671435070377898, 3.6776594141016967, 3.683894310226409,
+    3.6901397766419803, 3.696395831268684, 3.7026624920571765, 3.7089397769885446,
+    3.7152277040743611, 3.7215262913567337, 3.727835556908357, 3.7341555188325666,
+    3.7404861952633883, 3.7468276043655915, 3.7531797643347415, 3.7595426933972513,
+    3.7659164098104334, 3.7723009318625533, 3.7786962778728808, 3.7851024661917441,
+    3.7915195152005801, 3.7979474433119904, 3.80438626896979, 3.8108360106490653,
+    3.817296686856221, 3.8237683161290401, 3.83025091703673, 3.8367445081799825,
+    3.8432491081910212, 3.8497647357336597, 3.8562914095033527, 3.8628291482272488,
+    3.8693779706642473, 3.8759378956050501, 3.8825089418722141, 3.8890911283202088,
+    3.8956844738354679, 3.9022889973364436, 3.908904717773662, 3.9155316541297767,
+    3.9221698254196227, 3.9288192506902733, 3.9354799490210914, 3.9421519395237867,
+    3.9488352413424703, 3.9555298736537088, 3.9622358556665787, 3.9689532066227238,
+    3.9756819457964085, 3.9824220924945744, 3.9891736660568937, 3.9959366858558272,
+    4.0027111712966779, 4.009497141817647, 4.0162946168898932, 4.0231036160175799,
+    4.0299241587379431, 4.036756264621336, 4.0435999532712934, 4.0504552443245831,
+    4.0573221574512655, 4.0642007123547463, 4.071090928771838, 4.077992826472812,
+    4.0849064252614564, 4.0918317449751349, 4.098768805484843, 4.1057176266952631,
+    4.1126782285448229, 4.1196506310057526, 4.1266348540841422, 4.1336309178199997,
+    4.1406388422873075, 4.1476586475940795, 4.1546903538824207, 4.1617339813285819,
+    4.168789550143023, 4.1758570805704638, 4.1829365928899485, 4.1900281074148999,
+    4.1971316444931803, 4.2042472245071476, 4.2113748678737135, 4.2185145950444065,
+    4.225666426505426, 4.232830382777701, 4.2400064844169538, 4.2471947520137512,
+    4.254395206193573, 4.2616078676168634, 4.2688327569790943, 4.2760698950108207,
+    4.2833193024777483, 4.290581000180782, 4.2978550089560965, 4.3051413496751874,
+    4.3124400432449352, 4.3197511106076671, 4.3270745727412132, 4.3344104506589662,
+    4.3417587654099465, 4.3491195380788605, 4.3564927897861567, 4.3638785416880923,
+    4.3712768149767935, 4.3786876308803109, 4.3861110106626855, 4.393546975624008,
+    4.4009955471004814, 4.4084567464644779, 4.4159305951246068, 4.4234171145257699,
+    4.4309163261492257, 4.4384282515126516, 4.4459529121702053, 4.4534903297125839,
+    4.46104052576709, 4.468603521997693, 4.4761793401050864, 4.4837680018267587,
+    4.4913695289370468, 4.4989839432472039, 4.5066112666054616, 4.5142515208970924,
+    4.5219047280444684, 4.5295709100071315, 4.5372500887818497, 4.5449422864026854,
+    4.5526475249410554, 4.5603658265057936, 4.5680972132432185, 4.5758417073371938,
+    4.5835993310091894, 4.5913701065183528, 4.5991540561615647, 4.6069512022735086,
+    4.6147615672267328, 4.6225851734317143, 4.6304220433369228, 4.6382721994288882,
+    4.6461356642322613, 4.6540124603098789, 4.6619026102628318, 4.669806136730525,
+    4.6777230623907471, 4.6856534099597331, 4.6935972021922279, 4.7015544618815559,
+    4.7095252118596829, 4.717509474997283, 4.725507274203804, 4.7335186324275318,
+    4.741543572655659, 4.7495821179143496, 4.7576342912688041, 4.7657001158233268,
+    4.7737796147213913, 4.7818728111457069, 4.7899797283182872, 4.7981003895005125,
+    4.8062348179932028, 4.8143830371366771, 4.8225450703108281, 4.8307209409351817,
+    4.8389106724689706, 4.8471142884111984, 4.8553318123007054, 4.8635632677162421,
+    4.8718086782765306, 4.8800680676403356, 4.8883414595065302, 4.8966288776141678,
+    4.9049303457425451, 4.9132458877112741, 4.9215755273803499, 4.9299192886502166,
+    4.9382771954618399, 4.9466492717967716, 4.9550355416772227, 4.9634360291661279,
+    4.9718507583672178, 4.980279753425088, 4.9887230385252659, 4.9971806378942834,
+    5.0056525757997417, 5.0141388765503878, 5.0226395644961777, 5.0311546640283495,
+    5.0396841995794928, 5.0482281956236204, 5.0567866766762348, 5.0653596672944019,
+    5.0739471920768189, 5.0825492756638884, 5.0911659427377858, 5.0997972180225304,
+    5.1084431262840582, 5.1171036923302919, 5.1257789410112133, 5.1344688972189303,
+    5.1431735858877552, 5.1518930319942697, 5.1606272605574004, 5.1693762966384904,
+    5.178140165341369, 5.1869188918124252, 5.1957125012406813, 5.2045210188578626,
+    5.2133444699384697, 5.2221828797998544, 5.2310362738022889, 5.2399046773490392,
+    5.2487881158864402, 5.2576866149039656, 5.2666001999343033, 5.2755288965534275,
+    5.2844727303806733, 5.2934317270788069, 5.3024059123541054, 5.3113953119564243,
+    5.3203999516792742, 5.3294198573598957, 5.3384550548793301, 5.3475055701625003,
+    5.3565714291782749, 5.3656526579395543, 5.3747492825033358, 5.3838613289707942,
+    5.3929888234873546, 5.4021317922427672, 5.4112902614711818, 5.4204642574512265,
+    5.429653806506078, 5.4388589350035419, 5.448079669356126, 5.4573160360211155,
+    5.4665680615006504, 5.4758357723418003, 5.485119195136642, 5.4944183565223348,
+    5.5037332831811963, 5.5130640018407817, 5.5224105392739569, 5.5317729222989769,
+    5.5411511777795637, 5.5505453326249823, 5.559955413790119, 5.5693814482755553,
+    5.5788234631276516, 5.5882814854386185, 5.5977555423465972, 5.6072456610357388,
+    5.6167518687362801, 5.6262741927246234, 5.6358126603234115, 5.6453672989016113,
+    5.6549381358745885, 5.6645251987041858, 5.674128514898805, 5.6837481120134834,
+    5.6933840176499739, 5.7030362594568231, 5.712704865129453, 5.7223898624102363,
+    5.7320912790885803, 5.7418091430010048, 5.7515434820312219, 5.7612943241102164,
+    5.7710616972163242, 5.7808456293753174, 5.7906461486604766, 5.8004632831926815,
+    5.8102970611404823, 5.8201475107201865, 5.8300146601959373, 5.8398985378797956,
+    5.8497991721318217, 5.8597165913601543, 5.8696508240210949, 5.879601898619188,
+    5.889569843707303, 5.8995546878867149, 5.9095564598071908, 5.9195751881670651,
+    5.9296109017133301, 5.9396636292417098, 5.9497333995967496, 5.9598202416718955,
+    5.9699241844095781, 5.9800452568012954, 5.9901834878876947, 6.0003389067586594,
+    6.0105115425533873, 6.0207014244604808, 6.0309085817180241, 6.0411330436136703,
+    6.0513748394847271, 6.0616339987182375, 6.0719105507510642, 6.0822045250699794,
+    6.0925159512117419, 6.1028448587631878, 6.1131912773613104, 6.1235552366933517,
+    6.1339367664968796, 6.1443358965598804, 6.1547526567208397, 6.1651870768688308,
+    6.1756391869435987, 6.1861090169356467, 6.1965965968863204, 6.2071019568878993,
+    6.2176251270836769, 6.2281661376680511, 6.2387250188866092, 6.2493018010362151,
+    6.2598965144650984, 6.2705091895729348, 6.2811398568109427, 6.2917885466819632,
+    6.3024552897405508, 6.3131401165930603, 6.3238430578977347, 6.3345641443647933,
+    6.3453034067565204, 6.3560608758873514, 6.3668365826239652, 6.377630557885368,
+    6.3884428326429861, 6.3992734379207512, 6.4101224047951932, 6.4209897643955252,
+    6.4318755479037373, 6.4427797865546816, 6.4537025116361662, 6.4646437544890407,
+    6.4756035465072905, 6.4865819191381213, 6.4975789038820562, 6.5085945322930199,
+    6.519628835978434, 6.5306818465993031, 6.5417535958703104, 6.5528441155599042,
+    6.563953437490393, 6.5750815935380347, 6.5862286156331278, 6.5973945357601043,
+    6.6085793859576194, 6.6197831983186468, 6.6310060049905681, 6.6422478381752654,
+    6.6535087301292135, 6.6647887131635732, 6.6760878196442865, 6.6874060819921626,
+    6.6987435326829781, 6.7101002042475661, 6.7214761292719105, 6.7328713403972404,
+    6.7442858703201241, 6.7557197517925562, 6.7671730176220626, 6.7786457006717891,
+    6.7901378338605936, 6.8016494501631444, 6.8131805826100118, 6.8247312642877649,
+    6.8363015283390665, 6.8478914079627673, 6.8595009364140003, 6.8711301470042789,
+    6.8827790731015899, 6.8944477481304913, 6.9061362055722073, 6.9178444789647218,
+    6.9295726019028807, 6.9413206080384819, 6.9530885310803763, 6.9648764047945608,
+    6.9766842630042811, 6.9885121395901217, 7.0003600684901066, 7.0122280836997968,
+    7.0241162192723889, 7.0360245093188096, 7.0479529880078156, 7.0599016895660913,
+    7.0718706482783489, 7.0838598984874217, 7.0958694745943687, 7.10789941105857,
+    7.1199497423978251, 7.1320205031884534, 7.1441117280653934, 7.156223451722302,
+    7.168355708911653, 7.1805085344448383, 7.1926819631922667, 7.2048760300834633,
+    7.2170907701071734, 7.2293262183114573, 7.2415824098037964, 7.253859379751189,
+    7.2661571633802549, 7.278475795977335, 7.2908153128885917, 7.3031757495201139,
+    7.3155571413380125, 7.327959523868528, 7.3403829326981302, 7.3528274034736176,
+    7.3652929719022247, 7.3777796737517223, 7.3902875448505183, 7.4028166210877631,
+    7.4153669384134497, 7.4279385328385219, 7.4405314404349721, 7.4531456973359473,
+    7.4657813397358535, 7.4784384038904586, 7.4911169261169945, 7.5038169427942654,
+    7.5165384903627501, 7.5292816053247051, 7.5420463242442723, 7.5548326837475814,
+    7.5676407205228555, 7.5804704713205187, 7.5933219729532979, 7.6061952622963318,
+    7.6190903762872724, 7.6320073519263962, 7.6449462262767085, 7.6579070364640458,
+    7.6708898196771891, 7.6838946131679657, 7.6969214542513571, 7.7099703803056068,
+    7.7230414287723272, 7.7361346371566082, 7.7492500430271232, 7.7623876840162351,
+    7.7755475978201112, 7.788729822198821, 7.8019343949764561, 7.815161354041229,
+    7.8284107373455871, 7.8416825829063201, 7.8549769288046694, 7.8682938131864368,
+    7.8816332742620947, 7.8949953503068944, 7.9083800796609793, 7.9217875007294891,
+    7.9352176519826765, 7.9486705719560131, 7.9621462992503007, 7.9756448725317846,
+    7.9891663305322602, 8.0027107120491863, 8.016278055945806, 8.0298684011512371,
+    8.0434817866605943, 8.0571182515351154, 8.0707778349022483, 8.0844605759557844,
+    8.0981665139559524, 8.1118956882295521, 8.1256481381700425, 8.1394239032376827,
+    8.1532230229596152, 8.1670455369300115, 8.1808914848101466, 8.1947609063285629,
+    8.2086538412811283, 8.2225703295312016, 8.2365104110097054, 8.2504741257152734,
+    8.2644615137143393, 8.2784726151412737, 8.2925074701984762, 8.3065661191565194,
+    8.3206486023542308, 8.3347549601988415, 8.3488852331660723, 8.3630394618002803,
+    8.3772176867145429, 8.3914199485908068, 8.4056462881799696, 8.4198967463020384,
+    8.4341713638462004, 8.4484701817709862, 8.4627932411043449, 8.477140582943802,
+    8.4915122484565373, 8.5059082788795415, 8.5203287155197014, 8.5347735997539456,
+    8.5492429730293367, 8.5637368768632243, 8.5782553528433176, 8.5927984426278599,
+    8.6073661879456935, 8.6219586305964278, 8.6365758124505163, 8.6512177754494193,
+    8.6658845616056794, 8.6805762130030857, 8.695292771796753, 8.7100342802132875,
+    8.7248007805508578, 8.7395923151793689, 8.7544089265405329, 8.7692506571480369,
+    8.78411754958762, 8.7990096465172467, 8.8139269906671718, 8.8288696248401202,
+    8.8438375919113561, 8.8588309348288572, 8.8738496966133908, 8.8888939203586776,
+    8.9039636492314784, 8.9190589264717559, 8.9341797953927617, 8.9493262993811946,
+    8.964498481897289, 8.9796963864749859, 8.9949200567220018, 9.0101695363200101,
+    9.0254448690247138, 9.0407460986660251, 9.0560732691481345, 9.071426424449692,
+    9.0868056086238784, 9.1022108657985896, 9.117642240176508, 9.133099776035273,
+    9.1485835177275714, 9.1640935096813081, 9.1796297963996807, 9.1951924224613588,
+    9.2107814325205695, 9.2263968713072604, 9.242038783627196, 9.2577072143621191,
+    9.2734022084698431, 9.2891238109844192, 9.3048720670162304, 9.3206470217521531,
+    9.3364487204556532, 9.352277208466953, 9.3681325312031234, 9.3840147341582529,
+    9.3999238629035329, 9.415859963087442, 9.4318230804358212, 9.4478132607520582,
+    9.4638305499171693, 9.4798749938899789, 9.4959466387071991, 9.512045530483622,
+    9.5281717154121885, 9.5443252397641825, 9.5605061498893047, 9.5767144922158618,
+    9.5929503132508476, 9.6092136595801225, 9.625504577868508, 9.6418231148599567,
+    9.6581693173776451, 9.674543232324158, 9.6909449066815725, 9.7073743875116349,
+    9.7238317219558574, 9.7403169572356987, 9.7568301406526476, 9.77337131958841,
+    9.7899405415049934, 9.8065378539448993, 9.8231633045312012, 9.8398169409677365,
+    9.8564988110391916, 9.8732089626112902, 9.8899474436308772, 9.9067143021261135,
+    9.9235095862065563, 9.9403333440633475, 9.9571856239693108, 9.9740664742791267,
+    9.9909759434294365, 10.007914079939017, 10.024880932408877, 10.041876549522447,
+    10.058900980045669, 10.075954272827182, 10.093036476798417, 10.110147640973786,
+    10.127287814450771, 10.144457046410114, 10.161655386115918, 10.17888288291582,
+    10.196139586241102, 10.213425545606869, 10.230740810612149, 10.24808543094008,
+    10.265459456358005, 10.28286293671767, 10.300295921955303, 10.317758462091824,
+    10.335250607232926, 10.352772407569274, 10.370323913376598, 10.387905175015893,
+    10.405516242933501, 10.423157167661318, 10.440827999816879, 10.458528790103561,
+    10.476259589310677, 10.49402044831367, 10.511811418074206, 10.529632549640375,
+    10.54748389414679, 10.565365502814775, 10.583277426952467, 10.601219717955015,
+    10.619192427304675, 10.637195606571009, 10.655229307410979, 10.673293581569149,
+    10.691388480877787, 10.709514057257055, 10.727670362715113, 10.745857449348319,
+    10.764075369341329, 10.782324174967291, 10.800603918587951, 10.81891465265385,
+    10.83725642970443, 10.855629302368223, 10.874033323362966, 10.892468545495792,
+    10.910935021663335, 10.929432804851936, 10.947961948137737, 10.966522504686889,
+    10.985114527755652, 11.0037380706906, 11.022393186928721, 11.041079929997625,
+    11.059798353515641, 11.078548511192025, 11.097330456827066, 11.11614424431229,
+    11.134989927630555, 11.153867560856268, 11.172777198155488, 11.191718893786128,
+    11.210692702098058, 11.229698677533316, 11.248736874626216, 11.267807348003551,
+    11.286910152384696, 11.306045342581825, 11.325212973500005, 11.34441310013742,
+    11.363645777585468, 11.382911061028951, 11.402209005746244, 11.421539667109414,
+    11.44090310058443, 11.460299361731266, 11.479728506204115, 11.4991905897515,
+    11.518685668216479, 11.538213797536761, 11.557775033744914, 11.577369432968471,
+    11.596997051430151, 11.61665794544796, 11.63635217143541, 11.65607978590163,
+    11.675840845451573, 11.695635406786131, 11.715463526702354, 11.735325262093552,
+    11.755220669949516, 11.775149807356629, 11.795112731498081, 11.81510949965398,
+    11.835140169201573, 11.855204797615347, 11.875303442467263, 11.895436161426856,
+    11.915603012261458, 11.935804052836309, 11.956039341114776, 11.976308935158471,
+    11.996612893127464, 12.0169512732804, 12.037324133974719, 12.057731533666773,
+    12.078173530912039, 12.098650184365244, 12.119161552780579, 12.139707695011817,
+    12.160288670012536, 12.180904536836231, 12.201555354636547, 12.222241182667377,
+    12.242962080283107, 12.263718106938716, 12.28450932219001, 12.30533578569373,
+    12.32619755720779, 12.347094696591382, 12.368027263805208, 12.388995318911601,
+    12.40999892207474, 12.431038133560781, 12.45211301373808, 12.473223623077304,
+    12.494370022151676, 12.515552271637073, 12.536770432312276, 12.558024565059071,
+    12.579314730862494, 12.600640990810939, 12.622003406096397, 12.643402038014569,
+    12.664836947965107, 12.686308197451719, 12.707815848082422, 12.729359961569644,
+    12.750940599730468, 12.772557824486746, 12.794211697865347, 12.815902281998255,
+    12.837629639122829, 12.859393831581908, 12.881194921824051, 12.903032972403659,
+    12.924908045981223, 12.946820205323423, 12.968769513303387, 12.990756032900805,
+    13.012779827202165, 13.034840959400878, 13.056939492797527, 13.079075490799974,
+    13.101249016923612, 13.123460134791483, 13.145708908134521, 13.167995400791682,
+    13.190319676710173, 13.212681799945587, 13.235081834662145, 13.257519845132816,
+    13.279995895739564, 13.302510050973472, 13.325062375434991, 13.347652933834055,
+    13.370281790990344, 13.392949011833387, 13.415654661402833, 13.438398804848557,
+    13.46118150743092, 13.48400283452089, 13.506862851600289, 13.529761624261928,
+    13.552699218209849, 13.575675699259449, 13.598691133337745, 13.621745586483485,
+    13.644839124847408, 13.66797181469237, 13.691143722393599, 13.714354914438818,
+    13.737605457428501, 13.760895418076, 13.784224863207804, 13.807593859763664,
+    13.831002474796843, 13.854450775474259, 13.877938829076728, 13.901466702999095,
+    13.925034464750501, 13.948642181954501, 13.972289922349333, 13.995977753788036,
+    14.019705744238719, 14.043473961784688, 14.067282474624704, 14.091131351073118,
+    14.11502065956013, 14.138950468631917, 14.1629208469509, 14.186931863295875,
+    14.210983586562275, 14.235076085762294, 14.259209430025171, 14.283383688597299,
+    14.307598930842504, 14.331855226242176, 14.356152644395531, 14.380491255019749,
+    14.404871127950234, 14.429292333140753, 14.453754940663703, 14.478259020710247,
+    14.502804643590576, 14.527391879734044, 14.552020799689448, 14.576691474125152,
+    14.60140397382936, 14.626158369710256, 14.650954732796267, 14.675793134236207,
+    14.700673645299545, 14.725596337376542, 14.750561281978525, 14.775568550738019,
+    14.800618215409031, 14.825710347867176, 14.850845020109963, 14.876022304256921,
+    14.901242272549885, 14.926504997353128, 14.95181055115364, 14.977159006561271,
+    15.002550436308997, 15.027984913253071, 15.053462510373299, 15.078983300773174,
+    15.104547357680161, 15.130154754445835, 15.155805564546165, 15.181499861581647,
+    15.207237719277597, 15.233019211484278, 15.258844412177194, 15.284713395457228,
+    15.310626235550924, 15.336583006810629, 15.362583783714783, 15.388628640868047,
+    15.414717653001608, 15.440850894973307, 15.467028441767935, 15.493250368497367,
+    15.519516750400857, 15.545827662845181, 15.572183181324919, 15.598583381462607,
+    15.625028339009024, 15.651518129843335, 15.678052829973387, 15.70463251553584,
+    15.731257262796479, 15.757927148150342, 15.784642248122024, 15.811402639365815,
+    15.838208398666, 15.865059602937, 15.891956329223673, 15.918898654701456,
+    15.945886656676661, 15.972920412586623, 16, 16.027125496616915,
+  };
 } // namespace mopo
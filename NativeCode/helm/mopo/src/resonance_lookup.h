@@ -29,35 +29,19 @@ namespace mopo {
     const int Q_RESOLUTION = 2046;
   } // namespace
 
-  class ResonanceLookupSingleton {
+  // The table is generated into resonance_lookup.cpp by tables/helm_tables.cpp.
+  class ResonanceLookup {
     public:
-      ResonanceLookupSingleton() {
-        for (int i = 0; i < Q_RESOLUTION + 2; ++i) {
-          q_lookup_[i] = utils::magnitudeToQ((1.0 * i) / Q_RESOLUTION);
-        }
-      }
-
-      mopo_float qLookup(mopo_float magnitude) const {
-        mopo_float index = Q_RESOLUTION * utils::clamp(magnitude, 0.0, 1.0);
+      static mopo_float qLookup(mopo_float magnitude) {
+        mopo_float index = Q_RESOLUTION * utils::clamp(magnitude, mopo_float(0.0), mopo_float(1.0));
         int int_index = index;
         mopo_float fraction = index - int_index;
 
-        return utils::interpolate(q_lookup_[int_index],
-                                  q_lookup_[int_index + 1], fraction);
-      }
-
-    private:
-      mopo_float q_lookup_[Q_RESOLUTION + 2];
-  };
-
-  class ResonanceLookup {
-    public:
-      static mopo_float qLookup(mopo_float magnitude) {
-        return lookup_.qLookup(magnitude);
+        return utils::interpolate(lookup_[int_index], lookup_[int_index + 1], fraction);
       }
 
     private:
-      static const ResonanceLookupSingleton lookup_;
+      static const mopo_float lookup_[Q_RESOLUTION + 2];
   };
 } // namespace mopo
 
@@ -127,7 +127,7 @@ namespace mopo {
     mopo_float* dest_left = output(0)->buffer;
     mopo_float* dest_right = output(1)->buffer;
 
-    mopo_float wet_in = utils::clamp(input(kWet)->at(0), 0.0, 1.0);
+    mopo_float wet_in = utils::clamp(input(kWet)->at(0), mopo_float(0.0), mopo_float(1.0));
     mopo_float next_wet = sqrt(wet_in);
     mopo_float next_dry = sqrt(1.0 - wet_in);
     mopo_float wet_inc = (next_wet - current_wet_) / buffer_size_;
@@ -30,16 +30,10 @@ namespace mopo {
     const mopo_float CLOSE_ENOUGH = 1.0 / 256.0;
   } // namespace
 
-  class SampleDecayLookupSingleton {
+  // The table is generated into sample_decay_lookup.cpp by tables/helm_tables.cpp.
+  class SampleDecayLookup {
     public:
-      SampleDecayLookupSingleton() {
-        for (int i = 0; i < SAMPLE_DECAY_LOOKUP_RESOLUTION + 3; ++i) {
-          mopo_float percent = (1.0 * i) / SAMPLE_DECAY_LOOKUP_RESOLUTION;
-          sample_decay_lookup_[i] = pow(CLOSE_ENOUGH, percent);
-        }
-      }
-
-      mopo_float sampleDecayLookup(mopo_float sample_length) const {
+      static mopo_float sampleDecayLookup(mopo_float sample_length) {
         if (sample_length <= 1.0)
           return 0.0;
 
@@ -48,22 +42,11 @@ namespace mopo {
         int int_index = index;
         mopo_float fraction = index - int_index;
 
-        return utils::interpolate(sample_decay_lookup_[int_index],
-                                  sample_decay_lookup_[int_index + 1], fraction);
-      }
-
-    private:
-      mopo_float sample_decay_lookup_[SAMPLE_DECAY_LOOKUP_RESOLUTION + 3];
-  };
-
-  class SampleDecayLookup {
-    public:
-      static mopo_float sampleDecayLookup(mopo_float sample_length) {
-        return lookup_.sampleDecayLookup(sample_length);
+        return utils::interpolate(lookup_[int_index], lookup_[int_index + 1], fraction);
       }
 
     private:
-      static const SampleDecayLookupSingleton lookup_;
+      static const mopo_float lookup_[SAMPLE_DECAY_LOOKUP_RESOLUTION + 3];
   };
 } // namespace mopo
 
@@ -33,6 +33,8 @@ namespace mopo {
     last_in_ = last_distort_ = 0.0;
 
     drive_ = target_drive_ = 0.0;
+    batch_audio_ = nullptr;
+    batch_dest_ = nullptr;
     last_style_ = kNumStyles;
     last_shelf_ = kNumShelves;
     reset();
@@ -44,17 +46,56 @@ namespace mopo {
     const mopo_float* audio_buffer = input(kAudio)->source->buffer;
     mopo_float* dest = output()->buffer;
 
-    if (input(kOn)->at(0) == 0.0) {
+    if (!updateCoefficients())
       processAllPass(audio_buffer, dest);
-      return;
+    else if (last_style_ == k24dB)
+      process24db(audio_buffer, dest);
+    else
+      process12db(audio_buffer, dest);
+  }
+
+  bool StateVariableFilter::prepareBatch() {
+    const Output* reset = input(kReset)->source;
+    if (!updateCoefficients() || (reset->triggered && reset->trigger_value == kVoiceReset)) {
+      process();
+      return false;
     }
 
+    batch_audio_ = input(kAudio)->source->buffer;
+    batch_dest_ = output()->buffer;
+    return true;
+  }
+
+  void StateVariableFilter::processBatch(Processor* const* clones, int num_clones) {
+    StateVariableFilter* filters_12db[MAX_BATCH_VOICES];
+    StateVariableFilter* filters_24db[MAX_BATCH_VOICES];
+    int num_12db = 0;
+    int num_24db = 0;
+
+    for (int i = 0; i < num_clones; ++i) {
+      StateVariableFilter* filter = static_cast<StateVariableFilter*>(clones[i]);
+      if (filter->last_style_ == k24dB)
+        filters_24db[num_24db++] = filter;
+      else
+        filters_12db[num_12db++] = filter;
+    }
+
+    if (num_12db)
+      processLanes(filters_12db, num_12db, false);
+    if (num_24db)
+      processLanes(filters_24db, num_24db, true);
+  }
+
+  bool StateVariableFilter::updateCoefficients() {
+    if (input(kOn)->at(0) == 0.0)
+      return false;
+
     Styles style = static_cast<Styles>(static_cast<int>(input(kStyle)->at(0)));
     bool db24 = style == k24dB;
 
-    mopo_float cutoff = utils::clamp(input(kCutoff)->at(0), MIN_CUTTOFF, sample_rate_);
+    mopo_float cutoff = utils::clamp(input(kCutoff)->at(0), mopo_float(MIN_CUTTOFF), mopo_float(sample_rate_));
     mopo_float resonance = utils::clamp(input(kResonance)->at(0),
-                                        MIN_RESONANCE, MAX_RESONANCE);
+                                        mopo_float(MIN_RESONANCE), mopo_float(MAX_RESONANCE));
     target_drive_ = input(kDrive)->at(0);
 
     if (style == kShelf) {
@@ -70,11 +111,7 @@ namespace mopo {
       reset();
       last_style_ = style;
     }
-
-    if (db24)
-      process24db(audio_buffer, dest);
-    else
-      process12db(audio_buffer, dest);
+    return true;
   }
 
   void StateVariableFilter::process12db(const mopo_float* audio_buffer, mopo_float* dest) {
@@ -148,6 +185,199 @@ namespace mopo {
     m1_ = target_m1_;
   }
 
+  // Each filter gets a lane and unused lanes filter silence, so the loops over
+  // lanes always have the same length. Samples are interleaved so every lane's
+  // sample sits side by side.
+  void StateVariableFilter::processLanes(StateVariableFilter* const* filters,
+                                         int num_filters, bool db24) {
+    mopo_float audio[MAX_BUFFER_SIZE * MAX_BATCH_VOICES];
+    mopo_float dest[MAX_BUFFER_SIZE * MAX_BATCH_VOICES];
+
+    for (int v = 0; v < MAX_BATCH_VOICES; ++v) {
+      if (v < num_filters) {
+        StateVariableFilter* filter = filters[v];
+        mopo_float drive = filter->drive_;
+        mopo_float delta_drive = (filter->target_drive_ - drive) / buffer_size_;
+        if (db24) {
+          for (int i = 0; i < buffer_size_; ++i) {
+            drive += delta_drive;
+            audio[i * MAX_BATCH_VOICES + v] = drive * filter->batch_audio_[i];
+          }
+        }
+        else {
+          for (int i = 0; i < buffer_size_; ++i) {
+            drive += delta_drive;
+            audio[i * MAX_BATCH_VOICES + v] = utils::quickTanh(drive * filter->batch_audio_[i]);
+          }
+        }
+        filter->drive_ = drive;
+
+        lanes_.a1[v] = filter->a1_;
+        lanes_.a2[v] = filter->a2_;
+        lanes_.a3[v] = filter->a3_;
+        lanes_.m0[v] = filter->m0_;
+        lanes_.m1[v] = filter->m1_;
+        lanes_.m2[v] = filter->m2_;
+        lanes_.delta_m0[v] = (filter->target_m0_ - filter->m0_) / buffer_size_;
+        lanes_.delta_m1[v] = (filter->target_m1_ - filter->m1_) / buffer_size_;
+        lanes_.delta_m2[v] = (filter->target_m2_ - filter->m2_) / buffer_size_;
+        lanes_.ic1eq_a[v] = filter->ic1eq_a_;
+        lanes_.ic2eq_a[v] = filter->ic2eq_a_;
+        lanes_.ic1eq_b[v] = filter->ic1eq_b_;
+        lanes_.ic2eq_b[v] = filter->ic2eq_b_;
+      }
+      else {
+        for (int i = 0; i < buffer_size_; ++i)
+          audio[i * MAX_BATCH_VOICES + v] = 0.0;
+
+        lanes_.a1[v] = lanes_.a2[v] = lanes_.a3[v] = 0.0;
+        lanes_.m0[v] = lanes_.m1[v] = lanes_.m2[v] = 0.0;
+        lanes_.delta_m0[v] = lanes_.delta_m1[v] = lanes_.delta_m2[v] = 0.0;
+        lanes_.ic1eq_a[v] = lanes_.ic2eq_a[v] = 0.0;
+        lanes_.ic1eq_b[v] = lanes_.ic2eq_b[v] = 0.0;
+      }
+    }
+
+    if (db24)
+      process24dbLanes(&lanes_, audio, dest, buffer_size_);
+    else
+      process12dbLanes(&lanes_, audio, dest, buffer_size_);
+
+    for (int v = 0; v < num_filters; ++v) {
+      StateVariableFilter* filter = filters[v];
+      for (int i = 0; i < buffer_size_; ++i)
+        filter->batch_dest_[i] = dest[i * MAX_BATCH_VOICES + v];
+
+      filter->m0_ = lanes_.m0[v];
+      filter->m1_ = db24 ? filter->target_m1_ : lanes_.m1[v];
+      filter->m2_ = lanes_.m2[v];
+      filter->ic1eq_a_ = lanes_.ic1eq_a[v];
+      filter->ic2eq_a_ = lanes_.ic2eq_a[v];
+      filter->ic1eq_b_ = lanes_.ic1eq_b[v];
+      filter->ic2eq_b_ = lanes_.ic2eq_b[v];
+    }
+  }
+
+  void StateVariableFilter::process12dbLanes(Lanes* lanes, const mopo_float* audio,
+                                             mopo_float* dest, int buffer_size) {
+    mopo_float a1[MAX_BATCH_VOICES], a2[MAX_BATCH_VOICES], a3[MAX_BATCH_VOICES];
+    mopo_float m0[MAX_BATCH_VOICES], m1[MAX_BATCH_VOICES], m2[MAX_BATCH_VOICES];
+    mopo_float delta_m0[MAX_BATCH_VOICES], delta_m1[MAX_BATCH_VOICES];
+    mopo_float delta_m2[MAX_BATCH_VOICES];
+    mopo_float ic1eq_a[MAX_BATCH_VOICES], ic2eq_a[MAX_BATCH_VOICES];
+
+    for (int v = 0; v < MAX_BATCH_VOICES; ++v) {
+      a1[v] = lanes->a1[v];
+      a2[v] = lanes->a2[v];
+      a3[v] = lanes->a3[v];
+      m0[v] = lanes->m0[v];
+      m1[v] = lanes->m1[v];
+      m2[v] = lanes->m2[v];
+      delta_m0[v] = lanes->delta_m0[v];
+      delta_m1[v] = lanes->delta_m1[v];
+      delta_m2[v] = lanes->delta_m2[v];
+      ic1eq_a[v] = lanes->ic1eq_a[v];
+      ic2eq_a[v] = lanes->ic2eq_a[v];
+    }
+
+    for (int i = 0; i < buffer_size; ++i) {
+      const mopo_float* audio_in = audio + i * MAX_BATCH_VOICES;
+      mopo_float* dest_out = dest + i * MAX_BATCH_VOICES;
+
+      VECTORIZE_LOOP
+      for (int v = 0; v < MAX_BATCH_VOICES; ++v) {
+        m0[v] += delta_m0[v];
+        m1[v] += delta_m1[v];
+        m2[v] += delta_m2[v];
+
+        mopo_float in = audio_in[v];
+
+        mopo_float v3_a = in - ic2eq_a[v];
+        mopo_float v1_a = a1[v] * ic1eq_a[v] + a2[v] * v3_a;
+        mopo_float v2_a = ic2eq_a[v] + a2[v] * ic1eq_a[v] + a3[v] * v3_a;
+        ic1eq_a[v] = 2.0 * v1_a - ic1eq_a[v];
+        ic2eq_a[v] = 2.0 * v2_a - ic2eq_a[v];
+
+        dest_out[v] = m0[v] * in + m1[v] * v1_a + m2[v] * v2_a;
+      }
+    }
+
+    for (int v = 0; v < MAX_BATCH_VOICES; ++v) {
+      lanes->m0[v] = m0[v];
+      lanes->m1[v] = m1[v];
+      lanes->m2[v] = m2[v];
+      lanes->ic1eq_a[v] = ic1eq_a[v];
+      lanes->ic2eq_a[v] = ic2eq_a[v];
+    }
+  }
+
+  void StateVariableFilter::process24dbLanes(Lanes* lanes, const mopo_float* audio,
+                                             mopo_float* dest, int buffer_size) {
+    mopo_float a1[MAX_BATCH_VOICES], a2[MAX_BATCH_VOICES], a3[MAX_BATCH_VOICES];
+    mopo_float m0[MAX_BATCH_VOICES], m1[MAX_BATCH_VOICES], m2[MAX_BATCH_VOICES];
+    mopo_float delta_m0[MAX_BATCH_VOICES], delta_m1[MAX_BATCH_VOICES];
+    mopo_float delta_m2[MAX_BATCH_VOICES];
+    mopo_float ic1eq_a[MAX_BATCH_VOICES], ic2eq_a[MAX_BATCH_VOICES];
+    mopo_float ic1eq_b[MAX_BATCH_VOICES], ic2eq_b[MAX_BATCH_VOICES];
+
+    for (int v = 0; v < MAX_BATCH_VOICES; ++v) {
+      a1[v] = lanes->a1[v];
+      a2[v] = lanes->a2[v];
+      a3[v] = lanes->a3[v];
+      m0[v] = lanes->m0[v];
+      m1[v] = lanes->m1[v];
+      m2[v] = lanes->m2[v];
+      delta_m0[v] = lanes->delta_m0[v];
+      delta_m1[v] = lanes->delta_m1[v];
+      delta_m2[v] = lanes->delta_m2[v];
+      ic1eq_a[v] = lanes->ic1eq_a[v];
+      ic2eq_a[v] = lanes->ic2eq_a[v];
+      ic1eq_b[v] = lanes->ic1eq_b[v];
+      ic2eq_b[v] = lanes->ic2eq_b[v];
+    }
+
+    for (int i = 0; i < buffer_size; ++i) {
+      const mopo_float* audio_in = audio + i * MAX_BATCH_VOICES;
+      mopo_float* dest_out = dest + i * MAX_BATCH_VOICES;
+
+      VECTORIZE_LOOP
+      for (int v = 0; v < MAX_BATCH_VOICES; ++v) {
+        m0[v] += delta_m0[v];
+        m1[v] += delta_m1[v];
+        m2[v] += delta_m2[v];
+
+        mopo_float in = audio_in[v];
+
+        mopo_float v3_a = in - ic2eq_a[v];
+        mopo_float v1_a = a1[v] * ic1eq_a[v] + a2[v] * v3_a;
+        mopo_float v2_a = ic2eq_a[v] + a2[v] * ic1eq_a[v] + a3[v] * v3_a;
+        ic1eq_a[v] = 2.0 * v1_a - ic1eq_a[v];
+        ic2eq_a[v] = 2.0 * v2_a - ic2eq_a[v];
+        mopo_float out_a = m0[v] * in + m1[v] * v1_a + m2[v] * v2_a;
+
+        mopo_float distort = utils::quickTanh(out_a);
+
+        mopo_float v3_b = distort - ic2eq_b[v];
+        mopo_float v1_b = a1[v] * ic1eq_b[v] + a2[v] * v3_b;
+        mopo_float v2_b = ic2eq_b[v] + a2[v] * ic1eq_b[v] + a3[v] * v3_b;
+        ic1eq_b[v] = 2.0 * v1_b - ic1eq_b[v];
+        ic2eq_b[v] = 2.0 * v2_b - ic2eq_b[v];
+
+        dest_out[v] = m0[v] * distort + m1[v] * v1_b + m2[v] * v2_b;
+      }
+    }
+
+    for (int v = 0; v < MAX_BATCH_VOICES; ++v) {
+      lanes->m0[v] = m0[v];
+      lanes->m1[v] = m1[v];
+      lanes->m2[v] = m2[v];
+      lanes->ic1eq_a[v] = ic1eq_a[v];
+      lanes->ic2eq_a[v] = ic2eq_a[v];
+      lanes->ic1eq_b[v] = ic1eq_b[v];
+      lanes->ic2eq_b[v] = ic2eq_b[v];
+    }
+  }
+
   void StateVariableFilter::processAllPass(const mopo_float* audio_buffer, mopo_float* dest) {
     reset();
     utils::copyBuffer(dest, audio_buffer, buffer_size_);
@@ -163,7 +393,7 @@ namespace mopo {
     if (db24)
       resonance = sqrt(resonance);
 
-    mopo_float g = tan(PI * utils::min(cutoff / sample_rate_, 0.5));
+    mopo_float g = tan(PI * utils::min(cutoff / sample_rate_, mopo_float(0.5)));
     mopo_float k = 1.0 / resonance;
 
     mopo_float low_pass_amount = sqrt(utils::clamp(1.0 - blend, 0.0, 1.0));
@@ -191,7 +421,7 @@ namespace mopo {
 
     gain = sqrt(gain);
 
-    mopo_float g = tan(PI * utils::min(cutoff / sample_rate_, 0.5));
+    mopo_float g = tan(PI * utils::min(cutoff / sample_rate_, mopo_float(0.5)));
     mopo_float k = 1.0;
 
     switch(choice) {
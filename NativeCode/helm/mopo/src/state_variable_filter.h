@@ -60,6 +60,13 @@ namespace mopo {
 
       virtual Processor* clone() const { return new StateVariableFilter(*this); }
       virtual void process();
+
+      // Voices are filtered together, one voice per lane, unless they reset
+      // or have the filter off this block.
+      virtual bool batchable() const { return true; }
+      virtual bool shouldBatch() const { return input(kOn)->at(0) != 0.0; }
+      virtual bool prepareBatch();
+      virtual void processBatch(Processor* const* clones, int num_clones);
       void process12db(const mopo_float* audio_buffer, mopo_float* dest);
       void process24db(const mopo_float* audio_buffer, mopo_float* dest);
       void processAllPass(const mopo_float* audio_buffer, mopo_float* dest);
@@ -77,8 +84,32 @@ namespace mopo {
       inline void tick24db(int i, mopo_float* dest, const mopo_float* audio_buffer);
 
     private:
+      // Reads the control inputs. Returns false if the filter is off.
+      bool updateCoefficients();
       void reset();
 
+      // The state of a batch of filters, one per lane.
+      struct Lanes {
+        mopo_float a1[MAX_BATCH_VOICES], a2[MAX_BATCH_VOICES], a3[MAX_BATCH_VOICES];
+        mopo_float m0[MAX_BATCH_VOICES], m1[MAX_BATCH_VOICES], m2[MAX_BATCH_VOICES];
+        mopo_float delta_m0[MAX_BATCH_VOICES], delta_m1[MAX_BATCH_VOICES];
+        mopo_float delta_m2[MAX_BATCH_VOICES];
+        mopo_float ic1eq_a[MAX_BATCH_VOICES], ic2eq_a[MAX_BATCH_VOICES];
+        mopo_float ic1eq_b[MAX_BATCH_VOICES], ic2eq_b[MAX_BATCH_VOICES];
+      };
+
+      void processLanes(StateVariableFilter* const* filters, int num_filters, bool db24);
+      static void process12dbLanes(Lanes* lanes, const mopo_float* audio,
+                                   mopo_float* dest, int buffer_size);
+      static void process24dbLanes(Lanes* lanes, const mopo_float* audio,
+                                   mopo_float* dest, int buffer_size);
+
+      const mopo_float* batch_audio_;
+      mopo_float* batch_dest_;
+      // Kept here instead of on the stack so the compiler leaves the lane
+      // loops packed rather than splitting every lane into scalars.
+      Lanes lanes_;
+
       mopo_float a1_, a2_, a3_;
       mopo_float m0_, m1_, m2_;
       mopo_float target_m0_, target_m1_, target_m2_;
@@ -26,7 +26,7 @@ namespace mopo {
       offset_(0.0), current_step_(0) { }
 
   void StepGenerator::process() {
-    static mopo_float integral;
+    mopo_float integral;
     unsigned int num_steps = static_cast<int>(input(kNumSteps)->at(0));
     num_steps = utils::iclamp(num_steps, 1, max_steps_);
 
@@ -47,7 +47,7 @@ namespace mopo {
   }
 
   void StepGenerator::correctToTime(mopo_float samples) {
-    static mopo_float integral;
+    mopo_float integral;
 
     unsigned int num_steps = static_cast<int>(input(kNumSteps)->at(0));
     num_steps = utils::iclamp(num_steps, 1, max_steps_);
@@ -25,7 +25,7 @@ namespace mopo {
     inline mopo_float computeAmplitude(mopo_float offset, mopo_float period, mopo_float softness) {
       mopo_float progress = offset / period;
       mopo_float phase_setup = std::fabs(utils::interpolate(-softness, softness, progress));
-      mopo_float phase = utils::clamp(phase_setup - softness + PI, 0.0, PI);
+      mopo_float phase = utils::clamp(phase_setup - softness + PI, mopo_float(0.0), PI);
       return 0.5 * cos(phase) + 0.5;
     }
   } // namespace
@@ -70,7 +70,7 @@ namespace mopo {
       stutter_period = last_stutter_period_;
     mopo_float stutter_period_diff = (end_stutter_period - stutter_period) / buffer_size_;
 
-    mopo_float read_softness = utils::max(input(kWindowSoftness)->at(0), MIN_SOFTNESS);
+    mopo_float read_softness = utils::max(input(kWindowSoftness)->at(0), mopo_float(MIN_SOFTNESS));
     mopo_float end_softness = PI * utils::max(1.0, 1.0 / read_softness);
 
     int buffer_size = buffer_size_;
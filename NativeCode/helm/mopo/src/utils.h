@@ -157,6 +157,28 @@ namespace mopo {
       return value <= EPSILON && value >= -EPSILON;
     }
 
+    // The random state of this thread, null to use rand(). Parallel voices give
+    // each set of voices a state of its own so they draw the same numbers no
+    // matter which thread renders them or what else calls rand().
+    inline unsigned int*& randomState() {
+      static thread_local unsigned int* state = 0;
+      return state;
+    }
+
+    // A random number in the range of rand().
+    inline int randomInt() {
+      unsigned int* state = randomState();
+      if (state == 0)
+        return rand();
+
+      unsigned int x = *state;
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      *state = x;
+      return x % (RAND_MAX + 1u);
+    }
+
     inline mopo_float gainToDb(mopo_float gain) {
       return DB_GAIN_CONVERSION_MULT * log10(gain);
     }
@@ -18,8 +18,17 @@
 
 #include "utils.h"
 
+#include <algorithm>
+#include <chrono>
+
 namespace mopo {
 
+  namespace {
+    // Voices only render on more than one thread once they take this long
+    // for a block, waking the other threads costs more than it saves below.
+    const long long MIN_PARALLEL_NANOSECONDS = 100000;
+  } // namespace
+
   Voice::Voice(Processor* processor) : event_sample_(-1),
       aftertouch_sample_(-1), aftertouch_(0.0), processor_(processor) {
     state_.event = kVoiceOff;
@@ -37,7 +46,18 @@ namespace mopo {
 
   VoiceHandler::VoiceHandler(size_t polyphony) :
       ProcessorRouter(kNumInputs, 0), polyphony_(0), sustain_(false),
-      legato_(false), voice_killer_(0), last_played_note_(-1.0) {
+      legato_(false), voice_killer_(0), last_played_note_(-1.0),
+      batch_split_(-1), batch_changes_(-1), batch_step_outputs_(0),
+      voice_workers_(0), voice_set_changes_(-1), voice_set_voices_(0),
+      voice_nanoseconds_(0) {
+    voice_outputs_[kVoiceEvent] = &voice_event_;
+    voice_outputs_[kNote] = &note_;
+    voice_outputs_[kLastNote] = &last_note_;
+    voice_outputs_[kNotePressed] = &note_pressed_;
+    voice_outputs_[kChannel] = &channel_;
+    voice_outputs_[kVelocity] = &velocity_;
+    voice_outputs_[kAftertouch] = &aftertouch_;
+
     pressed_notes_.reserve(MIDI_SIZE);
     all_voices_.reserve(MAX_POLYPHONY);
     free_voices_.reserve(MAX_POLYPHONY);
@@ -49,6 +69,7 @@ namespace mopo {
 }
 
   VoiceHandler::~VoiceHandler() {
+    clearVoiceSets();
     voice_router_.destroy();
     global_router_.destroy();
 
@@ -60,31 +81,28 @@ namespace mopo {
 
     for (auto& output : last_voice_outputs_)
       delete output.second;
+
+    clearBatch();
   }
 
-  void VoiceHandler::prepareVoiceTriggers(Voice* voice) {
-    note_.clearTrigger();
-    last_note_.clearTrigger();
-    note_pressed_.clearTrigger();
-    channel_.clearTrigger();
-    velocity_.clearTrigger();
-    voice_event_.clearTrigger();
-    aftertouch_.clearTrigger();
-    channel_.buffer[0] = voice->state().channel;
+  void VoiceHandler::prepareVoiceTriggers(Voice* voice, Output* const* outputs) {
+    for (int i = 0; i < kNumVoiceOutputs; ++i)
+      outputs[i]->clearTrigger();
+    outputs[kChannel]->buffer[0] = voice->state().channel;
 
     if (voice->hasNewEvent()) {
-      voice_event_.trigger(voice->state().event, voice->event_sample());
+      outputs[kVoiceEvent]->trigger(voice->state().event, voice->event_sample());
       if (voice->state().event == kVoiceOn) {
-        note_.trigger(voice->state().note, 0);
-        last_note_.trigger(voice->state().last_note, 0);
-        velocity_.trigger(voice->state().velocity, 0);
-        note_pressed_.trigger(voice->state().note_pressed, 0);
-        channel_.trigger(voice->state().channel, 0);
+        outputs[kNote]->trigger(voice->state().note, 0);
+        outputs[kLastNote]->trigger(voice->state().last_note, 0);
+        outputs[kVelocity]->trigger(voice->state().velocity, 0);
+        outputs[kNotePressed]->trigger(voice->state().note_pressed, 0);
+        outputs[kChannel]->trigger(voice->state().channel, 0);
       }
     }
 
     if (voice->hasNewAftertouch())
-      aftertouch_.trigger(voice->aftertouch(), voice->aftertouch_sample());
+      outputs[kAftertouch]->trigger(voice->aftertouch(), voice->aftertouch_sample());
 
     voice->clearEvents();
   }
@@ -125,6 +143,459 @@ namespace mopo {
     }
   }
 
+  void VoiceHandler::getReadLast(std::vector<const Output*>* read_last) const {
+    // Everything outside of the voices sees what the last voice wrote.
+    for (auto& output : last_voice_outputs_)
+      read_last->push_back(output.first);
+
+    std::vector<const Processor*> voice_processors;
+    voice_router_.collectProcessors(&voice_processors);
+    std::set<const Processor*> in_voice(voice_processors.begin(), voice_processors.end());
+
+    std::vector<const Processor*> processors;
+    getRootRouter()->collectProcessors(&processors);
+    for (const Processor* processor : processors) {
+      if (in_voice.count(processor))
+        continue;
+
+      for (int i = 0; i < processor->numInputs(); ++i) {
+        const Input* input = processor->input(i);
+        if (input && input->source)
+          read_last->push_back(input->source);
+      }
+    }
+  }
+
+  void VoiceHandler::compileBatch() {
+    clearBatch();
+    const ProcessorRouter* root = getRootRouter();
+    batch_changes_ = root->getTopologyChanges();
+
+    std::vector<const Output*> read_each;
+    for (auto& output : accumulated_outputs_)
+      read_each.push_back(output.first);
+    if (voice_killer_)
+      read_each.push_back(voice_killer_);
+
+    std::vector<const Output*> read_last;
+    getReadLast(&read_last);
+
+    std::vector<Output*> live;
+    std::set<const Output*> pinned;
+    batch_split_ = voice_router_.getBatchSplit(&live, &pinned, read_each, read_last);
+    if (batch_split_ < 0)
+      return;
+
+    // Our own outputs are set for each voice before any of its steps run.
+    live.insert(live.begin(), voice_outputs_, voice_outputs_ + kNumVoiceOutputs);
+    pinned.insert(voice_outputs_, voice_outputs_ + kNumVoiceOutputs);
+
+    for (Output* output : live) {
+      BatchOutput batch_output;
+      batch_output.output = output;
+      batch_output.buffer = output->buffer;
+      batch_output.control_rate = output->owner == nullptr || output->owner->isControlRate();
+      batch_output.pinned = pinned.count(output) > 0;
+      for (int i = 0; i < MAX_BATCH_VOICES; ++i)
+        batch_output.lanes[i] = new Output(output->buffer_size);
+      batch_outputs_.push_back(batch_output);
+    }
+
+    // The batched step's outputs are written last.
+    const Processor* batched = live.back()->owner;
+    batch_step_outputs_ = batch_outputs_.size();
+    while (batch_step_outputs_ && live[batch_step_outputs_ - 1]->owner == batched)
+      batch_step_outputs_--;
+  }
+
+  void VoiceHandler::clearBatch() {
+    for (BatchOutput& batch_output : batch_outputs_) {
+      for (int i = 0; i < MAX_BATCH_VOICES; ++i)
+        delete batch_output.lanes[i];
+    }
+    batch_outputs_.clear();
+    batch_split_ = -1;
+  }
+
+  void VoiceHandler::saveBatchOutputs(int lane, int start, int end) {
+    for (int i = start; i < end; ++i) {
+      const Output* output = batch_outputs_[i].output;
+      Output* copy = batch_outputs_[i].lanes[lane];
+      if (copy->buffer != output->buffer) {
+        int buffer_size = batch_outputs_[i].control_rate ? 1 : buffer_size_;
+        utils::copyBuffer(copy->buffer, output->buffer, buffer_size);
+      }
+      copy->triggered = output->triggered;
+      copy->trigger_offset = output->trigger_offset;
+      copy->trigger_value = output->trigger_value;
+    }
+  }
+
+  void VoiceHandler::loadBatchOutputs(int lane) {
+    // In the order they were written so aliased buffers end up with the last write.
+    int num_outputs = batch_outputs_.size();
+    for (int i = 0; i < num_outputs; ++i) {
+      Output* output = batch_outputs_[i].output;
+      const Output* copy = batch_outputs_[i].lanes[lane];
+      output->buffer = batch_outputs_[i].buffers[lane];
+      if (batch_outputs_[i].pinned) {
+        int buffer_size = batch_outputs_[i].control_rate ? 1 : buffer_size_;
+        utils::copyBuffer(output->buffer, copy->buffer, buffer_size);
+      }
+      output->triggered = copy->triggered;
+      output->trigger_offset = copy->trigger_offset;
+      output->trigger_value = copy->trigger_value;
+    }
+  }
+
+  bool VoiceHandler::shouldBatch() const {
+    if (batch_split_ < 0 || active_voices_.size() < 2)
+      return false;
+
+    Voice* voice = active_voices_.front();
+    ProcessorRouter* router = static_cast<ProcessorRouter*>(voice->processor());
+    return router->getStep(batch_split_)->shouldBatch();
+  }
+
+  void VoiceHandler::processBatches() {
+    int num_outputs = batch_outputs_.size();
+
+    auto iter = active_voices_.begin();
+    while (iter != active_voices_.end()) {
+      Voice* voices[MAX_BATCH_VOICES];
+      int num_voices = 0;
+      for (auto next = iter; next != active_voices_.end() && num_voices < MAX_BATCH_VOICES; ++next)
+        voices[num_voices++] = *next;
+
+      // Run every voice up to the batched step, each writing its own lane.
+      // Pinned outputs are written in place and copied to the lane after. The
+      // step prepares with every output moved to the lane, so it reads and
+      // writes the lane when it renders.
+      Processor* batched[MAX_BATCH_VOICES];
+      int num_batched = 0;
+      for (int v = 0; v < num_voices; ++v) {
+        ProcessorRouter* router = static_cast<ProcessorRouter*>(voices[v]->processor());
+        for (BatchOutput& batch_output : batch_outputs_) {
+          if (!batch_output.pinned)
+            batch_output.output->buffer = batch_output.lanes[v]->buffer;
+        }
+
+        prepareVoiceTriggers(voices[v], voice_outputs_);
+        router->processHead(batch_split_);
+        for (BatchOutput& batch_output : batch_outputs_)
+          batch_output.buffers[v] = batch_output.output->buffer;
+        saveBatchOutputs(v, 0, batch_step_outputs_);
+
+        if (router->stepEnabled(batch_split_)) {
+          for (BatchOutput& batch_output : batch_outputs_)
+            batch_output.output->buffer = batch_output.lanes[v]->buffer;
+
+          Processor* step = router->getStep(batch_split_);
+          if (step->prepareBatch())
+            batched[num_batched++] = step;
+          saveBatchOutputs(v, batch_step_outputs_, num_outputs);
+
+          for (BatchOutput& batch_output : batch_outputs_)
+            batch_output.output->buffer = batch_output.buffers[v];
+        }
+        else
+          saveBatchOutputs(v, batch_step_outputs_, num_outputs);
+      }
+
+      if (num_batched)
+        batched[0]->processBatch(batched, num_batched);
+
+      for (int v = 0; v < num_voices; ++v) {
+        ProcessorRouter* router = static_cast<ProcessorRouter*>(voices[v]->processor());
+        loadBatchOutputs(v);
+        router->processTail(batch_split_);
+        accumulateOutputs();
+
+        if (voice_killer_ && voices[v]->state().event != kVoiceOn &&
+            utils::isSilent(voice_killer_->buffer, buffer_size_)) {
+          free_voices_.push_back(voices[v]);
+          iter = active_voices_.erase(iter);
+        }
+        else
+          iter++;
+      }
+    }
+
+    for (BatchOutput& batch_output : batch_outputs_) {
+      if (!batch_output.pinned)
+        batch_output.output->buffer = batch_output.buffer;
+    }
+  }
+
+  void VoiceHandler::setVoiceWorkers(VoiceWorkers* workers) {
+    clearVoiceSets();
+    voice_workers_ = workers;
+    voice_set_changes_ = -1;
+    voice_nanoseconds_ = 0;
+  }
+
+  void VoiceHandler::compileVoiceSets() {
+    clearVoiceSets();
+    voice_set_changes_ = getRootRouter()->getTopologyChanges();
+    voice_set_voices_ = all_voices_.size();
+
+    // Everything the voices write, our own outputs are written for each voice.
+    std::vector<const Processor*> processors;
+    voice_router_.collectProcessors(&processors);
+    std::vector<Output*> originals(voice_outputs_, voice_outputs_ + kNumVoiceOutputs);
+    std::set<const Output*> written(originals.begin(), originals.end());
+    for (const Processor* processor : processors) {
+      for (int i = 0; i < processor->numOutputs(); ++i) {
+        Output* output = processor->output(i);
+        if (output && written.insert(output).second)
+          originals.push_back(output);
+      }
+    }
+
+    // Gates and switches outside the voices can point at a voice's buffer,
+    // each set needs its own copy to point at its copy of that buffer.
+    std::vector<const Output*> outside_aliases;
+    for (const Processor* processor : processors) {
+      for (int i = 0; i < processor->numInputs(); ++i) {
+        const Output* source = processor->input(i)->source;
+        if (source && source->owner && source->owner->aliasesInputs() &&
+            written.insert(source).second)
+          outside_aliases.push_back(source);
+      }
+    }
+
+    std::vector<const Output*> read_last_list;
+    getReadLast(&read_last_list);
+    std::set<const Output*> read_last(read_last_list.begin(), read_last_list.end());
+
+    int num_sets = std::min<int>(voice_workers_->numThreads() + 1, MAX_POLYPHONY);
+    for (int s = 0; s < num_sets; ++s) {
+      VoiceSet* set = new VoiceSet();
+      set->handler = this;
+      set->random_state = 2654435761u * (s + 1);
+      set->nanoseconds = 0;
+      set->next_voice = 0;
+      set->voices.reserve(MAX_POLYPHONY);
+      set->silent.reserve(MAX_POLYPHONY);
+      voice_sets_.push_back(set);
+
+      if (s == 0) {
+        std::copy(voice_outputs_, voice_outputs_ + kNumVoiceOutputs, set->voice_outputs);
+        set->voice_killer = voice_killer_;
+        for (auto& output : accumulated_outputs_) {
+          set->totals.push_back(std::pair<const Output*, mopo_float*>(output.first,
+                                                                      output.second->buffer));
+        }
+        continue;
+      }
+
+      for (Output* original : originals) {
+        bool aliases = original->owner && original->owner->aliasesInputs();
+        Output* copy = new Output(original->buffer_size);
+        copy->owner = original->owner;
+        if (!aliases)
+          utils::copyBuffer(copy->buffer, original->buffer, original->buffer_size);
+        copy->triggered = original->triggered;
+        copy->trigger_offset = original->trigger_offset;
+        copy->trigger_value = original->trigger_value;
+        set->outputs[original] = copy;
+        set->copies.push_back(std::pair<Output*, mopo_float*>(copy, copy->buffer));
+
+        // Gates and switches point at an input, copying into them would write that.
+        if (read_last.count(original) && !aliases)
+          set->read_last.push_back(std::pair<Output*, const Output*>(original, copy));
+      }
+
+      for (const Output* original : outside_aliases) {
+        Output* copy = new Output(original->buffer_size);
+        copy->owner = original->owner;
+        set->outputs[original] = copy;
+        set->copies.push_back(std::pair<Output*, mopo_float*>(copy, copy->buffer));
+        set->outside_aliases.push_back(std::pair<Output*, const Output*>(copy, original));
+      }
+
+      for (int i = 0; i < kNumVoiceOutputs; ++i)
+        set->voice_outputs[i] = set->outputs[voice_outputs_[i]];
+
+      OutputMap::iterator killer = set->outputs.find(voice_killer_);
+      set->voice_killer = killer == set->outputs.end() ? voice_killer_ : killer->second;
+
+      for (auto& output : accumulated_outputs_) {
+        OutputMap::iterator copy = set->outputs.find(output.first);
+        const Output* source = copy == set->outputs.end() ? output.first : copy->second;
+        set->totals.push_back(std::pair<const Output*, mopo_float*>(source,
+                                                                    new mopo_float[MAX_BUFFER_SIZE]));
+      }
+    }
+
+    // Switches in the voices copy the buffer their input points at now.
+    for (VoiceSet* set : voice_sets_)
+      pointOutsideAliases(set);
+
+    busy_voice_sets_.reserve(num_sets);
+    for (int i = 0; i < voice_set_voices_; ++i) {
+      VoiceSet* set = voice_sets_[i % num_sets];
+      voice_set_lookup_[all_voices_[i]] = set;
+      if (set != voice_sets_[0])
+        all_voices_[i]->processor()->separate(set->outputs);
+    }
+  }
+
+  void VoiceHandler::clearVoiceSets() {
+    for (Voice* voice : all_voices_)
+      voice->processor()->rejoin();
+
+    for (VoiceSet* set : voice_sets_) {
+      if (set != voice_sets_[0]) {
+        for (auto& total : set->totals)
+          delete[] total.second;
+      }
+      for (auto& copy : set->copies) {
+        copy.first->buffer = copy.second;
+        delete copy.first;
+      }
+      delete set;
+    }
+
+    voice_sets_.clear();
+    voice_set_lookup_.clear();
+    voice_set_voices_ = 0;
+  }
+
+  void VoiceHandler::renderVoiceSet(void* set) {
+    VoiceSet* voice_set = static_cast<VoiceSet*>(set);
+    voice_set->handler->renderVoices(voice_set);
+  }
+
+  void VoiceHandler::pointOutsideAliases(VoiceSet* set) {
+    for (auto& alias : set->outside_aliases) {
+      Output* copy = alias.first;
+      const Output* original = alias.second;
+      copy->buffer = original->buffer;
+      copy->triggered = original->triggered;
+      copy->trigger_offset = original->trigger_offset;
+      copy->trigger_value = original->trigger_value;
+
+      const Processor* owner = original->owner;
+      for (int i = 0; i < owner->numInputs(); ++i) {
+        const Output* source = owner->input(i)->source;
+        if (!source || source->buffer != original->buffer)
+          continue;
+
+        OutputMap::const_iterator mapped = set->outputs.find(source);
+        if (mapped != set->outputs.end())
+          copy->buffer = mapped->second->buffer;
+        break;
+      }
+    }
+  }
+
+  void VoiceHandler::renderVoices(VoiceSet* set) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    utils::randomState() = &set->random_state;
+    pointOutsideAliases(set);
+
+    int num_voices = set->voices.size();
+    set->silent.resize(num_voices);
+    for (int v = 0; v < num_voices; ++v) {
+      Voice* voice = set->voices[v];
+      prepareVoiceTriggers(voice, set->voice_outputs);
+      processVoice(voice);
+
+      for (auto& total : set->totals) {
+        int buffer_size = total.first->owner->getBufferSize();
+        mopo_float* dest = total.second;
+        const mopo_float* source = total.first->buffer;
+
+        VECTORIZE_LOOP
+        for (int i = 0; i < buffer_size; ++i)
+          dest[i] += source[i];
+      }
+
+      set->silent[v] = set->voice_killer && voice->state().event != kVoiceOn &&
+                       utils::isSilent(set->voice_killer->buffer, buffer_size_);
+    }
+
+    utils::randomState() = 0;
+    std::chrono::steady_clock::duration time = std::chrono::steady_clock::now() - start;
+    set->nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+  }
+
+  void VoiceHandler::processVoiceSets() {
+    VoiceSet* first = voice_sets_[0];
+    for (VoiceSet* set : voice_sets_) {
+      set->voices.clear();
+      set->next_voice = 0;
+      set->nanoseconds = 0;
+      if (set != first) {
+        for (auto& total : set->totals)
+          utils::zeroBuffer(total.second, MAX_BUFFER_SIZE);
+      }
+    }
+
+    for (Voice* voice : active_voices_)
+      voice_set_lookup_[voice]->voices.push_back(voice);
+
+    busy_voice_sets_.clear();
+    for (VoiceSet* set : voice_sets_) {
+      if (set->voices.size())
+        busy_voice_sets_.push_back(set);
+    }
+
+    // What the voices cost last time decides if they're worth spreading out.
+    int num_voices = active_voices_.size();
+    int num_busy = busy_voice_sets_.size();
+    bool parallel = num_busy > 1 && voice_nanoseconds_ * num_voices >= MIN_PARALLEL_NANOSECONDS;
+    if (!parallel || !voice_workers_->run(renderVoiceSet, busy_voice_sets_.data(), num_busy)) {
+      for (void* set : busy_voice_sets_)
+        renderVoiceSet(set);
+    }
+
+    long long nanoseconds = 0;
+    for (VoiceSet* set : voice_sets_)
+      nanoseconds += set->nanoseconds;
+    voice_nanoseconds_ = nanoseconds / num_voices;
+
+    // Sums in set order so the output is the same whichever thread ran them.
+    int num_totals = accumulated_outputs_.size();
+    for (VoiceSet* set : voice_sets_) {
+      if (set == first || set->voices.empty())
+        continue;
+
+      for (int t = 0; t < num_totals; ++t) {
+        int buffer_size = first->totals[t].first->owner->getBufferSize();
+        mopo_float* dest = first->totals[t].second;
+        const mopo_float* source = set->totals[t].second;
+
+        VECTORIZE_LOOP
+        for (int i = 0; i < buffer_size; ++i)
+          dest[i] += source[i];
+      }
+    }
+
+    VoiceSet* last = voice_set_lookup_[active_voices_.back()];
+    for (auto& output : last->read_last) {
+      Output* dest = output.first;
+      const Output* source = output.second;
+      utils::copyBuffer(dest->buffer, source->buffer, std::min(source->buffer_size, buffer_size_));
+      dest->triggered = source->triggered;
+      dest->trigger_offset = source->trigger_offset;
+      dest->trigger_value = source->trigger_value;
+    }
+
+    // Remove voices with a full silent buffer in the order they are active.
+    auto iter = active_voices_.begin();
+    while (iter != active_voices_.end()) {
+      VoiceSet* set = voice_set_lookup_[*iter];
+      if (set->silent[set->next_voice++]) {
+        free_voices_.push_back(*iter);
+        iter = active_voices_.erase(iter);
+      }
+      else
+        iter++;
+    }
+  }
+
   bool VoiceHandler::shouldAccumulate(Output* output) {
     return !output->owner->isControlRate();
   }
@@ -147,10 +618,36 @@ namespace mopo {
     setPolyphony(utils::iclamp(polyphony, 1, polyphony));
     clearAccumulatedOutputs();
 
+    int topology_changes = getRootRouter()->getTopologyChanges();
+    if (voice_workers_) {
+      // Voice sets don't batch, batched steps write one set of lanes.
+      if (voice_set_changes_ != topology_changes ||
+          voice_set_voices_ != static_cast<int>(all_voices_.size())) {
+        compileVoiceSets();
+      }
+      processVoiceSets();
+    }
+    else {
+      if (batch_changes_ != topology_changes)
+        compileBatch();
+
+      if (shouldBatch())
+        processBatches();
+      else
+        processVoices();
+    }
+
+    if (active_voices_.size())
+      writeNonaccumulatedOutputs();
+
+    last_num_voices_ = num_voices;
+  }
+
+  void VoiceHandler::processVoices() {
     auto iter = active_voices_.begin();
     while (iter != active_voices_.end()) {
       Voice* voice = *iter;
-      prepareVoiceTriggers(voice);
+      prepareVoiceTriggers(voice, voice_outputs_);
       processVoice(voice);
       accumulateOutputs();
 
@@ -163,11 +660,6 @@ namespace mopo {
       else
         iter++;
     }
-
-    if (active_voices_.size())
-      writeNonaccumulatedOutputs();
-
-    last_num_voices_ = num_voices;
   }
 
   void VoiceHandler::setSampleRate(int sample_rate) {
@@ -388,6 +880,7 @@ namespace mopo {
   Output* VoiceHandler::registerOutput(Output* output) {
     Output* new_output = new Output();
     new_output->owner = this;
+    batch_changes_ = -1;
     ProcessorRouter::registerOutput(new_output);
     if (shouldAccumulate(output))
       accumulated_outputs_[output] = new_output;
@@ -405,6 +898,20 @@ namespace mopo {
     return processor == &voice_router_;
   }
 
+  void VoiceHandler::collectProcessors(
+      std::vector<const Processor*>* processors) const {
+    ProcessorRouter::collectProcessors(processors);
+    voice_router_.collectProcessors(processors);
+    global_router_.collectProcessors(processors);
+  }
+
+  const ProcessorRouter* VoiceHandler::getRootRouter() const {
+    const ProcessorRouter* root = this;
+    while (root->router())
+      root = root->router();
+    return root;
+  }
+
   Voice* VoiceHandler::createVoice() {
     return new Voice(voice_router_.clone());
   }
@@ -25,6 +25,7 @@
 
 #include <map>
 #include <list>
+#include <vector>
 
 namespace mopo {
 
@@ -118,6 +119,20 @@ namespace mopo {
       Processor* processor_;
   };
 
+  // Threads a VoiceHandler can render voices on. _run_ calls _job_ with each
+  // of _items_ and returns once they have all finished, the calling thread
+  // may run some of them itself. Returns false without running any if the
+  // threads are busy, the caller then has to run them.
+  class VoiceWorkers {
+    public:
+      typedef void (*Job)(void* item);
+
+      virtual ~VoiceWorkers() { }
+
+      virtual int numThreads() const = 0;
+      virtual bool run(Job job, void* const* items, int num_items) = 0;
+  };
+
   class VoiceHandler : public virtual ProcessorRouter, public NoteHandler {
     public:
       enum Inputs {
@@ -172,8 +187,15 @@ namespace mopo {
 
       void setPolyphony(size_t polyphony);
 
+      // Splits the voices into a set for each of the _workers_ threads and
+      // one for this thread. Sets render on their own thread once the voices
+      // take long enough to be worth it. Null renders them in order here.
+      void setVoiceWorkers(VoiceWorkers* workers);
+
       void setVoiceKiller(const Output* killer) {
         voice_killer_ = killer;
+        batch_changes_ = -1;
+        voice_set_changes_ = -1;
       }
 
       void setLegato(bool legato) {
@@ -185,22 +207,88 @@ namespace mopo {
       }
 
       bool isPolyphonic(const Processor* processor) const override;
+      virtual void collectProcessors(
+          std::vector<const Processor*>* processors) const override;
 
     protected:
       virtual bool shouldAccumulate(Output* output);
 
     private:
+      enum VoiceOutputs {
+        kVoiceEvent,
+        kNote,
+        kLastNote,
+        kNotePressed,
+        kChannel,
+        kVelocity,
+        kAftertouch,
+        kNumVoiceOutputs
+      };
+
+      // Voices that render together on one thread. Each set after the first
+      // separates its voices onto copies of every Output written in the voice
+      // graph and sums what they accumulate on its own. The first set uses
+      // the original Outputs.
+      struct VoiceSet {
+        VoiceHandler* handler;
+        OutputMap outputs;
+        // The copies in _outputs_ with their own buffers, Gates point them elsewhere.
+        std::vector<std::pair<Output*, mopo_float*>> copies;
+        Output* voice_outputs[kNumVoiceOutputs];
+        const Output* voice_killer;
+        // Each accumulated Output with the buffer this set sums it in.
+        std::vector<std::pair<const Output*, mopo_float*>> totals;
+        // Outputs read after the last voice with the copy this set writes.
+        std::vector<std::pair<Output*, const Output*>> read_last;
+        // Copies of Gates and switches outside the voices with what they follow.
+        std::vector<std::pair<Output*, const Output*>> outside_aliases;
+        std::vector<Voice*> voices;
+        std::vector<char> silent;
+        int next_voice;
+        unsigned int random_state;
+        long long nanoseconds;
+      };
+
+      // An Output that is live across the batched step, with a lane for each
+      // voice in the batch. Voices write to and read from their lane in place
+      // of the shared buffer unless the Output is pinned, then the lane holds
+      // a copy.
+      struct BatchOutput {
+        Output* output;
+        mopo_float* buffer;
+        bool control_rate;
+        bool pinned;
+        Output* lanes[MAX_BATCH_VOICES];
+        // Where _output_ pointed after each voice, Gates can point elsewhere.
+        mopo_float* buffers[MAX_BATCH_VOICES];
+      };
+
       VoiceHandler() { }
 
       Voice* grabVoice();
       Voice* getVoiceToKill();
       Voice* createVoice();
-      void prepareVoiceTriggers(Voice* voice);
+      void prepareVoiceTriggers(Voice* voice, Output* const* outputs);
       void processVoice(Voice* voice);
+      void processVoices();
       void clearAccumulatedOutputs();
       void clearNonaccumulatedOutputs();
       void accumulateOutputs();
       void writeNonaccumulatedOutputs();
+      const ProcessorRouter* getRootRouter() const;
+      void getReadLast(std::vector<const Output*>* read_last) const;
+      void compileBatch();
+      void clearBatch();
+      bool shouldBatch() const;
+      void processBatches();
+      void saveBatchOutputs(int lane, int start, int end);
+      void loadBatchOutputs(int lane);
+      void compileVoiceSets();
+      void clearVoiceSets();
+      void processVoiceSets();
+      void pointOutsideAliases(VoiceSet* set);
+      void renderVoices(VoiceSet* set);
+      static void renderVoiceSet(void* set);
 
       size_t polyphony_;
       bool sustain_;
@@ -211,6 +299,24 @@ namespace mopo {
       mopo_float last_played_note_;
       int last_num_voices_;
 
+      // Voices run in batches around the first batchable step of the voice
+      // graph, if it has one. The batched step's own outputs come last in
+      // batch_outputs_, starting at batch_step_outputs_.
+      int batch_split_;
+      int batch_changes_;
+      int batch_step_outputs_;
+      std::vector<BatchOutput> batch_outputs_;
+
+      // Voice i of all_voices_ is in set i % voice_sets_.size(). Sets are
+      // rebuilt when the topology or the number of voices changes.
+      VoiceWorkers* voice_workers_;
+      int voice_set_changes_;
+      int voice_set_voices_;
+      long long voice_nanoseconds_;
+      std::vector<VoiceSet*> voice_sets_;
+      std::vector<void*> busy_voice_sets_;
+      std::map<const Voice*, VoiceSet*> voice_set_lookup_;
+
       Output voice_event_;
       Output note_;
       Output last_note_;
@@ -218,6 +324,7 @@ namespace mopo {
       Output channel_;
       Output velocity_;
       Output aftertouch_;
+      Output* voice_outputs_[kNumVoiceOutputs];
 
       CircularQueue<mopo_float> pressed_notes_;
       CircularQueue<Voice*> all_voices_;
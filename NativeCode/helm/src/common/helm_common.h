@@ -210,7 +210,7 @@ namespace mopo {
     ModulationConnection() : ModulationConnection("", "") { }
 
     ModulationConnection(std::string from, std::string to) :
-        source(from), destination(to) {
+        source(from), destination(to), source_index(-1), destination_index(-1) {
     }
 
     ~ModulationConnection() {
@@ -221,11 +221,17 @@ namespace mopo {
     void resetConnection(const std::string& from, const std::string& to) {
       source = from;
       destination = to;
+      source_index = -1;
+      destination_index = -1;
       modulation_scale.router(nullptr);
     }
 
     std::string source;
     std::string destination;
+
+    // Indices into the HelmEngine modulation tables. -1 means look them up by name.
+    int source_index;
+    int destination_index;
     cr::Value amount;
     cr::Multiply modulation_scale;
   };
@@ -277,6 +283,10 @@ namespace mopo {
         return parameter_list[index];
       }
 
+      int getNumParameters() const {
+        return details_lookup_.size();
+      }
+
       std::map<std::string, ValueDetails> getAllDetails() const {
         return details_lookup_;
       }
@@ -18,5 +18,519 @@
 
 namespace mopo {
 
-  const DetuneLookupSingleton DetuneLookup::lookup_;
+  // Generated by tables/helm_tables.cpp, regenerate with make -f Makefile.tables generate.
+  const mopo_float DetuneLookup::lookup_[DETUNE_LOOKUP_RESOLUTION + 2] = {
+    0.94387431268169353, 0.94392760873003723, 0.94398090778775268, 0.94403420985500996,
+    0.94408751493197895, 0.94414082301882962, 0.94419413411573183, 0.94424744822285556,
+    0.94430076534037088, 0.94435408546844757, 0.94440740860725592, 0.94446073475696568,
+    0.94451406391774695, 0.94456739608976981, 0.94462073127320423, 0.94467406946822019,
+    0.94472741067498778, 0.94478075489367719, 0.94483410212445829, 0.94488745236750127,
+    0.94494080562297622, 0.94499416189105323, 0.94504752117190238, 0.94510088346569376,
+    0.94515424877259746, 0.94520761709278389, 0.94526098842642281, 0.94531436277368464,
+    0.94536774013473945, 0.94542112050975746, 0.94547450389890886, 0.94552789030236373,
+    0.94558127972029238, 0.9456346721528649, 0.9456880676002517, 0.94574146606262299,
+    0.94579486754014885, 0.94584827203299959, 0.94590167954134552, 0.94595509006535694,
+    0.94600850360520405, 0.94606192016105717, 0.94611533973308659, 0.94616876232146263,
+    0.94622218792635571, 0.9462756165479359, 0.94632904818637387, 0.94638248284183968,
+    0.94643592051450376, 0.94648936120453664, 0.94654280491210852, 0.94659625163738981,
+    0.94664970138055093, 0.94670315414176232, 0.94675660992119437, 0.94681006871901741,
+    0.94686353053540206, 0.94691699537051865, 0.9469704632245376, 0.94702393409762953,
+    0.94707740798996465, 0.94713088490171371, 0.94718436483304713, 0.94723784778413522,
+    0.94729133375514873, 0.94734482274625809, 0.94739831475763392, 0.94745180978944654,
+    0.94750530784186671, 0.94755880891506483, 0.94761231300921156, 0.94766582012447753,
+    0.94771933026103328, 0.94777284341904933, 0.94782635959869643, 0.94787987880014501,
+    0.94793340102356582, 0.94798692626912962, 0.9480404545370068, 0.94809398582736815,
+    0.94814752014038428, 0.94820105747622596, 0.94825459783506383, 0.94830814121706852,
+    0.9483616876224108, 0.94841523705126141, 0.94846878950379099, 0.9485223449801703,
+    0.94857590348057019, 0.94862946500516121, 0.94868302955411432, 0.94873659712760006,
+    0.9487901677257895, 0.94884374134885319, 0.94889731799696209, 0.94895089767028695,
+    0.94900448036899854, 0.9490580660932677, 0.94911165484326532, 0.94916524661916224,
+    0.94921884142112933, 0.94927243924933735, 0.94932604010395738, 0.94937964398516006,
+    0.94943325089311648, 0.94948686082799749, 0.94954047378997397, 0.94959408977921689,
+    0.94964770879589722, 0.94970133084018582, 0.94975495591225367, 0.94980858401227164,
+    0.94986221514041091, 0.94991584929684236, 0.94996948648173696, 0.95002312669526578,
+    0.95007676993759971, 0.95013041620890992, 0.95018406550936729, 0.95023771783914301,
+    0.95029137319840795, 0.95034503158733341, 0.95039869300609026, 0.95045235745484968,
+    0.95050602493378278, 0.95055969544306051, 0.9506133689828542, 0.95066704555333481,
+    0.95072072515467343, 0.95077440778704136, 0.9508280934506097, 0.95088178214554953,
+    0.95093547387203203, 0.95098916863022842, 0.95104286642030977, 0.95109656724244751,
+    0.95115027109681272, 0.95120397798357648, 0.95125768790291032, 0.95131140085498522,
+    0.95136511683997249, 0.95141883585804332, 0.95147255790936913, 0.95152628299412112,
+    0.95158001111247059, 0.95163374226458874, 0.951687476450647, 0.95174121367081665,
+    0.95179495392526892, 0.9518486972141752, 0.95190244353770681, 0.95195619289603528,
+    0.95200994528933169, 0.95206370071776758, 0.95211745918151425, 0.95217122068074311,
+    0.95222498521562571, 0.95227875278633323, 0.9523325233930372, 0.95238629703590894,
+    0.95244007371512007, 0.95249385343084192, 0.952547636183246, 0.95260142197250375,
+    0.95265521079878668, 0.95270900266226621, 0.95276279756311388, 0.95281659550150122,
+    0.95287039647759963, 0.95292420049158078, 0.95297800754361606, 0.95303181763387723,
+    0.95308563076253561, 0.95313944692976282, 0.95319326613573063, 0.95324708838061034,
+    0.9533009136645737, 0.95335474198779235, 0.95340857335043772, 0.95346240775268165,
+    0.95351624519469558, 0.95357008567665136, 0.95362392919872041, 0.9536777757610746,
+    0.95373162536388545, 0.95378547800732461, 0.95383933369156404, 0.95389319241677506,
+    0.95394705418312975, 0.95400091899079953, 0.95405478683995626, 0.95410865773077169,
+    0.95416253166341758, 0.95421640863806556, 0.95427028865488761, 0.95432417171405526,
+    0.95437805781574048, 0.95443194696011502, 0.95448583914735063, 0.9545397343776193,
+    0.95459363265109254, 0.95464753396794255, 0.95470143832834087, 0.95475534573245957,
+    0.9548092561804703, 0.95486316967254514, 0.95491708620885596, 0.9549710057895745,
+    0.95502492841487274, 0.95507885408492266, 0.95513278279989611, 0.95518671455996496,
+    0.95524064936530129, 0.95529458721607696, 0.95534852811246407, 0.95540247205463436,
+    0.95545641904276002, 0.95551036907701292, 0.95556432215756504, 0.95561827828458845,
+    0.95567223745825525, 0.95572619967873729, 0.95578016494620677, 0.95583413326083566,
+    0.95588810462279605, 0.95594207903225992, 0.95599605648939945, 0.95605003699438673,
+    0.95610402054739374, 0.95615800714859278, 0.95621199679815572, 0.95626598949625496,
+    0.95631998524306239, 0.95637398403875029, 0.95642798588349076, 0.9564819907774561,
+    0.95653599872081829, 0.95659000971374963, 0.95664402375642221, 0.95669804084900845,
+    0.95675206099168031, 0.95680608418461022, 0.95686011042797026, 0.95691413972193273,
+    0.95696817206666995, 0.95702220746235411, 0.95707624590915741, 0.95713028740725226,
+    0.95718433195681096, 0.95723837955800573, 0.95729243021100885, 0.95734648391599275,
+    0.95740054067312974, 0.95745460048259212, 0.95750866334455231, 0.95756272925918251,
+    0.95761679822665524, 0.95767087024714281, 0.95772494532081764, 0.95777902344785215,
+    0.95783310462841864, 0.95788718886268964, 0.95794127615083757, 0.95799536649303485,
+    0.95804945988945389, 0.95810355634026723, 0.95815765584564727, 0.95821175840576645,
+    0.95826586402079739, 0.9583199726909124, 0.95837408441628413, 0.95842819919708511,
+    0.95848231703348774, 0.95853643792566467, 0.95859056187378833, 0.95864468887803145,
+    0.95869881893856634, 0.95875295205556588, 0.95880708822920246, 0.95886122745964864,
+    0.95891536974707714, 0.95896951509166051, 0.95902366349357138, 0.9590778149529825,
+    0.95913196947006629, 0.95918612704499551, 0.95924028767794289, 0.95929445136908109,
+    0.95934861811858263, 0.95940278792662037, 0.95945696079336695, 0.95951113671899502,
+    0.95956531570367742, 0.95961949774758692, 0.95967368285089605, 0.95972787101377766,
+    0.95978206223640461, 0.95983625651894955, 0.95989045386158522, 0.9599446542644845,
+    0.95999885772782023, 0.96005306425176518, 0.96010727383649208, 0.96016148648217381,
+    0.96021570218898333, 0.96026992095709329, 0.96032414278667655, 0.96037836767790619,
+    0.96043259563095496, 0.96048682664599572, 0.96054106072320133, 0.96059529786274478,
+    0.96064953806479902, 0.96070378132953682, 0.96075802765713125, 0.96081227704775529,
+    0.9608665295015818, 0.96092078501878364, 0.96097504359953401, 0.96102930524400587,
+    0.96108356995237199, 0.96113783772480554, 0.96119210856147963, 0.96124638246256711,
+    0.96130065942824094, 0.96135493945867445, 0.96140922255404049, 0.96146350871451214,
+    0.96151779794026249, 0.96157209023146462, 0.96162638558829172, 0.96168068401091678,
+    0.96173498549951286, 0.96178929005425318, 0.9618435976753108, 0.96189790836285904,
+    0.96195222211707077, 0.96200653893811938, 0.96206085882617787, 0.96211518178141953,
+    0.96216950780401755, 0.96222383689414515, 0.96227816905197538, 0.96233250427768169,
+    0.96238684257143714, 0.96244118393341493, 0.96249552836378849, 0.96254987586273089,
+    0.96260422643041554, 0.96265858006701566, 0.96271293677270453, 0.96276729654765547,
+    0.96282165939204178, 0.96287602530603678, 0.96293039428981375, 0.96298476634354602,
+    0.9630391414674071, 0.96309351966157009, 0.96314790092620861, 0.96320228526149587,
+    0.96325667266760517, 0.96331106314471016, 0.96336545669298412, 0.96341985331260049,
+    0.96347425300373257, 0.963528655766554, 0.96358306160123797, 0.96363747050795812,
+    0.96369188248688797, 0.96374629753820085, 0.96380071566207015, 0.96385513685866964,
+    0.96390956112817261, 0.96396398847075271, 0.96401841888658335, 0.96407285237583806,
+    0.96412728893869049, 0.96418172857531415, 0.96423617128588246, 0.96429061707056918,
+    0.96434506592954783, 0.96439951786299205, 0.96445397287107526, 0.96450843095397132,
+    0.96456289211185364, 0.96461735634489587, 0.96467182365327175, 0.96472629403715493,
+    0.96478076749671904, 0.96483524403213772, 0.96488972364358461, 0.96494420633123357,
+    0.96499869209525813, 0.96505318093583203, 0.96510767285312893, 0.96516216784732278,
+    0.96521666591858712, 0.9652711670670957, 0.96532567129302238, 0.96538017859654091,
+    0.96543468897782503, 0.9654892024370485, 0.96554371897438507, 0.96559823859000871,
+    0.96565276128409316, 0.96570728705681219, 0.96576181590833965, 0.96581634783884951,
+    0.96587088284851541, 0.96592542093751144, 0.96597996210601134, 0.96603450635418897,
+    0.96608905368221842, 0.96614360409027333, 0.96619815757852778, 0.96625271414715563,
+    0.96630727379633086, 0.96636183652622742, 0.9664164023370192, 0.96647097122888015,
+    0.96652554320198436, 0.96658011825650569, 0.96663469639261823, 0.96668927761049595,
+    0.96674386191031281, 0.9667984492922429, 0.9668530397564602, 0.96690763330313878,
+    0.96696222993245273, 0.96701682964457603, 0.96707143243968285, 0.96712603831794719,
+    0.96718064727954312, 0.96723525932464482, 0.96728987445342629, 0.96734449266606182,
+    0.96739911396272549, 0.96745373834359127, 0.96750836580883348, 0.9675629963586263,
+    0.96761762999314382, 0.96767226671256024, 0.96772690651704962, 0.9677815494067864,
+    0.96783619538194465, 0.96789084444269868, 0.96794549658922258, 0.96800015182169075,
+    0.96805481014027728, 0.96810947154515647, 0.96816413603650264, 0.96821880361448998,
+    0.968273474279293, 0.96832814803108569, 0.96838282487004257, 0.96843750479633794,
+    0.96849218781014601, 0.96854687391164118, 0.96860156310099788, 0.9686562553783904,
+    0.96871095074399294, 0.96876564919798014, 0.9688203507405263, 0.96887505537180585,
+    0.96892976309199308, 0.96898447390126241, 0.96903918779978837, 0.96909390478774537,
+    0.96914862486530784, 0.96920334803265029, 0.96925807428994704, 0.9693128036373726,
+    0.96936753607510162, 0.96942227160330841, 0.96947701022216759, 0.96953175193185359,
+    0.96958649673254094, 0.96964124462440426, 0.9696959956076181, 0.96975074968235686,
+    0.96980550684879518, 0.96986026710710771, 0.96991503045746896, 0.96996979690005358,
+    0.9700245664350361, 0.97007933906259114, 0.97013411478289335, 0.97018889359611737,
+    0.97024367550243784, 0.97029846050202939, 0.97035324859506666, 0.97040803978172441,
+    0.97046283406217726, 0.97051763143659997, 0.97057243190516707, 0.97062723546805352,
+    0.97068204212543374, 0.97073685187748282, 0.97079166472437517, 0.97084648066628565,
+    0.97090129970338912, 0.97095612183586033, 0.97101094706387392, 0.97106577538760486,
+    0.97112060680722778, 0.97117544132291755, 0.97123027893484914, 0.97128511964319708,
+    0.97133996344813656, 0.9713948103498421, 0.97144966034848879, 0.97150451344425148,
+    0.97155936963730483, 0.97161422892782401, 0.97166909131598378, 0.971723956801959,
+    0.97177882538592475, 0.97183369706805578, 0.97188857184852717, 0.97194344972751379,
+    0.97199833070519059, 0.97205321478173268, 0.97210810195731479, 0.97216299223211211,
+    0.97221788560629963, 0.97227278208005219, 0.972327681653545, 0.9723825843269529,
+    0.97243749010045111, 0.97249239897421458, 0.9725473109484184, 0.97260222602323765,
+    0.9726571441988473, 0.97271206547542255, 0.97276698985313848, 0.97282191733217016,
+    0.97287684791269269, 0.97293178159488125, 0.97298671837891104, 0.97304165826495703,
+    0.97309660125319453, 0.97315154734379861, 0.97320649653694447, 0.9732614488328073,
+    0.9733164042315624, 0.97337136273338476, 0.97342632433844978, 0.97348128904693265,
+    0.97353625685900846, 0.97359122777485263, 0.97364620179464034, 0.97370117891854691,
+    0.97375615914674751, 0.97381114247941758, 0.9738661289167323, 0.97392111845886697,
+    0.97397611110599691, 0.97403110685829741, 0.97408610571594401, 0.97414110767911177,
+    0.97419611274797624, 0.97425112092271271, 0.9743061322034966, 0.97436114659050321,
+    0.97441616408390797, 0.97447118468388638, 0.97452620839061366, 0.97458123520426543,
+    0.974636265125017, 0.97469129815304378, 0.97474633428852142, 0.9748013735316251,
+    0.97485641588253058, 0.97491146134141315, 0.97496650990844835, 0.9750215615838117,
+    0.97507661636767873, 0.97513167426022496, 0.97518673526162591, 0.97524179937205702,
+    0.97529686659169401, 0.97535193692071231, 0.97540701035928756, 0.97546208690759539,
+    0.97551716656581122, 0.97557224933411091, 0.97562733521266987, 0.97568242420166373,
+    0.97573751630126815, 0.97579261151165886, 0.97584770983301139, 0.97590281126550149,
+    0.9759579158093048, 0.97601302346459695, 0.9760681342315537, 0.97612324811035067,
+    0.97617836510116363, 0.97623348520416831, 0.97628860841954046, 0.97634373474745584,
+    0.97639886418809008, 0.97645399674161892, 0.97650913240821835, 0.97656427118806399,
+    0.9766194130813316, 0.97667455808819714, 0.97672970620883626, 0.9767848574434248,
+    0.97684001179213864, 0.97689516925515363, 0.97695032983264563, 0.97700549352479038,
+    0.97706066033176386, 0.97711583025374193, 0.97717100329090056, 0.9772261794434155,
+    0.97728135871146271, 0.97733654109521817, 0.97739172659485762, 0.97744691521055727,
+    0.97750210694249295, 0.97755730179084055, 0.97761249975577613, 0.97766770083747556,
+    0.97772290503611503, 0.97777811235187029, 0.97783332278491752, 0.97788853633543271,
+    0.97794375300359182, 0.97799897278957104, 0.97805419569354624, 0.97810942171569348,
+    0.97816465085618898, 0.9782198831152088, 0.97827511849292892, 0.97833035698952542,
+    0.97838559860517449, 0.97844084334005232, 0.97849609119433489, 0.97855134216819839,
+    0.97860659626181901, 0.97866185347537282, 0.97871711380903603, 0.97877237726298494,
+    0.97882764383739551, 0.97888291353244417, 0.97893818634830687, 0.97899346228516004,
+    0.97904874134317987, 0.97910402352254244, 0.97915930882342428, 0.97921459724600135,
+    0.97926988879045007, 0.97932518345694675, 0.97938048124566768, 0.97943578215678906,
+    0.97949108619048719, 0.97954639334693849, 0.97960170362631915, 0.9796570170288057,
+    0.97971233355457432, 0.97976765320380144, 0.97982297597666346, 0.97987830187333669,
+    0.97993363089399743, 0.97998896303882232, 0.98004429830798756, 0.98009963670166966,
+    0.98015497822004494, 0.98021032286329002, 0.98026567063158121, 0.98032102152509504,
+    0.98037637554400792, 0.98043173268849626, 0.98048709295873671, 0.98054245635490567,
+    0.98059782287717967, 0.98065319252573524, 0.98070856530074879, 0.98076394120239707,
+    0.9808193202308565, 0.98087470238630359, 0.98093008766891487, 0.98098547607886721,
+    0.9810408676163368, 0.98109626228150049, 0.98115166007453491, 0.9812070609956165,
+    0.98126246504492198, 0.98131787222262801, 0.98137328252891121, 0.98142869596394822,
+    0.98148411252791568, 0.98153953222099033, 0.98159495504334882, 0.98165038099516788,
+    0.98170581007662416, 0.98176124228789441, 0.98181667762915537, 0.98187211610058367,
+    0.98192755770235618, 0.98198300243464964, 0.98203845029764081, 0.98209390129150653,
+    0.98214935541642334, 0.98220481267256832, 0.98226027306011809, 0.98231573657924953,
+    0.98237120323013949, 0.98242667301296471, 0.98248214592790217, 0.98253762197512873,
+    0.98259310115482112, 0.98264858346715622, 0.98270406891231099, 0.9827595574904624,
+    0.98281504920178719, 0.98287054404646246, 0.98292604202466494, 0.9829815431365716,
+    0.98303704738235953, 0.98309255476220558, 0.98314806527628673, 0.98320357892477994,
+    0.98325909570786219, 0.98331461562571054, 0.98337013867850187, 0.98342566486641336,
+    0.98348119418962188, 0.9835367266483046, 0.98359226224263852, 0.98364780097280058,
+    0.98370334283896799, 0.98375888784131782, 0.98381443598002705, 0.98386998725527286,
+    0.98392554166723223, 0.98398109921608257, 0.98403665990200062, 0.98409222372516381,
+    0.9841477906857492, 0.98420336078393389, 0.98425893401989506, 0.98431451039381002,
+    0.98437008990585573, 0.9844256725562095, 0.98448125834504852, 0.98453684727255009,
+    0.98459243933889129, 0.98464803454424954, 0.98470363288880192, 0.98475923437272572,
+    0.98481483899619815, 0.98487044675939661, 0.98492605766249841, 0.98498167170568074,
+    0.9850372888891209, 0.98509290921299619, 0.98514853267748415, 0.98520415928276184,
+    0.98525978902900668, 0.98531542191639609, 0.98537105794510749, 0.98542669711531805,
+    0.98548233942720531, 0.98553798488094668, 0.98559363347671947, 0.98564928521470119,
+    0.98570494009506926, 0.98576059811800099, 0.98581625928367389, 0.9858719235922655,
+    0.98592759104395322, 0.98598326163891448, 0.9860389353773269, 0.98609461225936779,
+    0.98615029228521478, 0.9862059754550454, 0.98626166176903707, 0.98631735122736741,
+    0.98637304383021396, 0.98642873957775434, 0.98648443847016598, 0.9865401405076264,
+    0.98659584569031344, 0.98665155401840454, 0.98670726549207721, 0.98676298011150931,
+    0.98681869787687826, 0.9868744187883618, 0.98693014284613756, 0.98698587005038318,
+    0.98704160040127631, 0.98709733389899457, 0.98715307054371582, 0.98720881033561758,
+    0.98726455327487772, 0.98732029936167376, 0.98737604859618366, 0.98743180097858496,
+    0.9874875565090554, 0.98754331518777294, 0.98759907701491512, 0.98765484199065989,
+    0.98771061011518491, 0.98776638138866812, 0.98782215581128718, 0.98787793338321994,
+    0.98793371410464426, 0.98798949797573787, 0.98804528499667887, 0.98810107516764489,
+    0.9881568684888139, 0.98821266496036364, 0.98826846458247219, 0.98832426735531731,
+    0.98838007327907695, 0.9884358823539291, 0.98849169458005159, 0.98854750995762242,
+    0.98860332848681942, 0.98865915016782058, 0.98871497500080407, 0.98877080298594755,
+    0.9888266341234293, 0.98888246841342708, 0.98893830585611908, 0.98899414645168326,
+    0.9890499902002976, 0.98910583710214017, 0.98916168715738895, 0.98921754036622223,
+    0.98927339672881776, 0.98932925624535384, 0.98938511891600844, 0.98944098474095965,
+    0.98949685372038576, 0.98955272585446474, 0.98960860114337468, 0.98966447958729376,
+    0.98972036118640017, 0.9897762459408721, 0.98983213385088764, 0.98988802491662498,
+    0.9899439191382623, 0.98999981651597779, 0.99005571704994966, 0.99011162074035619,
+    0.99016752758737558, 0.99022343759118614, 0.99027935075196594, 0.99033526706989339,
+    0.99039118654514668, 0.99044710917790413, 0.99050303496834402, 0.99055896391664466,
+    0.99061489602298425, 0.9906708312875413, 0.990726769710494, 0.99078271129202078,
+    0.99083865603229992, 0.99089460393150985, 0.99095055498982876, 0.99100650920743527,
+    0.99106246658450758, 0.99111842712122422, 0.9911743908177636, 0.99123035767430401,
+    0.99128632769102398, 0.99134230086810193, 0.99139827720571638, 0.99145425670404563,
+    0.99151023936326832, 0.99156622518356274, 0.99162221416510754, 0.99167820630808123,
+    0.99173420161266224, 0.99179020007902907, 0.99184620170736038, 0.99190220649783456,
+    0.99195821445063026, 0.992014225565926, 0.9920702398439003, 0.99212625728473192,
+    0.99218227788859925, 0.99223830165568094, 0.99229432858615574, 0.99235035868020205,
+    0.99240639193799873, 0.9924624283597242, 0.99251846794555731, 0.99257451069567659,
+    0.99263055661026078, 0.99268660568948852, 0.99274265793353855, 0.99279871334258951,
+    0.99285477191682014, 0.9929108336564092, 0.99296689856153542, 0.99302296663237744,
+    0.99307903786911411, 0.99313511227192419, 0.99319118984098642, 0.99324727057647955,
+    0.99330335447858253, 0.99335944154747391, 0.99341553178333275, 0.99347162518633769,
+    0.9935277217566677, 0.99358382149450164, 0.99363992440001814, 0.99369603047339627,
+    0.99375213971481491, 0.99380825212445278, 0.99386436770248887, 0.99392048644910214,
+    0.99397660836447144, 0.99403273344877574, 0.9940888617021939, 0.99414499312490501,
+    0.9942011277170878, 0.99425726547892135, 0.99431340641058474, 0.99436955051225673,
+    0.9944256977841166, 0.99448184822634311, 0.99453800183911534, 0.99459415862261236,
+    0.99465031857701314, 0.99470648170249687, 0.99476264799924241, 0.99481881746742895,
+    0.99487499010723557, 0.99493116591884134, 0.99498734490242524, 0.99504352705816657,
+    0.99509971238624428, 0.99515590088683759, 0.99521209256012566, 0.99526828740628759,
+    0.99532448542550245, 0.99538068661794965, 0.99543689098380805, 0.99549309852325707,
+    0.99554930923647589, 0.99560552312364359, 0.99566174018493947, 0.99571796042054284,
+    0.99577418383063276, 0.99583041041538856, 0.99588664017498951, 0.99594287310961493,
+    0.99599910921944401, 0.99605534850465605, 0.99611159096543045, 0.9961678366019463,
+    0.99622408541438312, 0.99628033740292021, 0.99633659256773688, 0.99639285090901242,
+    0.99644911242692635, 0.99650537712165776, 0.99656164499338629, 0.99661791604229133,
+    0.99667419026855208, 0.99673046767234807, 0.99678674825385871, 0.99684303201326352,
+    0.9968993189507418, 0.99695560906647307, 0.99701190236063675, 0.99706819883341224,
+    0.9971244984849793, 0.99718080131551712, 0.99723710732520532, 0.99729341651422343,
+    0.99734972888275097, 0.99740604443096748, 0.99746236315905235, 0.99751868506718533,
+    0.99757501015554595, 0.99763133842431373, 0.99768766987366819, 0.99774400450378908,
+    0.99780034231485593, 0.99785668330704824, 0.99791302748054578, 0.99796937483552817,
+    0.99802572537217504, 0.99808207909066593, 0.99813843599118068, 0.99819479607389883,
+    0.9982511593390001, 0.99830752578666426, 0.99836389541707093, 0.99842026823039987,
+    0.99847664422683069, 0.99853302340654326, 0.99858940576971733, 0.99864579131653253,
+    0.99870218004716871, 0.99875857196180573, 0.99881496706062312, 0.99887136534380094,
+    0.99892776681151885, 0.99898417146395679, 0.99904057930129442, 0.99909699032371169,
+    0.99915340453138834, 0.99920982192450436, 0.99926624250323959, 0.99932266626777388,
+    0.999379093218287, 0.99943552335495911, 0.99949195667796986, 0.99954839318749933,
+    0.99960483288372726, 0.99966127576683383, 0.99971772183699892, 0.99977417109440236,
+    0.99983062353922425, 0.99988707917164443, 0.99994353799184299, 1,
+    1.0000564651962953, 1.0001129335809091, 1.0001694051540213, 1.0002258799158119,
+    1.000282357866461, 1.0003388390061487, 1.0003953233350551, 1.00045181085336,
+    1.0005083015612439, 1.0005647954588868, 1.0006212925464686, 1.0006777928241695,
+    1.0007342962921697, 1.0007908029506491, 1.0008473127997883, 1.0009038258397673,
+    1.000960342070766, 1.0010168614929651, 1.0010733841065442, 1.0011299099116837,
+    1.0011864389085641, 1.0012429710973652, 1.0012995064782677, 1.0013560450514514,
+    1.0014125868170967, 1.0014691317753839, 1.0015256799264933, 1.0015822312706053,
+    1.0016387858078999, 1.0016953435385576, 1.0017519044627585, 1.0018084685806832,
+    1.0018650358925121, 1.0019216063984251, 1.001978180098603, 1.0020347569932258,
+    1.0020913370824742, 1.0021479203665284, 1.0022045068455689, 1.002261096519776,
+    1.0023176893893302, 1.0023742854544118, 1.0024308847152015, 1.0024874871718794,
+    1.0025440928246261, 1.0026007016736223, 1.0026573137190482, 1.0027139289610842,
+    1.0027705473999111, 1.0028271690357091, 1.002883793868659, 1.0029404218989413,
+    1.0029970531267363, 1.0030536875522249, 1.0031103251755873, 1.0031669659970042,
+    1.0032236100166561, 1.0032802572347239, 1.0033369076513878, 1.0033935612668288,
+    1.0034502180812273, 1.0035068780947638, 1.0035635413076192, 1.0036202077199738,
+    1.0036768773320086, 1.0037335501439044, 1.0037902261558413, 1.0038469053680006,
+    1.0039035877805627, 1.0039602733937083, 1.0040169622076183, 1.0040736542224733,
+    1.0041303494384539, 1.0041870478557411, 1.0042437494745153, 1.0043004542949578,
+    1.0043571623172491, 1.00441387354157, 1.0044705879681013, 1.0045273055970239,
+    1.0045840264285184, 1.0046407504627659, 1.0046974776999469, 1.0047542081402427,
+    1.004810941783834, 1.0048676786309014, 1.0049244186816262, 1.004981161936189,
+    1.0050379083947709, 1.0050946580575526, 1.0051514109247153, 1.0052081669964397,
+    1.0052649262729068, 1.0053216887542977, 1.0053784544407931, 1.0054352233325743,
+    1.005491995429822, 1.0055487707327173, 1.0056055492414413, 1.0056623309561747,
+    1.0057191158770991, 1.005775904004395, 1.0058326953382437, 1.0058894898788264,
+    1.0059462876263239, 1.0060030885809172, 1.0060598927427875, 1.0061167001121163,
+    1.0061735106890841, 1.0062303244738724, 1.0062871414666621, 1.0063439616676344,
+    1.0064007850769707, 1.0064576116948518, 1.0065144415214591, 1.0065712745569737,
+    1.0066281108015769, 1.0066849502554496, 1.0067417929187734, 1.0067986387917292,
+    1.0068554878744984, 1.0069123401672624, 1.006969195670202, 1.007026054383499,
+    1.0070829163073343, 1.0071397814418892, 1.0071966497873452, 1.0072535213438834,
+    1.0073103961116854, 1.0073672740909321, 1.0074241552818051, 1.0074810396844858,
+    1.0075379272991554, 1.0075948181259953, 1.0076517121651869, 1.0077086094169116,
+    1.0077655098813509, 1.0078224135586862, 1.0078793204490986, 1.0079362305527697,
+    1.007993143869881, 1.008050060400614, 1.0081069801451501, 1.0081639031036707,
+    1.0082208292763573, 1.0082777586633915, 1.0083346912649547, 1.0083916270812283,
+    1.0084485661123939, 1.0085055083586332, 1.0085624538201277, 1.0086194024970587,
+    1.008676354389608, 1.0087333094979571, 1.0087902678222875, 1.008847229362781,
+    1.0089041941196188, 1.008961162092983, 1.009018133283055, 1.0090751076900164,
+    1.0091320853140489, 1.009189066155334, 1.0092460502140537, 1.0093030374903893,
+    1.0093600279845227, 1.0094170216966354, 1.0094740186269093, 1.0095310187755262,
+    1.0095880221426676, 1.0096450287285152, 1.0097020385332511, 1.0097590515570567,
+    1.0098160678001138, 1.0098730872626043, 1.00993010994471, 1.0099871358466126,
+    1.0100441649684939, 1.0101011973105358, 1.0101582328729202, 1.0102152716558288,
+    1.0102723136594434, 1.0103293588839459, 1.0103864073295181, 1.0104434589963422,
+    1.0105005138845997, 1.0105575719944728, 1.0106146333261432, 1.0106716978797929,
+    1.0107287656556039, 1.0107858366537579, 1.0108429108744372, 1.0108999883178234,
+    1.0109570689840988, 1.0110141528734451, 1.0110712399860444, 1.0111283303220788,
+    1.0111854238817302, 1.0112425206651807, 1.0112996206726124, 1.0113567239042069,
+    1.0114138303601468, 1.0114709400406139, 1.0115280529457904, 1.0115851690758582,
+    1.0116422884309995, 1.0116994110113964, 1.011756536817231, 1.0118136658486856,
+    1.011870798105942, 1.0119279335891826, 1.0119850722985895, 1.0120422142343446,
+    1.0120993593966305, 1.0121565077856294, 1.012213659401523, 1.0122708142444941,
+    1.0123279723147243, 1.0123851336123963, 1.0124422981376924, 1.0124994658907942,
+    1.0125566368718848, 1.0126138110811458, 1.0126709885187599, 1.0127281691849093,
+    1.0127853530797761, 1.0128425402035428, 1.0128997305563916, 1.012956924138505,
+    1.0130141209500652, 1.0130713209912547, 1.0131285242622556, 1.0131857307632504,
+    1.0132429404944217, 1.0133001534559516, 1.0133573696480225, 1.0134145890708171,
+    1.0134718117245174, 1.0135290376093062, 1.0135862667253659, 1.0136434990728789,
+    1.0137007346520275, 1.0137579734629942, 1.0138152155059619, 1.0138724607811127,
+    1.013929709288629, 1.0139869610286938, 1.0140442160014891, 1.0141014742071979,
+    1.0141587356460022, 1.0142160003180851, 1.0142732682236291, 1.0143305393628164,
+    1.01438781373583, 1.014445091342852, 1.0145023721840656, 1.0145596562596531,
+    1.0146169435697971, 1.0146742341146804, 1.0147315278944855, 1.014788824909395,
+    1.0148461251595919, 1.0149034286452585, 1.0149607353665779, 1.0150180453237323,
+    1.015075358516905, 1.0151326749462781, 1.0151899946120349, 1.0152473175143577,
+    1.0153046436534294, 1.0153619730294328, 1.0154193056425507, 1.0154766414929659,
+    1.0155339805808612, 1.0155913229064193, 1.0156486684698229, 1.0157060172712553,
+    1.0157633693108989, 1.0158207245889366, 1.0158780831055514, 1.0159354448609261,
+    1.0159928098552435, 1.0160501780886868, 1.0161075495614385, 1.0161649242736817,
+    1.0162223022255992, 1.016279683417374, 1.0163370678491892, 1.0163944555212274,
+    1.016451846433672, 1.0165092405867056, 1.0165666379805114, 1.0166240386152723,
+    1.0166814424911712, 1.0167388496083913, 1.0167962599671154, 1.0168536735675269,
+    1.0169110904098086, 1.0169685104941435, 1.0170259338207146, 1.0170833603897054,
+    1.0171407902012983, 1.0171982232556771, 1.0172556595530247, 1.0173130990935237,
+    1.017370541877358, 1.0174279879047101, 1.0174854371757636, 1.0175428896907013,
+    1.0176003454497067, 1.0176578044529627, 1.0177152667006526, 1.0177727321929595,
+    1.0178302009300668, 1.0178876729121578, 1.0179451481394153, 1.0180026266120228,
+    1.0180601083301637, 1.018117593294021, 1.0181750815037782, 1.0182325729596182,
+    1.0182900676617248, 1.0183475656102809, 1.0184050668054698, 1.0184625712474753,
+    1.0185200789364801, 1.0185775898726681, 1.0186351040562223, 1.0186926214873262,
+    1.0187501421661631, 1.0188076660929164, 1.0188651932677695, 1.0189227236909058,
+    1.0189802573625089, 1.019037794282762, 1.0190953344518485, 1.0191528778699519,
+    1.0192104245372557, 1.0192679744539435, 1.0193255276201987, 1.0193830840362046,
+    1.0194406437021448, 1.019498206618203, 1.0195557727845623, 1.0196133422014066,
+    1.0196709148689194, 1.0197284907872841, 1.0197860699566843, 1.0198436523773038,
+    1.0199012380493258, 1.0199588269729341, 1.0200164191483123, 1.020074014575644,
+    1.0201316132551128, 1.0201892151869023, 1.0202468203711963, 1.0203044288081782,
+    1.0203620404980318, 1.0204196554409408, 1.0204772736370891, 1.0205348950866597,
+    1.0205925197898371, 1.0206501477468046, 1.0207077789577461, 1.020765413422845,
+    1.0208230511422856, 1.020880692116251, 1.0209383363449256, 1.0209959838284925,
+    1.0210536345671364, 1.0211112885610403, 1.0211689458103881, 1.0212266063153641,
+    1.0212842700761517, 1.0213419370929349, 1.0213996073658975, 1.0214572808952234,
+    1.0215149576810965, 1.0215726377237004, 1.0216303210232196, 1.0216880075798374,
+    1.021745697393738, 1.0218033904651052, 1.0218610867941231, 1.0219187863809756,
+    1.0219764892258465, 1.0220341953289198, 1.0220919046903796, 1.0221496173104099,
+    1.0222073331891943, 1.0222650523269174, 1.0223227747237629, 1.0223805003799149,
+    1.0224382292955574, 1.0224959614708744, 1.02255369690605, 1.0226114356012683,
+    1.0226691775567136, 1.0227269227725695, 1.0227846712490203, 1.0228424229862503,
+    1.0229001779844433, 1.0229579362437837, 1.0230156977644558, 1.0230734625466431,
+    1.0231312305905305, 1.0231890018963017, 1.0232467764641409, 1.0233045542942325,
+    1.0233623353867607, 1.0234201197419095, 1.0234779073598634, 1.0235356982408064,
+    1.0235934923849228, 1.0236512897923971, 1.0237090904634132, 1.0237668943981555,
+    1.0238247015968083, 1.023882512059556, 1.0239403257865829, 1.0239981427780731,
+    1.024055963034211, 1.0241137865551813, 1.0241716133411678, 1.0242294433923553,
+    1.0242872767089279, 1.0243451132910701, 1.0244029531389662, 1.0244607962528007,
+    1.0245186426327579, 1.0245764922790226, 1.0246343451917785, 1.0246922013712108,
+    1.0247500608175035, 1.0248079235308414, 1.0248657895114084, 1.0249236587593897,
+    1.0249815312749693, 1.0250394070583317, 1.0250972861096617, 1.0251551684291438,
+    1.0252130540169624, 1.025270942873302, 1.0253288349983471, 1.0253867303922826,
+    1.0254446290552928, 1.0255025309875625, 1.0255604361892761, 1.0256183446606182,
+    1.0256762564017736, 1.0257341714129267, 1.0257920896942625, 1.0258500112459652,
+    1.0259079360682197, 1.0259658641612108, 1.026023795525123, 1.026081730160141,
+    1.0261396680664496, 1.0261976092442333, 1.0262555536936773, 1.0263135014149656,
+    1.0263714524082836, 1.0264294066738158, 1.0264873642117469, 1.0265453250222618,
+    1.0266032891055452, 1.0266612564617821, 1.0267192270911569, 1.0267772009938549,
+    1.0268351781700606, 1.026893158619959, 1.0269511423437347, 1.0270091293415728,
+    1.0270671196136583, 1.0271251131601757, 1.0271831099813102, 1.0272411100772465,
+    1.0272991134481697, 1.0273571200942646, 1.0274151300157162, 1.0274731432127093,
+    1.0275311596854291, 1.0275891794340601, 1.0276472024587879, 1.0277052287597972,
+    1.0277632583372729, 1.0278212911914, 1.0278793273223636, 1.0279373667303489,
+    1.0279954094155406, 1.028053455378124, 1.0281115046182838, 1.0281695571362057,
+    1.0282276129320742, 1.0282856720060747, 1.0283437343583923, 1.0284017999892119,
+    1.0284598688987188, 1.0285179410870979, 1.0285760165545348, 1.0286340953012143,
+    1.0286921773273214, 1.0287502626330418, 1.0288083512185602, 1.0288664430840619,
+    1.0289245382297325, 1.0289826366557566, 1.0290407383623199, 1.0290988433496076,
+    1.0291569516178045, 1.0292150631670964, 1.0292731779976683, 1.0293312961097054,
+    1.0293894175033931, 1.0294475421789169, 1.0295056701364618, 1.0295638013762132,
+    1.0296219358983565, 1.0296800737030769, 1.0297382147905598, 1.0297963591609909,
+    1.029854506814555, 1.0299126577514381, 1.0299708119718252, 1.0300289694759015,
+    1.0300871302638528, 1.0301452943358644, 1.0302034616921218, 1.0302616323328104,
+    1.0303198062581158, 1.030377983468223, 1.0304361639633179, 1.0304943477435859,
+    1.0305525348092126, 1.0306107251603833, 1.0306689187972835, 1.0307271157200988,
+    1.030785315929015, 1.0308435194242171, 1.0309017262058913, 1.0309599362742228,
+    1.0310181496293971, 1.0310763662716, 1.0311345862010171, 1.0311928094178338,
+    1.0312510359222358, 1.031309265714409, 1.0313674987945387, 1.0314257351628109,
+    1.0314839748194109, 1.0315422177645246, 1.0316004639983376, 1.0316587135210356,
+    1.0317169663328043, 1.0317752224338295, 1.0318334818242969, 1.0318917445043922,
+    1.0319500104743011, 1.0320082797342096, 1.0320665522843033, 1.0321248281247679,
+    1.0321831072557892, 1.0322413896775531, 1.0322996753902454, 1.0323579643940519,
+    1.0324162566891586, 1.032474552275751, 1.0325328511540153, 1.032591153324137,
+    1.0326494587863022, 1.0327077675406968, 1.0327660795875069, 1.0328243949269178,
+    1.0328827135591161, 1.0329410354842872, 1.0329993607026173, 1.0330576892142924,
+    1.0331160210194983, 1.033174356118421, 1.0332326945112464, 1.0332910361981609,
+    1.0333493811793499, 1.0334077294549999, 1.0334660810252967, 1.0335244358904265,
+    1.0335827940505751, 1.0336411555059286, 1.0336995202566732, 1.033757888302995,
+    1.0338162596450797, 1.033874634283114, 1.0339330122172834, 1.0339913934477747,
+    1.0340497779747733, 1.0341081657984659, 1.0341665569190381, 1.0342249513366768,
+    1.0342833490515675, 1.0343417500638967, 1.0344001543738506, 1.0344585619816151,
+    1.0345169728873769, 1.0345753870913219, 1.0346338045936363, 1.0346922253945063,
+    1.0347506494941185, 1.034809076892659, 1.034867507590314, 1.0349259415872698,
+    1.0349843788837125, 1.0350428194798289, 1.0351012633758048, 1.0351597105718269,
+    1.0352181610680813, 1.0352766148647545, 1.0353350719620329, 1.0353935323601027,
+    1.0354519960591504, 1.0355104630593621, 1.0355689333609248, 1.0356274069640243,
+    1.0356858838688474, 1.0357443640755803, 1.0358028475844097, 1.0358613343955219,
+    1.0359198245091032, 1.0359783179253403, 1.0360368146444197, 1.0360953146665277,
+    1.036153817991851, 1.0362123246205761, 1.0362708345528895, 1.0363293477889777,
+    1.0363878643290272, 1.0364463841732248, 1.0365049073217567, 1.0365634337748095,
+    1.0366219635325702, 1.0366804965952252, 1.0367390329629611, 1.0367975726359644,
+    1.0368561156144218, 1.0369146618985199, 1.0369732114884456, 1.0370317643843852,
+    1.0370903205865256, 1.0371488800950537, 1.0372074429101557, 1.0372660090320185,
+    1.0373245784608291, 1.0373831511967739, 1.0374417272400396, 1.0375003065908133,
+    1.0375588892492813, 1.0376174752156309, 1.0376760644900482, 1.0377346570727208,
+    1.0377932529638347, 1.0378518521635773, 1.0379104546721354, 1.0379690604896954,
+    1.0380276696164443, 1.0380862820525694, 1.0381448977982568, 1.0382035168536941,
+    1.0382621392190676, 1.0383207648945647, 1.038379393880372, 1.0384380261766766,
+    1.0384966617836651, 1.0385553007015249, 1.0386139429304424, 1.0386725884706052,
+    1.0387312373221997, 1.0387898894854133, 1.0388485449604326, 1.0389072037474449,
+    1.0389658658466372, 1.0390245312581963, 1.0390831999823096, 1.0391418720191636,
+    1.0392005473689461, 1.0392592260318434, 1.039317908008043, 1.0393765932977319,
+    1.0394352819010972, 1.0394939738183262, 1.0395526690496055, 1.0396113675951228,
+    1.0396700694550649, 1.0397287746296191, 1.0397874831189726, 1.0398461949233122,
+    1.0399049100428257, 1.0399636284776996, 1.0400223502281216, 1.0400810752942788,
+    1.0401398036763583, 1.0401985353745475, 1.0402572703890336, 1.0403160087200038,
+    1.0403747503676453, 1.0404334953321455, 1.0404922436136916, 1.0405509952124712,
+    1.0406097501286711, 1.0406685083624789, 1.0407272699140822, 1.0407860347836677,
+    1.0408448029714232, 1.0409035744775359, 1.0409623493021933, 1.0410211274455827,
+    1.0410799089078915, 1.0411386936893072, 1.0411974817900169, 1.0412562732102084,
+    1.0413150679500691, 1.0413738660097862, 1.0414326673895473, 1.0414914720895398,
+    1.0415502801099512, 1.041609091450969, 1.0416679061127809, 1.0417267240955741,
+    1.0417855453995364, 1.041844370024855, 1.0419031979717175, 1.0419620292403118,
+    1.042020863830825, 1.0420797017434451, 1.0421385429783594, 1.0421973875357557,
+    1.0422562354158214, 1.0423150866187443, 1.0423739411447117, 1.0424327989939117,
+    1.0424916601665315, 1.0425505246627591, 1.0426093924827819, 1.0426682636267879,
+    1.0427271380949645, 1.0427860158874995, 1.0428448970045805, 1.0429037814463955,
+    1.0429626692131322, 1.0430215603049779, 1.0430804547221209, 1.0431393524647485,
+    1.0431982535330488, 1.0432571579272096, 1.0433160656474185, 1.0433749766938634,
+    1.043433891066732, 1.0434928087662123, 1.0435517297924919, 1.043610654145759,
+    1.0436695818262014, 1.0437285128340066, 1.0437874471693629, 1.043846384832458,
+    1.0439053258234796, 1.0439642701426159, 1.0440232177900548, 1.0440821687659843,
+    1.0441411230705921, 1.0442000807040663, 1.0442590416665949, 1.0443180059583659,
+    1.0443769735795669, 1.0444359445303866, 1.0444949188110124, 1.0445538964216325,
+    1.044612877362435, 1.0446718616336079, 1.0447308492353393, 1.0447898401678171,
+    1.0448488344312297, 1.0449078320257648, 1.0449668329516106, 1.0450258372089554,
+    1.045084844797987, 1.0451438557188939, 1.0452028699718638, 1.0452618875570852,
+    1.0453209084747461, 1.0453799327250348, 1.0454389603081393, 1.0454979912242479,
+    1.0455570254735489, 1.0456160630562301, 1.0456751039724803, 1.0457341482224871,
+    1.0457931958064393, 1.0458522467245248, 1.0459113009769321, 1.0459703585638491,
+    1.0460294194854647, 1.0460884837419666, 1.0461475513335434, 1.0462066222603834,
+    1.0462656965226746, 1.0463247741206059, 1.0463838550543654, 1.0464429393241412,
+    1.0465020269301222, 1.0465611178724961, 1.0466202121514518, 1.0466793097671776,
+    1.0467384107198621, 1.0467975150096931, 1.0468566226368596, 1.04691573360155,
+    1.0469748479039525, 1.0470339655442555, 1.047093086522648, 1.0471522108393179,
+    1.0472113384944541, 1.0472704694882449, 1.0473296038208788, 1.0473887414925445,
+    1.0474478825034303, 1.0475070268537252, 1.0475661745436171, 1.047625325573295,
+    1.0476844799429477, 1.0477436376527631, 1.0478027987029304, 1.0478619630936379,
+    1.0479211308250744, 1.0479803018974285, 1.0480394763108889, 1.0480986540656441,
+    1.0481578351618828, 1.0482170195997935, 1.0482762073795655, 1.0483353985013868,
+    1.0483945929654466, 1.0484537907719333, 1.0485129919210359, 1.0485721964129429,
+    1.0486314042478433, 1.0486906154259255, 1.0487498299473785, 1.0488090478123913,
+    1.0488682690211524, 1.0489274935738506, 1.0489867214706747, 1.0490459527118139,
+    1.0491051872974566, 1.0491644252277919, 1.0492236665030084, 1.0492829111232951,
+    1.049342159088841, 1.049401410399835, 1.0494606650564657, 1.0495199230589225,
+    1.0495791844073938, 1.0496384491020689, 1.0496977171431365, 1.0497569885307858,
+    1.0498162632652057, 1.049875541346585, 1.0499348227751129, 1.0499941075509782,
+    1.0500533956743698, 1.0501126871454773, 1.0501719819644892, 1.0502312801315947,
+    1.0502905816469827, 1.0503498865108427, 1.0504091947233634, 1.0504685062847336,
+    1.0505278211951432, 1.0505871394547808, 1.0506464610638353, 1.0507057860224964,
+    1.0507651143309527, 1.0508244459893938, 1.0508837809980085, 1.050943119356986,
+    1.0510024610665158, 1.0510618061267869, 1.0511211545379884, 1.0511805063003095,
+    1.0512398614139395, 1.0512992198790678, 1.0513585816958835, 1.0514179468645757,
+    1.0514773153853338, 1.0515366872583471, 1.051596062483805, 1.0516554410618966,
+    1.051714822992811, 1.0517742082767381, 1.0518335969138668, 1.0518929889043866,
+    1.0519523842484868, 1.0520117829463567, 1.0520711849981859, 1.0521305904041633,
+    1.052189999164479, 1.0522494112793217, 1.0523088267488812, 1.052368245573347,
+    1.0524276677529083, 1.0524870932877546, 1.0525465221780754, 1.05260595442406,
+    1.0526653900258982, 1.0527248289837794, 1.052784271297893, 1.0528437169684284,
+    1.0529031659955754, 1.0529626183795233, 1.0530220741204619, 1.0530815332185803,
+    1.0531409956740685, 1.053200461487116, 1.0532599306579122, 1.0533194031866469,
+    1.0533788790735095, 1.0534383583186897, 1.0534978409223772, 1.0535573268847616,
+    1.0536168162060324, 1.0536763088863796, 1.0537358049259926, 1.0537953043250612,
+    1.053854807083775, 1.0539143132023239, 1.0539738226808972, 1.0540333355196851,
+    1.054092851718877, 1.0541523712786629, 1.0542118941992322, 1.054271420480775,
+    1.0543309501234812, 1.0543904831275401, 1.0544500194931419, 1.0545095592204761,
+    1.0545691023097328, 1.0546286487611019, 1.0546881985747727, 1.0547477517509356,
+    1.0548073082897804, 1.0548668681914968, 1.0549264314562745, 1.0549859980843039,
+    1.0550455680757747, 1.0551051414308765, 1.0551647181497996, 1.0552242982327338,
+    1.0552838816798691, 1.0553434684913956, 1.0554030586675029, 1.0554626522083812,
+    1.0555222491142207, 1.0555818493852109, 1.0556414530215423, 1.0557010600234047,
+    1.0557606703909881, 1.0558202841244826, 1.0558799012240783, 1.0559395216899652,
+    1.0559991455223334, 1.0560587727213731, 1.0561184032872741, 1.056178037220227,
+    1.0562376745204214, 1.0562973151880477, 1.056356959223296, 1.0564166066263565,
+    1.0564762573974193, 1.0565359115366746, 1.0565955690443127, 1.0566552299205236,
+    1.0567148941654976, 1.0567745617794249, 1.0568342327624956, 1.0568939071149002,
+    1.0569535848368288, 1.0570132659284717, 1.0570729503900189, 1.0571326382216613,
+    1.0571923294235888, 1.0572520239959915, 1.05731172193906, 1.0573714232529847,
+    1.0574311279379558, 1.0574908359941637, 1.0575505474217985, 1.057610262221051,
+    1.0576699803921112, 1.0577297019351697, 1.0577894268504169, 1.0578491551380431,
+    1.0579088867982389, 1.0579686218311946, 1.0580283602371006, 1.0580881020161474,
+    1.0581478471685255, 1.0582075956944255, 1.0582673475940374, 1.0583271028675523,
+    1.0583868615151604, 1.0584466235370522, 1.0585063889334185, 1.0585661577044494,
+    1.0586259298503358, 1.0586857053712682, 1.0587454842674371, 1.0588052665390331,
+    1.0588650521862466, 1.0589248412092687, 1.0589846336082895, 1.0590444293835,
+    1.0591042285350907, 1.059164031063252, 1.059223836968175, 1.0592836462500501,
+    1.059343458909068, 1.0594032749454196, 1.0594630943592953, 1.059522917150886,
+  };
 } // namespace mopo
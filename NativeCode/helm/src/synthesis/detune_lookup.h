@@ -32,38 +32,20 @@ namespace mopo {
     const int DETUNE_LOOKUP_RESOLUTION = 2046;
   } // namespace
 
-  class DetuneLookupSingleton {
+  // The table is generated into detune_lookup.cpp by tables/helm_tables.cpp.
+  class DetuneLookup {
     public:
-      DetuneLookupSingleton() {
-        for (int i = 0; i < DETUNE_LOOKUP_RESOLUTION + 2; ++i) {
-          mopo_float t = (1.0 * i) / DETUNE_LOOKUP_RESOLUTION;
-          mopo_float cents = utils::interpolate(MIN_LOOKUP_CENTS, MAX_LOOKUP_CENTS, t);
-          detune_lookup_[i] = utils::centsToRatio(cents);
-        }
-      }
-
-      mopo_float detuneLookup(mopo_float cents) const {
+      static mopo_float detuneLookup(mopo_float cents) {
         mopo_float t = (cents - MIN_LOOKUP_CENTS) / CENTS_RANGE;
-        mopo_float index = DETUNE_LOOKUP_RESOLUTION * utils::clamp(t, 0.0, 1.0);
+        mopo_float index = DETUNE_LOOKUP_RESOLUTION * utils::clamp(t, mopo_float(0.0), mopo_float(1.0));
         int int_index = index;
         mopo_float fraction = index - int_index;
 
-        return utils::interpolate(detune_lookup_[int_index],
-                                  detune_lookup_[int_index + 1], fraction);
-      }
-
-    private:
-      mopo_float detune_lookup_[DETUNE_LOOKUP_RESOLUTION + 2];
-  };
-
-  class DetuneLookup {
-    public:
-      static mopo_float detuneLookup(mopo_float cents) {
-        return lookup_.detuneLookup(cents);
+        return utils::interpolate(lookup_[int_index], lookup_[int_index + 1], fraction);
       }
 
     private:
-      static const DetuneLookupSingleton lookup_;
+      static const mopo_float lookup_[DETUNE_LOOKUP_RESOLUTION + 2];
   };
 } // namespace mopo
 
@@ -18,113 +18,173 @@
 
 namespace mopo {
 
-  FixedPointWaveLookup::FixedPointWaveLookup() {
-    preprocessSin();
-    preprocessTriangle();
-    preprocessSquare();
-    preprocessUpSaw();
-    preprocessDownSaw();
-    preprocessStep<3>(three_step_);
-    preprocessStep<4>(four_step_);
-    preprocessStep<8>(eight_step_);
-    preprocessPyramid<3>(three_pyramid_);
-    preprocessPyramid<5>(five_pyramid_);
-    preprocessPyramid<9>(nine_pyramid_);
-
-    wave_type waves[kNumFixedPointWaveforms] =
-        { sin_, triangle_, square_, down_saw_, up_saw_,
-          three_step_, four_step_, eight_step_,
-          three_pyramid_, five_pyramid_, nine_pyramid_ };
-
-    memcpy(waves_, waves, kNumFixedPointWaveforms * sizeof(wave_type));
+  const FixedPointWaveLookup::Table* FixedPointWaveLookup::prepare(int waveform) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return built(waveform);
   }
 
-  void FixedPointWaveLookup::preprocessSin() {
-    for (int h = 0; h < HARMONICS + 1; ++h) {
-      for (int i = 0; i < FIXED_LOOKUP_SIZE; ++i)
-        sin_[h][i] = sin((2 * PI * i) / FIXED_LOOKUP_SIZE);
+  size_t FixedPointWaveLookup::memoryUsed() const {
+    size_t bytes = 0;
+    for (const std::atomic<Table*>& entry : tables_) {
+      const Table* table = entry.load(std::memory_order_acquire);
+      if (table)
+        bytes += sizeof(Table) + table->num_rows * ROW_SIZE * sizeof(wave_float);
     }
+    return bytes;
+  }
 
-    preprocessDiffs(sin_);
+  // Needs mutex_ held.
+  FixedPointWaveLookup::Table* FixedPointWaveLookup::built(int waveform) {
+    Table* table = tables_[waveform].load(std::memory_order_relaxed);
+    if (table == nullptr) {
+      table = build(waveform);
+      tables_[waveform].store(table, std::memory_order_release);
+    }
+    return table;
   }
 
-  void FixedPointWaveLookup::preprocessTriangle() {
+  FixedPointWaveLookup::Table* FixedPointWaveLookup::build(int waveform) {
+    if (waveform == kSin) {
+      Table* table = createTable(1);
+      preprocessSin(table);
+      return table;
+    }
+
+    Table* table = createTable(HARMONICS + 1);
+    switch (waveform) {
+      case kTriangle:
+        preprocessTriangle(table, built(kSin)->rows[0]);
+        break;
+      case kSquare:
+        preprocessSquare(table, built(kSin)->rows[0]);
+        break;
+      case kDownSaw:
+        preprocessDownSaw(table, built(kUpSaw));
+        break;
+      case kUpSaw:
+        preprocessUpSaw(table, built(kSin)->rows[0]);
+        break;
+      case kThreeStep:
+        preprocessStep<3>(table, built(kUpSaw), built(kDownSaw));
+        break;
+      case kFourStep:
+        preprocessStep<4>(table, built(kUpSaw), built(kDownSaw));
+        break;
+      case kEightStep:
+        preprocessStep<8>(table, built(kUpSaw), built(kDownSaw));
+        break;
+      case kThreePyramid:
+        preprocessPyramid<3>(table, built(kSquare));
+        break;
+      case kFivePyramid:
+        preprocessPyramid<5>(table, built(kSquare));
+        break;
+      case kNinePyramid:
+        preprocessPyramid<9>(table, built(kSquare));
+        break;
+      default:
+        break;
+    }
+    return table;
+  }
+
+  FixedPointWaveLookup::Table* FixedPointWaveLookup::createTable(int num_rows) {
+    Table* table = new Table();
+    table->num_rows = num_rows;
+    table->data = new wave_float[num_rows * ROW_SIZE]();
+    for (int h = 0; h < HARMONICS + 1; ++h)
+      table->rows[h] = table->data + std::min(h, num_rows - 1) * ROW_SIZE;
+    return table;
+  }
+
+  void FixedPointWaveLookup::preprocessSin(Table* table) {
+    wave_float* row = table->rows[0];
+    for (int i = 0; i < FIXED_LOOKUP_SIZE; ++i)
+      row[i] = sin((2 * PI * i) / FIXED_LOOKUP_SIZE);
+
+    preprocessDiffs(table);
+  }
+
+  void FixedPointWaveLookup::preprocessTriangle(Table* table, const wave_float* sin) {
+    wave_float** triangle = table->rows;
     for (int i = 0; i < FIXED_LOOKUP_SIZE; ++i) {
-      triangle_[0][i] = Wave::triangle((1.0 * i) / FIXED_LOOKUP_SIZE);
+      triangle[0][i] = Wave::triangle((1.0 * i) / FIXED_LOOKUP_SIZE);
 
       int p = i;
       mopo_float scale = 8.0 / (PI * PI);
-      triangle_[HARMONICS][i] = scale * sin_[0][p];
+      triangle[HARMONICS][i] = scale * sin[p];
 
       for (int h = 1; h < HARMONICS; ++h) {
         p = (p + i) % FIXED_LOOKUP_SIZE;
-        triangle_[HARMONICS - h][i] = triangle_[HARMONICS - h + 1][i];
-        mopo_float harmonic = scale * sin_[0][p] / ((h + 1) * (h + 1));
+        triangle[HARMONICS - h][i] = triangle[HARMONICS - h + 1][i];
+        mopo_float harmonic = scale * sin[p] / ((h + 1) * (h + 1));
 
         if (h % 4 == 0)
-          triangle_[HARMONICS - h][i] += harmonic;
+          triangle[HARMONICS - h][i] += harmonic;
         else if (h % 2 == 0)
-          triangle_[HARMONICS - h][i] -= harmonic;
+          triangle[HARMONICS - h][i] -= harmonic;
       }
     }
 
-    preprocessDiffs(triangle_);
+    preprocessDiffs(table);
   }
 
-  void FixedPointWaveLookup::preprocessSquare() {
+  void FixedPointWaveLookup::preprocessSquare(Table* table, const wave_float* sin) {
+    wave_float** square = table->rows;
     for (int i = 0; i < FIXED_LOOKUP_SIZE; ++i) {
-      square_[0][i] = Wave::square((1.0 * i) / FIXED_LOOKUP_SIZE);
+      square[0][i] = Wave::square((1.0 * i) / FIXED_LOOKUP_SIZE);
 
       int p = i;
       mopo_float scale = 4.0 / PI;
-      square_[HARMONICS][i] = scale * sin_[0][p];
+      square[HARMONICS][i] = scale * sin[p];
 
       for (int h = 1; h < HARMONICS; ++h) {
         p = (p + i) % FIXED_LOOKUP_SIZE;
-        square_[HARMONICS - h][i] = square_[HARMONICS - h + 1][i];
+        square[HARMONICS - h][i] = square[HARMONICS - h + 1][i];
 
         if (h % 2 == 0)
-          square_[HARMONICS - h][i] += scale * sin_[0][p] / (h + 1);
+          square[HARMONICS - h][i] += scale * sin[p] / (h + 1);
       }
     }
 
-    preprocessDiffs(square_);
+    preprocessDiffs(table);
   }
 
-  void FixedPointWaveLookup::preprocessDownSaw() {
+  void FixedPointWaveLookup::preprocessDownSaw(Table* table, const Table* up_saw) {
     for (int h = 0; h < HARMONICS + 1; ++h) {
       for (int i = 0; i < FIXED_LOOKUP_SIZE; ++i)
-        down_saw_[h][i] = -up_saw_[h][i];
+        table->rows[h][i] = -up_saw->rows[h][i];
     }
 
-    preprocessDiffs(down_saw_);
+    preprocessDiffs(table);
   }
 
-  void FixedPointWaveLookup::preprocessUpSaw() {
+  void FixedPointWaveLookup::preprocessUpSaw(Table* table, const wave_float* sin) {
+    wave_float** up_saw = table->rows;
     for (int i = 0; i < FIXED_LOOKUP_SIZE; ++i) {
-      up_saw_[0][i] = Wave::upsaw((1.0 * i) / FIXED_LOOKUP_SIZE);
+      up_saw[0][i] = Wave::upsaw((1.0 * i) / FIXED_LOOKUP_SIZE);
 
       int index = (i + (FIXED_LOOKUP_SIZE / 2)) % FIXED_LOOKUP_SIZE;
       int p = i;
       mopo_float scale = 2.0 / PI;
-      up_saw_[HARMONICS][index] = scale * sin_[0][p];
+      up_saw[HARMONICS][index] = scale * sin[p];
 
       for (int h = 1; h < HARMONICS; ++h) {
         p = (p + i) % FIXED_LOOKUP_SIZE;
-        mopo_float harmonic = scale * sin_[0][p] / (h + 1);
+        mopo_float harmonic = scale * sin[p] / (h + 1);
 
         if (h % 2 == 0)
-          up_saw_[HARMONICS - h][index] = up_saw_[HARMONICS - h + 1][index] + harmonic;
+          up_saw[HARMONICS - h][index] = up_saw[HARMONICS - h + 1][index] + harmonic;
         else
-          up_saw_[HARMONICS - h][index] = up_saw_[HARMONICS - h + 1][index] - harmonic;
+          up_saw[HARMONICS - h][index] = up_saw[HARMONICS - h + 1][index] - harmonic;
       }
     }
 
-    preprocessDiffs(up_saw_);
+    preprocessDiffs(table);
   }
 
   template<size_t steps>
-  void FixedPointWaveLookup::preprocessStep(wave_type buffer) {
+  void FixedPointWaveLookup::preprocessStep(Table* table, const Table* up_saw, const Table* down_saw) {
     static int num_steps = steps;
     static const mopo_float step_size = num_steps / (num_steps - 1.0);
 
@@ -134,47 +194,48 @@ namespace mopo {
       int harmony_h = HARMONICS + 1 - harmony_num_harmonics;
 
       for (int i = 0; i < FIXED_LOOKUP_SIZE; ++i) {
-        buffer[h][i] = step_size * up_saw_[h][i];
+        table->rows[h][i] = step_size * up_saw->rows[h][i];
 
         if (harmony_num_harmonics) {
           int harm_index = (num_steps * i) % FIXED_LOOKUP_SIZE;
-          buffer[h][i] += step_size * down_saw_[harmony_h][harm_index] / num_steps;
+          table->rows[h][i] += step_size * down_saw->rows[harmony_h][harm_index] / num_steps;
         }
       }
     }
 
-    preprocessDiffs(buffer);
+    preprocessDiffs(table);
   }
 
   template<size_t steps>
-  void FixedPointWaveLookup::preprocessPyramid(wave_type buffer) {
+  void FixedPointWaveLookup::preprocessPyramid(Table* table, const Table* square) {
     static const int squares = steps - 1;
     static const int offset = 3 * FIXED_LOOKUP_SIZE / 4;
 
     for (int h = 0; h < HARMONICS + 1; ++h) {
       for (int i = 0; i < FIXED_LOOKUP_SIZE; ++i) {
-        buffer[h][i] = 0;
+        table->rows[h][i] = 0;
 
         for (size_t s = 0; s < squares; ++s) {
           int square_offset = (s * FIXED_LOOKUP_SIZE) / (2 * squares);
           int phase = (i + offset + square_offset) % FIXED_LOOKUP_SIZE;
-          buffer[h][i] += square_[h][phase] / squares;
+          table->rows[h][i] += square->rows[h][phase] / squares;
         }
       }
     }
 
-    preprocessDiffs(buffer);
+    preprocessDiffs(table);
   }
 
-  void FixedPointWaveLookup::preprocessDiffs(wave_type wave) {
-    for (int h = 0; h < HARMONICS + 1; ++h) {
+  void FixedPointWaveLookup::preprocessDiffs(Table* table) {
+    for (int r = 0; r < table->num_rows; ++r) {
+      wave_float* row = table->data + r * ROW_SIZE;
       for (int i = 0; i < FIXED_LOOKUP_SIZE - 1; ++i)
-        wave[h][i + FIXED_LOOKUP_SIZE] = FRACTIONAL_MULT * (wave[h][i + 1] - wave[h][i]);
+        row[i + FIXED_LOOKUP_SIZE] = FRACTIONAL_MULT * (row[i + 1] - row[i]);
 
-      mopo_float last_delta = wave[h][0] - wave[h][FIXED_LOOKUP_SIZE - 1];
-      wave[h][2 * FIXED_LOOKUP_SIZE - 1] = FRACTIONAL_MULT * last_delta;
+      mopo_float last_delta = row[0] - row[FIXED_LOOKUP_SIZE - 1];
+      row[2 * FIXED_LOOKUP_SIZE - 1] = FRACTIONAL_MULT * last_delta;
     }
   }
 
-  const FixedPointWaveLookup FixedPointWave::lookup_;
+  FixedPointWaveLookup FixedPointWave::lookup_;
 } // namespace mopo
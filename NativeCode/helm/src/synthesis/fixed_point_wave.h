@@ -21,13 +21,26 @@
 #include "common.h"
 #include "wave.h"
 #include "utils.h"
+#include <atomic>
 #include <climits>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 
 namespace mopo {
 
+  // Define MOPO_FLOAT_WAVE_TABLES to store the oscillator tables in single precision when the
+  // rest of the graph runs in double. Halves their memory.
+#if defined(MOPO_FLOAT_SAMPLES) || defined(MOPO_FLOAT_WAVE_TABLES)
+  typedef float wave_float;
+#else
+  typedef mopo_float wave_float;
+#endif
+
+  // Band limited versions of each waveform, one row per harmonic level. Each row is followed
+  // by the scaled differences to the next value for interpolation. A waveform's table is only
+  // built the first time it's prepared, so loading the library computes and holds nothing.
   class FixedPointWaveLookup {
     public:
       enum Type {
@@ -48,6 +61,7 @@ namespace mopo {
 
       static const int FIXED_LOOKUP_BITS = 10;
       static const int FIXED_LOOKUP_SIZE = 1024;
+      static const int ROW_SIZE = 2 * FIXED_LOOKUP_SIZE;
 
       static const int FRACTIONAL_BITS = 22;
       static const int FRACTIONAL_SIZE = 4194304;
@@ -56,63 +70,87 @@ namespace mopo {
 
       static const int HARMONICS = 63;
 
-      typedef mopo_float (*wave_type)[2 * FIXED_LOOKUP_SIZE];
+      // Rows can share storage when harmonic levels are identical, as they are for sin.
+      struct Table {
+        wave_float* rows[HARMONICS + 1];
+        wave_float* data;
+        int num_rows;
+      };
+
+      // Builds the table for waveform and the tables it's made from. Building locks and
+      // allocates, so call this off the audio thread before a waveform can play.
+      // Tables stay until the library unloads.
+      const Table* prepare(int waveform);
+
+      // Waveforms nobody prepared are built here as a fallback, on whatever thread asks.
+      inline const Table* table(int waveform) {
+        const Table* table = tables_[waveform].load(std::memory_order_acquire);
+        if (table)
+          return table;
+        return prepare(waveform);
+      }
 
-      FixedPointWaveLookup();
+      // Bytes held by the tables built so far.
+      size_t memoryUsed() const;
 
-      void preprocessSin();
-      void preprocessTriangle();
-      void preprocessSquare();
-      void preprocessDownSaw();
-      void preprocessUpSaw();
+    private:
+      Table* built(int waveform);
+      Table* build(int waveform);
+      static Table* createTable(int num_rows);
+
+      static void preprocessSin(Table* table);
+      static void preprocessTriangle(Table* table, const wave_float* sin);
+      static void preprocessSquare(Table* table, const wave_float* sin);
+      static void preprocessDownSaw(Table* table, const Table* up_saw);
+      static void preprocessUpSaw(Table* table, const wave_float* sin);
       template<size_t steps>
-      void preprocessStep(wave_type buffer);
+      static void preprocessStep(Table* table, const Table* up_saw, const Table* down_saw);
       template<size_t steps>
-      void preprocessPyramid(wave_type buffer);
-      void preprocessDiffs(wave_type wave);
-
-      mopo_float sin_[HARMONICS + 1][2 * FIXED_LOOKUP_SIZE];
-      mopo_float triangle_[HARMONICS + 1][2 * FIXED_LOOKUP_SIZE];
-      mopo_float square_[HARMONICS + 1][2 * FIXED_LOOKUP_SIZE];
-      mopo_float down_saw_[HARMONICS + 1][2 * FIXED_LOOKUP_SIZE];
-      mopo_float up_saw_[HARMONICS + 1][2 * FIXED_LOOKUP_SIZE];
-      mopo_float three_step_[HARMONICS + 1][2 * FIXED_LOOKUP_SIZE];
-      mopo_float four_step_[HARMONICS + 1][2 * FIXED_LOOKUP_SIZE];
-      mopo_float eight_step_[HARMONICS + 1][2 * FIXED_LOOKUP_SIZE];
-      mopo_float three_pyramid_[HARMONICS + 1][2 * FIXED_LOOKUP_SIZE];
-      mopo_float five_pyramid_[HARMONICS + 1][2 * FIXED_LOOKUP_SIZE];
-      mopo_float nine_pyramid_[HARMONICS + 1][2 * FIXED_LOOKUP_SIZE];
-
-      wave_type waves_[kNumFixedPointWaveforms];
+      static void preprocessPyramid(Table* table, const Table* square);
+      static void preprocessDiffs(Table* table);
+
+      std::mutex mutex_;
+      std::atomic<Table*> tables_[kNumFixedPointWaveforms];
   };
 
   class FixedPointWave {
     public:
       static inline mopo_float harmonicWave(int waveform, unsigned int t, int harmonic) {
-        return lookup_.waves_[waveform][harmonic][getIndex(t)];
+        return lookup_.table(waveform)->rows[harmonic][getIndex(t)];
       }
 
       static inline mopo_float wave(int waveform, unsigned int t, int phase_inc) {
-        return lookup_.waves_[waveform][getHarmonicIndex(phase_inc)][getIndex(t)];
+        return lookup_.table(waveform)->rows[getHarmonicIndex(phase_inc)][getIndex(t)];
       }
 
       static inline mopo_float wave(int waveform, unsigned int t) {
         unsigned int index = getIndex(t);
-        return lookup_.waves_[waveform][0][index];
+        return lookup_.table(waveform)->rows[0][index];
       }
 
-      static inline mopo_float* getBuffer(int waveform, int phase_inc) {
+      static inline const wave_float* getBuffer(int waveform, int phase_inc) {
         int clamped_inc = mopo::utils::iclamp(phase_inc, 1, INT_MAX);
-        return lookup_.waves_[waveform][getHarmonicIndex(clamped_inc)];
+        return lookup_.table(waveform)->rows[getHarmonicIndex(clamped_inc)];
       }
 
+      static void prepare(int waveform) {
+        lookup_.prepare(mopo::utils::iclamp(waveform, 0, FixedPointWaveLookup::kWhiteNoise - 1));
+      }
+
+      static void prepareAll() {
+        for (int i = 0; i < FixedPointWaveLookup::kWhiteNoise; ++i)
+          lookup_.prepare(i);
+      }
+
+      static size_t memoryUsed() { return lookup_.memoryUsed(); }
+
       static inline int getHarmonicIndex(int phase_inc) {
         int ratio = INT_MAX / phase_inc;
         return mopo::utils::iclamp(FixedPointWaveLookup::HARMONICS + 1 - ratio,
                                    0, FixedPointWaveLookup::HARMONICS - 1);
       }
 
-      static inline mopo_float interpretWave(const mopo_float* buffer, unsigned int t) {
+      static inline mopo_float interpretWave(const wave_float* buffer, unsigned int t) {
         int index = getIndex(t);
         mopo_float mult = getFractional(t);
         mopo_float inc = mult * buffer[index + FixedPointWaveLookup::FIXED_LOOKUP_SIZE];
@@ -128,7 +166,7 @@ namespace mopo {
       }
 
     protected:
-      static const FixedPointWaveLookup lookup_;
+      static FixedPointWaveLookup lookup_;
   };
 } // namespace mopo
 
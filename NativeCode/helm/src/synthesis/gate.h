@@ -34,6 +34,7 @@ namespace mopo {
       virtual void destroy() override;
       virtual Processor* clone() const override { return new Gate(*this); }
       void process() override;
+      virtual bool aliasesInputs() const override { return true; }
 
     private:
       void setSource(int source);
@@ -22,6 +22,8 @@
 #include "peak_meter.h"
 #include "value_switch.h"
 
+#include <algorithm>
+
 #ifdef __APPLE__
 #include <fenv.h>
 #endif
@@ -30,9 +32,26 @@
 
 namespace mopo {
 
-  HelmEngine::HelmEngine() : was_playing_arp_(false) {
+  namespace {
+    // Binary search for name in the name ordered range [begin, end) of table.
+    template<class T>
+    int findByName(const std::vector<T>& table, int begin, int end, const std::string& name) {
+      auto first = table.begin() + begin;
+      auto last = table.begin() + end;
+      auto found = std::lower_bound(first, last, name,
+                                    [](const T& entry, const std::string& search) {
+                                      return entry.name < search;
+                                    });
+      if (found == last || found->name != name)
+        return -1;
+      return found - table.begin();
+    }
+  } // namespace
+
+  HelmEngine::HelmEngine() : was_playing_arp_(false), num_mono_destinations_(0) {
     init();
     bps_ = controls_["beats_per_minute"];
+    buildModulationTables();
   }
 
   HelmEngine::~HelmEngine() {
@@ -285,26 +304,73 @@ namespace mopo {
     HelmModule::init();
   }
 
+  void HelmEngine::buildModulationTables() {
+    for (auto& source : getModulationSources()) {
+      ModulationSource entry = { source.first, source.second };
+      modulation_sources_.push_back(entry);
+    }
+
+    std::vector<std::string> destination_names;
+    for (auto& destination : getMonoModulations())
+      destination_names.push_back(destination.first);
+    num_mono_destinations_ = destination_names.size();
+    for (auto& destination : getPolyModulations())
+      destination_names.push_back(destination.first);
+
+    for (const std::string& name : destination_names) {
+      ModulationDestination entry = { name,
+                                      getMonoModulationDestination(name),
+                                      getPolyModulationDestination(name),
+                                      getMonoModulationSwitch(name),
+                                      getPolyModulationSwitch(name) };
+      modulation_destinations_.push_back(entry);
+    }
+  }
+
+  int HelmEngine::getModulationSourceIndex(const std::string& name) const {
+    return findByName(modulation_sources_, 0, modulation_sources_.size(), name);
+  }
+
+  int HelmEngine::getModulationDestinationIndex(const std::string& name) const {
+    int index = findByName(modulation_destinations_, 0, num_mono_destinations_, name);
+    if (index >= 0)
+      return index;
+    return findByName(modulation_destinations_, num_mono_destinations_,
+                      modulation_destinations_.size(), name);
+  }
+
+  void HelmEngine::resolveModulation(ModulationConnection* connection) {
+    if (connection->source_index < 0)
+      connection->source_index = getModulationSourceIndex(connection->source);
+    if (connection->destination_index < 0)
+      connection->destination_index = getModulationDestinationIndex(connection->destination);
+  }
+
   void HelmEngine::connectModulation(ModulationConnection* connection) {
-    Output* source = getModulationSource(connection->source);
+    resolveModulation(connection);
+    MOPO_ASSERT(connection->source_index >= 0 &&
+                connection->source_index < modulation_sources_.size());
+    MOPO_ASSERT(connection->destination_index >= 0 &&
+                connection->destination_index < modulation_destinations_.size());
+
+    Output* source = modulation_sources_[connection->source_index].output;
+    const ModulationDestination& mod = modulation_destinations_[connection->destination_index];
     bool source_poly = source->owner->isPolyphonic();
-    MOPO_ASSERT(source != nullptr);
 
-    Processor* destination = getModulationDestination(connection->destination, source_poly);
+    Processor* destination = mod.mono_destination;
+    if (source_poly && mod.poly_destination)
+      destination = mod.poly_destination;
     MOPO_ASSERT(destination != nullptr);
-
-    ValueSwitch* mono_mod_switch = getMonoModulationSwitch(connection->destination);
-    MOPO_ASSERT(mono_mod_switch != nullptr);
+    MOPO_ASSERT(mod.mono_switch != nullptr);
 
     connection->modulation_scale.plug(source, 0);
     connection->modulation_scale.plug(&connection->amount, 1);
     source->owner->router()->addProcessor(&connection->modulation_scale);
     destination->plugNext(&connection->modulation_scale);
 
-    mono_mod_switch->set(1);
-    ValueSwitch* poly_mod_switch = getPolyModulationSwitch(connection->destination);
-    if (poly_mod_switch)
-      poly_mod_switch->set(1);
+    mod.mono_switch->set(1);
+    if (mod.poly_switch)
+      mod.poly_switch->set(1);
 
     mod_connections_.insert(connection);
   }
@@ -320,24 +386,23 @@ namespace mopo {
   }
 
   void HelmEngine::disconnectModulation(ModulationConnection* connection) {
-    Output* source = getModulationSource(connection->source);
+    resolveModulation(connection);
+    Output* source = modulation_sources_[connection->source_index].output;
+    const ModulationDestination& mod = modulation_destinations_[connection->destination_index];
     bool source_poly = source->owner->isPolyphonic();
 
-    Processor* destination = getModulationDestination(connection->destination, source_poly);
-    Processor* mono_destination = getMonoModulationDestination(connection->destination);
-    Processor* poly_destination = getPolyModulationDestination(connection->destination);
+    Processor* destination = mod.mono_destination;
+    if (source_poly && mod.poly_destination)
+      destination = mod.poly_destination;
     MOPO_ASSERT(destination != nullptr);
 
     destination->unplug(&connection->modulation_scale);
 
-    if (mono_destination->connectedInputs() == 1 &&
-        (poly_destination == nullptr || poly_destination->connectedInputs() == 0)) {
-      ValueSwitch* mono_mod_switch = getMonoModulationSwitch(connection->destination);
-      mono_mod_switch->set(0);
-
-      ValueSwitch* poly_mod_switch = getPolyModulationSwitch(connection->destination);
-      if (poly_mod_switch)
-        poly_mod_switch->set(0);
+    if (mod.mono_destination->connectedInputs() == 1 &&
+        (mod.poly_destination == nullptr || mod.poly_destination->connectedInputs() == 0)) {
+      mod.mono_switch->set(0);
+      if (mod.poly_switch)
+        mod.poly_switch->set(0);
     }
 
     source->owner->router()->removeProcessor(&connection->modulation_scale);
@@ -348,6 +413,10 @@ namespace mopo {
     return voice_handler_->getNumActiveVoices();
   }
 
+  void HelmEngine::setVoiceWorkers(VoiceWorkers* workers) {
+    voice_handler_->setVoiceWorkers(workers);
+  }
+
   mopo_float HelmEngine::getLastActiveNote() const {
     return voice_handler_->getLastActiveNote();
   }
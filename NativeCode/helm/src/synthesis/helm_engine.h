@@ -48,8 +48,23 @@ namespace mopo {
       void connectModulation(ModulationConnection* connection);
       void disconnectModulation(ModulationConnection* connection);
       int getNumActiveVoices();
+      void setVoiceWorkers(VoiceWorkers* workers);
       mopo_float getLastActiveNote() const;
 
+      // Modulation tables are built once on construction and never change.
+      // Sources are ordered by name. Destinations are the mono destinations ordered by
+      // name followed by the poly destinations ordered by name.
+      int getNumModulationSources() const { return modulation_sources_.size(); }
+      int getNumModulationDestinations() const { return modulation_destinations_.size(); }
+      int getModulationSourceIndex(const std::string& name) const;
+      int getModulationDestinationIndex(const std::string& name) const;
+      const std::string& getModulationSourceName(int index) const {
+        return modulation_sources_[index].name;
+      }
+      const std::string& getModulationDestinationName(int index) const {
+        return modulation_destinations_[index].name;
+      }
+
       // Keyboard events.
       void allNotesOff(int sample = 0) override;
       void noteOn(mopo_float note, mopo_float velocity = 1.0,
@@ -66,6 +81,22 @@ namespace mopo {
       void sustainOff();
 
     private:
+      struct ModulationSource {
+        std::string name;
+        Output* output;
+      };
+
+      struct ModulationDestination {
+        std::string name;
+        Processor* mono_destination;
+        Processor* poly_destination;
+        ValueSwitch* mono_switch;
+        ValueSwitch* poly_switch;
+      };
+
+      void buildModulationTables();
+      void resolveModulation(ModulationConnection* connection);
+
       HelmVoiceHandler* voice_handler_;
       Arpeggiator* arpeggiator_;
       ValueSwitch* arp_on_;
@@ -81,6 +112,9 @@ namespace mopo {
       StepGenerator* step_sequencer_;
 
       std::set<ModulationConnection*> mod_connections_;
+      std::vector<ModulationSource> modulation_sources_;
+      std::vector<ModulationDestination> modulation_destinations_;
+      int num_mono_destinations_;
   };
 } // namespace mopo
 
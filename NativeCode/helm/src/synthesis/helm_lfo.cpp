@@ -24,7 +24,7 @@ namespace mopo {
 
   namespace {
     mopo_float randomLfoValue() {
-      return 2.0 * rand() / RAND_MAX - 1.0;
+      return 2.0 * utils::randomInt() / RAND_MAX - 1.0;
     }
   } // namespace
 
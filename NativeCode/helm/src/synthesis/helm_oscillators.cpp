@@ -51,6 +51,7 @@ namespace mopo {
     for (int i = 0; i < MAX_BUFFER_SIZE; ++i) {
       oscillator1_phase_diffs_[i] = 0;
       oscillator2_phase_diffs_[i] = 0;
+      phase_bases_[i] = 0;
     }
   }
 
@@ -66,8 +67,8 @@ namespace mopo {
     oscillator2_phases_[0] = 0;
 
     for (int u = 1; u < MAX_UNISON; ++u) {
-      oscillator1_phases_[u] = (UINT_MAX / RAND_MAX) * rand();
-      oscillator2_phases_[u] = (UINT_MAX / RAND_MAX) * rand();
+      oscillator1_phases_[u] = (UINT_MAX / RAND_MAX) * utils::randomInt();
+      oscillator2_phases_[u] = (UINT_MAX / RAND_MAX) * utils::randomInt();
     }
   }
 
@@ -110,7 +111,7 @@ namespace mopo {
     }
   }
 
-  void HelmOscillators::prepareBuffers(mopo_float** wave_buffers,
+  void HelmOscillators::prepareBuffers(const wave_float** wave_buffers,
                                        const int* detune_diffs,
                                        const int* oscillator_phase_diffs,
                                        int waveform) {
@@ -181,6 +182,49 @@ namespace mopo {
     }
   }
 
+  void HelmOscillators::sumVoices(mopo_float* totals, const unsigned int* phase_bases,
+                                  const wave_float* const* wave_buffers,
+                                  const unsigned int* start_phases, const int* detunes,
+                                  int voices, int samples) {
+    int v = 1;
+    for (; v + 1 < voices; v += 2) {
+      const wave_float* wave_buffer1 = wave_buffers[v];
+      const wave_float* wave_buffer2 = wave_buffers[v + 1];
+      unsigned int phase1 = start_phases[v];
+      unsigned int phase2 = start_phases[v + 1];
+      unsigned int phase_inc1 = detunes[v];
+      unsigned int phase_inc2 = detunes[v + 1];
+
+      for (int i = 0; i < samples; ++i) {
+        totals[i] += FixedPointWave::interpretWave(wave_buffer1, phase_bases[i] + phase1) +
+                     FixedPointWave::interpretWave(wave_buffer2, phase_bases[i] + phase2);
+        phase1 += phase_inc1;
+        phase2 += phase_inc2;
+      }
+    }
+
+    sumVoicesReference(totals, phase_bases, wave_buffers + v - 1,
+                       start_phases + v - 1, detunes + v - 1, voices - v + 1, samples);
+  }
+
+  void HelmOscillators::sumVoicesReference(mopo_float* totals,
+                                           const unsigned int* phase_bases,
+                                           const wave_float* const* wave_buffers,
+                                           const unsigned int* start_phases,
+                                           const int* detunes,
+                                           int voices, int samples) {
+    for (int v = 1; v < voices; ++v) {
+      const wave_float* wave_buffer = wave_buffers[v];
+      unsigned int phase = start_phases[v];
+      unsigned int phase_inc = detunes[v];
+
+      for (int i = 0; i < samples; ++i) {
+        totals[i] += FixedPointWave::interpretWave(wave_buffer, phase_bases[i] + phase);
+        phase += phase_inc;
+      }
+    }
+  }
+
   void HelmOscillators::processVoices() {
     int voices1 = utils::iclamp(input(kUnisonVoices1)->source->buffer[0], 1, MAX_UNISON);
     int voices2 = utils::iclamp(input(kUnisonVoices2)->source->buffer[0], 1, MAX_UNISON);
@@ -201,39 +245,22 @@ namespace mopo {
     for (; j < buffer_size_; ++j)
       tickInitialVoices(j);
 
-    for (int v = 1; v < voices1; ++v) {
-      const mopo_float* wave_buffer = wave_buffers1_[v];
-      unsigned int start_phase = oscillator1_phases_[v];
-      int detune = detune_diffs1_[v];
+    for (int i = 0; i < buffer_size_; ++i)
+      phase_bases_[i] = oscillator1_cross_mods_[i] + oscillator1_phase_diffs_[i];
+    sumVoices(oscillator1_totals_, phase_bases_, wave_buffers1_,
+              oscillator1_phases_, detune_diffs1_, voices1, buffer_size_);
 
-      int i = 0;
-      if (input(kReset)->source->triggered) {
-        int trigger_offset = input(kReset)->source->trigger_offset;
-        for (; i < trigger_offset; ++i)
-          tickVoice1(i, v, wave_buffer, start_phase, detune);
+    for (int i = 0; i < buffer_size_; ++i)
+      phase_bases_[i] = oscillator2_cross_mods_[i] + oscillator2_phase_diffs_[i];
+    sumVoices(oscillator2_totals_, phase_bases_, wave_buffers2_,
+              oscillator2_phases_, detune_diffs2_, voices2, buffer_size_);
 
-        oscillator1_phases_[v] = (UINT_MAX / RAND_MAX) * rand();
-      }
-
-      for (; i < buffer_size_; ++i)
-        tickVoice1(i, v, wave_buffer, start_phase, detune);
-    }
-
-    for (int v = 1; v < voices2; ++v) {
-      const mopo_float* wave_buffer = wave_buffers2_[v];
-      unsigned int start_phase = oscillator2_phases_[v];
-      int detune = detune_diffs2_[v];
-
-      int i = 0;
-      if (input(kReset)->source->triggered) {
-        int trigger_offset = input(kReset)->source->trigger_offset;
-        for (; i < trigger_offset; ++i)
-          tickVoice2(i, v, wave_buffer, start_phase, detune);
-
-        oscillator2_phases_[v] = (UINT_MAX / RAND_MAX) * rand();
-      }
-      for (; i < buffer_size_; ++i)
-        tickVoice2(i, v, wave_buffer, start_phase, detune);
+    // Unison voices only pick up their new phase next block.
+    if (input(kReset)->source->triggered) {
+      for (int v = 1; v < voices1; ++v)
+        oscillator1_phases_[v] = (UINT_MAX / RAND_MAX) * utils::randomInt();
+      for (int v = 1; v < voices2; ++v)
+        oscillator2_phases_[v] = (UINT_MAX / RAND_MAX) * utils::randomInt();
     }
 
     finishVoices(voices1, voices2);
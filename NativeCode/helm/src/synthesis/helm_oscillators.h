@@ -54,6 +54,22 @@ namespace mopo {
       Output* getOscillator1Output() { return output(0); }
       Output* getOscillator2Output() { return output(1); }
 
+      // Adds unison voices 1 through _voices_ - 1 into _totals_. Voice v reads
+      // _wave_buffers_[v] at phase _phase_bases_[i] + _start_phases_[v] + i * _detunes_[v].
+      // Voices run in pairs so the two table reads overlap and each sample's
+      // total is loaded and stored once per pair.
+      static void sumVoices(mopo_float* totals, const unsigned int* phase_bases,
+                            const wave_float* const* wave_buffers,
+                            const unsigned int* start_phases, const int* detunes,
+                            int voices, int samples);
+
+      // One voice at a time over the whole block. Kept as the reference sumVoices
+      // is checked against, the two only differ in the order voices are summed.
+      static void sumVoicesReference(mopo_float* totals, const unsigned int* phase_bases,
+                                     const wave_float* const* wave_buffers,
+                                     const unsigned int* start_phases, const int* detunes,
+                                     int voices, int samples);
+
     protected:
       void reset(int i);
       void loadBasePhaseInc();
@@ -61,7 +77,7 @@ namespace mopo {
                                int oscillator_diff,
                                bool harmonize, mopo_float detune,
                                int voices);
-      void prepareBuffers(mopo_float** wave_buffers,
+      void prepareBuffers(const wave_float** wave_buffers,
                           const int* detune_diffs,
                           const int* oscillator_phase_diffs,
                           int waveform);
@@ -92,20 +108,6 @@ namespace mopo {
         oscillator2_totals_[i] += FixedPointWave::interpretWave(wave_buffers2_[0], phase2);
       }
 
-      inline void tickVoice1(int i, int voice, const mopo_float* wave_buffer,
-                             unsigned int start_phase, int detune) {
-        int phase = oscillator1_cross_mods_[i] + start_phase +
-                    i * detune + oscillator1_phase_diffs_[i];
-        oscillator1_totals_[i] += FixedPointWave::interpretWave(wave_buffer, phase);
-      }
-
-      inline void tickVoice2(int i, int voice, const mopo_float* wave_buffer,
-                             unsigned int start_phase, int detune) {
-        int phase = oscillator2_cross_mods_[i] + start_phase +
-                    i * detune + oscillator2_phase_diffs_[i];
-        oscillator2_totals_[i] += FixedPointWave::interpretWave(wave_buffer, phase);
-      }
-
       inline void tickOut(int i, mopo_float* dest,
                           const mopo_float* amp1, const mopo_float* amp2,
                           const mopo_float* oscillator1_totals,
@@ -128,12 +130,13 @@ namespace mopo {
       unsigned int oscillator1_phases_[MAX_UNISON];
       unsigned int oscillator2_phases_[MAX_UNISON];
 
-      mopo_float* wave_buffers1_[MAX_UNISON];
-      mopo_float* wave_buffers2_[MAX_UNISON];
+      const wave_float* wave_buffers1_[MAX_UNISON];
+      const wave_float* wave_buffers2_[MAX_UNISON];
       int detune_diffs1_[MAX_UNISON];
       int detune_diffs2_[MAX_UNISON];
       int oscillator1_phase_diffs_[MAX_BUFFER_SIZE];
       int oscillator2_phase_diffs_[MAX_BUFFER_SIZE];
+      unsigned int phase_bases_[MAX_BUFFER_SIZE];
   };
 } // namespace mopo
 
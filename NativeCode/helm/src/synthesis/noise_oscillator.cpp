@@ -38,7 +38,7 @@ namespace mopo {
       for (; i < trigger_offset; ++i)
         tick(i, dest, amplitude);
 
-      current_noise_value_ = rand() / mopo_float(RAND_MAX);
+      current_noise_value_ = utils::randomInt() / mopo_float(RAND_MAX);
     }
     for (; i < buffer_size_; ++i)
       tick(i, dest, amplitude);
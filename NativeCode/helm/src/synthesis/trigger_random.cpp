@@ -16,6 +16,8 @@
 
 #include "trigger_random.h"
 
+#include "utils.h"
+
 #include <cstdlib>
 
 namespace mopo {
@@ -24,7 +26,7 @@ namespace mopo {
 
   void TriggerRandom::process() {
     if (input()->source->triggered)
-      value_ = 2.0 * rand() / RAND_MAX - 1.0;
+      value_ = 2.0 * utils::randomInt() / RAND_MAX - 1.0;
 
     output()->buffer[0] = value_;
   }
@@ -38,6 +38,19 @@ namespace mopo {
     setSource(value);
   }
 
+  void ValueSwitch::separate(const OutputMap& outputs) {
+    // Only the original is ever set so find the input it switched to.
+    int source = -1;
+    for (int i = 0; i < numInputs() && source < 0; ++i) {
+      if (input(i)->source->buffer == output(kSwitch)->buffer)
+        source = i;
+    }
+
+    cr::Value::separate(outputs);
+    if (source >= 0)
+      output(kSwitch)->buffer = input(source)->source->buffer;
+  }
+
   inline void ValueSwitch::setSource(int source) {
     bool enable_processors = source != 0;
     source = utils::iclamp(source, 0, numInputs() - 1);
@@ -36,6 +36,8 @@ namespace mopo {
       virtual Processor* clone() const override { return new ValueSwitch(*this); }
       virtual void process() override { }
       virtual void set(mopo_float value) override;
+      virtual bool aliasesInputs() const override { return true; }
+      virtual void separate(const OutputMap& outputs) override;
 
       void addProcessor(Processor* processor) { processors_.push_back(processor); }
 
@@ -0,0 +1,98 @@
+/* Copyright 2017 Matt Tytel */
+
+#include "helm_engine_pool.h"
+
+#include "helm_engine.h"
+
+#include <algorithm>
+
+namespace Helm {
+
+  namespace {
+    mopo::HelmEngine* createEngine() {
+      mopo::HelmEngine* engine = new mopo::HelmEngine();
+      // The first sample rate change clones every voice's processors. Later ones are cheap.
+      engine->setSampleRate(mopo::DEFAULT_SAMPLE_RATE);
+      return engine;
+    }
+  } // namespace
+
+  EnginePool::EnginePool() : reserved_(0), running_(false) { }
+
+  EnginePool::~EnginePool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      running_ = false;
+    }
+    wake_.notify_all();
+
+    if (thread_.joinable())
+      thread_.join();
+
+    for (mopo::HelmEngine* engine : engines_)
+      delete engine;
+  }
+
+  void EnginePool::reserve(int num_engines) {
+    std::vector<mopo::HelmEngine*> extra;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      reserved_ = std::max(0, std::min(kMaxEngines, num_engines));
+      while (engines_.size() > reserved_) {
+        extra.push_back(engines_.back());
+        engines_.pop_back();
+      }
+
+      if (reserved_ && !running_) {
+        running_ = true;
+        thread_ = std::thread(&EnginePool::build, this);
+      }
+    }
+    wake_.notify_all();
+
+    for (mopo::HelmEngine* engine : extra)
+      delete engine;
+  }
+
+  int EnginePool::available() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return engines_.size();
+  }
+
+  mopo::HelmEngine* EnginePool::take() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!engines_.empty()) {
+        mopo::HelmEngine* engine = engines_.back();
+        engines_.pop_back();
+        wake_.notify_all();
+        return engine;
+      }
+    }
+
+    return createEngine();
+  }
+
+  void EnginePool::build() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      wake_.wait(lock, [this] { return !running_ || engines_.size() < reserved_; });
+      if (!running_)
+        return;
+
+      // Building takes a while so take and reserve aren't held up by it.
+      lock.unlock();
+      mopo::HelmEngine* engine = createEngine();
+      lock.lock();
+
+      if (running_ && engines_.size() < reserved_)
+        engines_.push_back(engine);
+      else {
+        lock.unlock();
+        delete engine;
+        lock.lock();
+      }
+    }
+  }
+
+} // Helm
@@ -0,0 +1,48 @@
+/* Copyright 2017 Matt Tytel */
+
+#pragma once
+#ifndef HELM_ENGINE_POOL_H
+#define HELM_ENGINE_POOL_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mopo {
+  class HelmEngine;
+} // namespace mopo
+
+namespace Helm {
+
+  // Engines built ahead of time on a background thread. Building a HelmEngine takes
+  // milliseconds, so taking a built one makes a new Helm instance close to free.
+  // Engines are only handed out once, released instances delete their own engine.
+  class EnginePool {
+    public:
+      static const int kMaxEngines = 64;
+
+      EnginePool();
+      ~EnginePool();
+
+      // Keeps up to num_engines built and waiting. Zero stops building and frees waiting engines.
+      void reserve(int num_engines);
+      int available() const;
+
+      // Returns a waiting engine, or builds one on the calling thread if none are.
+      mopo::HelmEngine* take();
+
+    private:
+      void build();
+
+      std::thread thread_;
+      mutable std::mutex mutex_;
+      std::condition_variable wake_;
+      std::vector<mopo::HelmEngine*> engines_;
+      int reserved_;
+      bool running_;
+  };
+
+} // Helm
+
+#endif // HELM_ENGINE_POOL_H
@@ -0,0 +1,385 @@
+/* Copyright 2017 Matt Tytel */
+
+#include "helm_midi.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace Helm {
+
+  namespace {
+    const int kChannels = 16;
+    const int kKeys = 128;
+    const double kDefaultBpm = 120.0;
+    const double kDefaultMicrosecondsPerQuarter = 500000.0;
+    const double kSixteenthsPerQuarter = 4.0;
+    const double kSecondsPerMinute = 60.0;
+
+    enum MidiStatus {
+      kNoteOff = 0x80,
+      kNoteOn = 0x90,
+      kProgramChange = 0xc0,
+      kChannelPressure = 0xd0,
+      kSystemExclusive = 0xf0,
+      kEscape = 0xf7,
+      kMeta = 0xff
+    };
+
+    enum MetaType {
+      kEndOfTrack = 0x2f,
+      kTempo = 0x51
+    };
+
+    struct TickNote {
+      unsigned long long start;
+      unsigned long long end;
+      int key;
+      int velocity;
+    };
+
+    struct TempoChange {
+      unsigned long long tick;
+      double seconds_per_tick;
+      double seconds;
+    };
+
+    class Reader {
+      public:
+        Reader(const unsigned char* data, size_t size) : data_(data), size_(size), position_(0) { }
+
+        bool done() const { return position_ >= size_; }
+        size_t remaining() const { return size_ - position_; }
+
+        bool byte(int* value) {
+          if (done())
+            return false;
+          *value = data_[position_++];
+          return true;
+        }
+
+        bool bigEndian(int num_bytes, unsigned int* value) {
+          if (remaining() < (size_t)num_bytes)
+            return false;
+          *value = 0;
+          for (int i = 0; i < num_bytes; ++i)
+            *value = (*value << 8) | data_[position_++];
+          return true;
+        }
+
+        // Variable length quantities are at most four bytes.
+        bool variableLength(unsigned int* value) {
+          *value = 0;
+          for (int i = 0; i < 4; ++i) {
+            int next = 0;
+            if (!byte(&next))
+              return false;
+            *value = (*value << 7) | (next & 0x7f);
+            if ((next & 0x80) == 0)
+              return true;
+          }
+          return false;
+        }
+
+        bool skip(size_t num_bytes) {
+          if (remaining() < num_bytes)
+            return false;
+          position_ += num_bytes;
+          return true;
+        }
+
+        const unsigned char* current() const { return data_ + position_; }
+
+      private:
+        const unsigned char* data_;
+        size_t size_;
+        size_t position_;
+    };
+
+    bool isChunk(const unsigned char* data, const char* type) {
+      return memcmp(data, type, 4) == 0;
+    }
+
+    // Ticks per quarter, or SMPTE frames per second with ticks per frame. Only the
+    // standard 24, 25, 29.97 and 30 frame rates are SMPTE divisions.
+    bool validDivision(unsigned int division) {
+      if ((division & 0x8000) == 0)
+        return division != 0;
+
+      int frames = -(signed char)(division >> 8);
+      bool standard_rate = frames == 24 || frames == 25 || frames == 29 || frames == 30;
+      return standard_rate && (division & 0xff) != 0;
+    }
+
+    // Note ons pair with the earliest unfinished note of the same channel and key.
+    bool readTrack(Reader track, std::vector<TickNote>* notes, std::vector<TempoChange>* tempos,
+                   unsigned long long* end_tick) {
+      std::vector<size_t> open_notes[kChannels * kKeys];
+      unsigned long long tick = 0;
+      int running_status = 0;
+
+      while (!track.done()) {
+        unsigned int delta = 0;
+        int status = 0;
+        if (!track.variableLength(&delta) || !track.byte(&status))
+          return false;
+        tick += delta;
+
+        if (status == kMeta) {
+          int type = 0;
+          unsigned int length = 0;
+          if (!track.byte(&type) || !track.variableLength(&length) || track.remaining() < length)
+            return false;
+
+          if (type == kTempo && length == 3) {
+            unsigned int microseconds = 0;
+            track.bigEndian(3, &microseconds);
+            TempoChange tempo = { tick, 1e-6 * microseconds, 0.0 };
+            tempos->push_back(tempo);
+          }
+          else
+            track.skip(length);
+
+          if (type == kEndOfTrack)
+            break;
+          continue;
+        }
+        if (status == kSystemExclusive || status == kEscape) {
+          unsigned int length = 0;
+          if (!track.variableLength(&length) || !track.skip(length))
+            return false;
+          continue;
+        }
+        if (status >= kSystemExclusive)
+          return false;
+
+        int data1 = status;
+        if (status & 0x80) {
+          running_status = status;
+          if (!track.byte(&data1))
+            return false;
+        }
+        else if (running_status == 0)
+          return false;
+        status = running_status;
+
+        int command = status & 0xf0;
+        int data2 = 0;
+        if (command != kProgramChange && command != kChannelPressure && !track.byte(&data2))
+          return false;
+
+        if (command != kNoteOn && command != kNoteOff)
+          continue;
+
+        std::vector<size_t>& open = open_notes[(status & 0x0f) * kKeys + (data1 & 0x7f)];
+        if (command == kNoteOn && data2 > 0) {
+          TickNote note = { tick, tick, data1 & 0x7f, data2 & 0x7f };
+          open.push_back(notes->size());
+          notes->push_back(note);
+        }
+        else if (!open.empty()) {
+          (*notes)[open.front()].end = tick;
+          open.erase(open.begin());
+        }
+      }
+
+      // Notes still held end with the track.
+      for (const std::vector<size_t>& open : open_notes) {
+        for (size_t index : open)
+          (*notes)[index].end = tick;
+      }
+      *end_tick = tick;
+      return true;
+    }
+
+    class TempoMap {
+      public:
+        // Musical files without a bpm convert ticks straight to sixteenths.
+        TempoMap(std::vector<TempoChange>* tempos, int division, double bpm) {
+          sixteenths_per_second_ = kSixteenthsPerQuarter * (bpm > 0.0 ? bpm : kDefaultBpm) / kSecondsPerMinute;
+          sixteenths_per_tick_ = 0.0;
+
+          if (division & 0x8000) {
+            // SMPTE division: negative frames per second in the high byte, 29 meaning 29.97.
+            int frames = -(signed char)(division >> 8);
+            double frame_rate = frames == 29 ? 30000.0 / 1001.0 : frames;
+            TempoChange change = { 0, 1.0 / (frame_rate * (division & 0xff)), 0.0 };
+            changes_.push_back(change);
+            return;
+          }
+
+          if (bpm <= 0.0) {
+            sixteenths_per_tick_ = kSixteenthsPerQuarter / division;
+            return;
+          }
+
+          std::stable_sort(tempos->begin(), tempos->end(), [](const TempoChange& a, const TempoChange& b) {
+            return a.tick < b.tick;
+          });
+          TempoChange start = { 0, 1e-6 * kDefaultMicrosecondsPerQuarter / division, 0.0 };
+          changes_.push_back(start);
+          for (TempoChange change : *tempos) {
+            TempoChange& last = changes_.back();
+            change.seconds = last.seconds + (change.tick - last.tick) * last.seconds_per_tick;
+            change.seconds_per_tick /= division;
+            if (change.tick == last.tick)
+              last = change;
+            else
+              changes_.push_back(change);
+          }
+        }
+
+        double sixteenths(unsigned long long tick) const {
+          if (changes_.empty())
+            return sixteenths_per_tick_ * tick;
+
+          auto after = std::upper_bound(changes_.begin(), changes_.end(), tick,
+                                        [](unsigned long long t, const TempoChange& change) {
+            return t < change.tick;
+          });
+          const TempoChange& change = *(after - 1);
+          double seconds = change.seconds + (tick - change.tick) * change.seconds_per_tick;
+          return seconds * sixteenths_per_second_;
+        }
+
+      private:
+        std::vector<TempoChange> changes_;
+        double sixteenths_per_second_;
+        double sixteenths_per_tick_;
+    };
+  } // namespace
+
+  bool readMidiFile(const void* data, size_t size, double bpm, MidiNotes* midi) {
+    if (data == nullptr)
+      return false;
+
+    Reader file(static_cast<const unsigned char*>(data), size);
+    unsigned int header_size = 0;
+    unsigned int format = 0;
+    unsigned int num_tracks = 0;
+    unsigned int division = 0;
+    if (file.remaining() < 8 || !isChunk(file.current(), "MThd") || !file.skip(4) ||
+        !file.bigEndian(4, &header_size) || header_size < 6 ||
+        !file.bigEndian(2, &format) || !file.bigEndian(2, &num_tracks) || !file.bigEndian(2, &division) ||
+        !file.skip(header_size - 6)) {
+      return false;
+    }
+    if (format > 1 || !validDivision(division))
+      return false;
+
+    std::vector<TickNote> notes;
+    std::vector<TempoChange> tempos;
+    unsigned long long end_tick = 0;
+    for (unsigned int track = 0; track < num_tracks;) {
+      unsigned int chunk_size = 0;
+      if (file.remaining() < 8)
+        return false;
+      bool is_track = isChunk(file.current(), "MTrk");
+      file.skip(4);
+      if (!file.bigEndian(4, &chunk_size) || file.remaining() < chunk_size)
+        return false;
+
+      // Unknown chunks are skipped.
+      if (is_track) {
+        unsigned long long track_end = 0;
+        if (!readTrack(Reader(file.current(), chunk_size), &notes, &tempos, &track_end))
+          return false;
+        end_tick = std::max(end_tick, track_end);
+        track++;
+      }
+      file.skip(chunk_size);
+    }
+
+    TempoMap tempo_map(&tempos, division, bpm);
+    midi->notes.resize(notes.size());
+    midi->length = tempo_map.sixteenths(end_tick);
+    midi->max_note_length = 0.0;
+    for (size_t i = 0; i < notes.size(); ++i) {
+      HelmSequencer::NoteData& note = midi->notes[i];
+      note.midi_note = notes[i].key;
+      note.velocity = std::min(1.0f, notes[i].velocity / 127.0f);
+      note.start = tempo_map.sixteenths(notes[i].start);
+      note.end = tempo_map.sixteenths(notes[i].end);
+      midi->max_note_length = std::max(midi->max_note_length, note.end - note.start);
+    }
+
+    std::stable_sort(midi->notes.begin(), midi->notes.end(),
+                     [](const HelmSequencer::NoteData& a, const HelmSequencer::NoteData& b) {
+      return a.start < b.start;
+    });
+    return true;
+  }
+
+  MidiStream::MidiStream(HelmSequencer* sequencer) :
+      sequencer_(sequencer), next_note_(0), position_(0.0) {
+    midi_.length = 0.0;
+    midi_.max_note_length = 0.0;
+  }
+
+  bool MidiStream::open(const void* data, size_t size, double bpm) {
+    if (!readMidiFile(data, size, bpm, &midi_))
+      return false;
+
+    next_note_ = 0;
+    position_ = 0.0;
+    return true;
+  }
+
+  bool MidiStream::restarting() const {
+    return sequencer_->current_position() < position_;
+  }
+
+  void MidiStream::restart(double position, double window_end) {
+    sequencer_->clearNotes();
+
+    // Only notes that started up to the longest note ago can still be playing.
+    HelmSequencer::NoteData first;
+    first.start = position - midi_.max_note_length;
+    auto note = std::lower_bound(midi_.notes.begin(), midi_.notes.end(), first,
+                                 [](const HelmSequencer::NoteData& a, const HelmSequencer::NoteData& b) {
+      return a.start < b.start;
+    });
+
+    batch_.clear();
+    for (; note != midi_.notes.end() && note->start < window_end; ++note) {
+      if (note->end >= position)
+        batch_.push_back(*note);
+    }
+    next_note_ = note - midi_.notes.begin();
+  }
+
+  bool MidiStream::update(double lookahead) {
+    double position = sequencer_->current_position();
+    double window_end = position + std::max(0.0, lookahead);
+    bool changed = false;
+
+    if (position < position_) {
+      restart(position, window_end);
+      changed = true;
+    }
+    else {
+      finished_.clear();
+      for (HelmSequencer::Note* note : sequencer_->notes()) {
+        if (note->time_off < position)
+          finished_.push_back(note);
+      }
+      for (HelmSequencer::Note* note : finished_)
+        sequencer_->deleteNote(note);
+      changed = !finished_.empty();
+
+      batch_.clear();
+      for (; next_note_ < midi_.notes.size() && midi_.notes[next_note_].start < window_end; ++next_note_) {
+        if (midi_.notes[next_note_].end >= position)
+          batch_.push_back(midi_.notes[next_note_]);
+      }
+    }
+    position_ = position;
+
+    if (batch_.empty())
+      return changed;
+
+    sequencer_->loadNotes(batch_.data(), batch_.size(), nullptr);
+    return true;
+  }
+
+} // Helm
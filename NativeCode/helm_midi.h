@@ -0,0 +1,63 @@
+/* Copyright 2017 Matt Tytel */
+
+#pragma once
+#ifndef HELM_MIDI_H
+#define HELM_MIDI_H
+
+#include "helm_sequencer.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace Helm {
+
+  // The notes of a standard MIDI file in sequencer sixteenths, sorted by start.
+  struct MidiNotes {
+    std::vector<HelmSequencer::NoteData> notes;
+    double length;          // End of the longest track.
+    double max_note_length;
+  };
+
+  // Reads a type 0 or 1 standard MIDI file from memory, merging every track and channel.
+  // With bpm 0 times stay musical, 4 sixteenths to the file's quarter note, and tempo
+  // changes in the file are ignored. With a bpm the file's tempo map is applied: notes land
+  // on the sixteenths that play them at the time the file does with the transport at bpm.
+  // Files with SMPTE time division always use their timing, at 120 bpm if bpm is 0.
+  // Returns false if the data is malformed or is a type 2 file.
+  bool readMidiFile(const void* data, size_t size, double bpm, MidiNotes* midi);
+
+  // Feeds a long MIDI file to a sequencer a window at a time so the pattern the audio thread
+  // searches only holds notes near the play position. The stream owns the sequencer's notes:
+  // finished notes are deleted as it moves on. Meant for sequencers that don't loop, a loop
+  // or any jump back restarts the window at the new position.
+  class MidiStream {
+    public:
+      MidiStream(HelmSequencer* sequencer);
+
+      bool open(const void* data, size_t size, double bpm);
+      double length() const { return midi_.length; }
+      HelmSequencer* sequencer() const { return sequencer_; }
+
+      // True if the sequencer moved back since the last update, so update will replace every
+      // note and any playing notes need a note off first.
+      bool restarting() const;
+
+      // Loads notes starting before the sequencer's position plus lookahead sixteenths and
+      // deletes notes that have finished. Returns true if the sequencer needs a publish.
+      // The lookahead has to cover the time until the next update or notes play late.
+      bool update(double lookahead);
+
+    private:
+      void restart(double position, double window_end);
+
+      HelmSequencer* sequencer_;
+      MidiNotes midi_;
+      size_t next_note_;
+      double position_;
+      std::vector<HelmSequencer::NoteData> batch_;
+      std::vector<HelmSequencer::Note*> finished_;
+  };
+
+} // Helm
+
+#endif // HELM_MIDI_H
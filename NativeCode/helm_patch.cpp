@@ -0,0 +1,440 @@
+/* Copyright 2017 Matt Tytel */
+
+#include "helm_patch.h"
+#include "helm_engine.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Helm {
+
+  namespace {
+    const char kPatchMagic[4] = { 'H', 'L', 'M', 'P' };
+    const char kPackMagic[4] = { 'H', 'L', 'M', 'K' };
+    const uint32_t kPackVersion = 1;
+
+    // FNV-1a of the text and its terminating zero, so neighbouring names can't run together.
+    uint32_t hashString(uint32_t hash, const std::string& text) {
+      for (char c : text) {
+        hash ^= (unsigned char)c;
+        hash *= 16777619u;
+      }
+      return hash * 16777619u;
+    }
+
+    size_t alignedSize(size_t size) {
+      return (size + 3) & ~(size_t)3;
+    }
+
+    template<class T>
+    void append(std::vector<char>* data, const T& value) {
+      const char* bytes = reinterpret_cast<const char*>(&value);
+      data->insert(data->end(), bytes, bytes + sizeof(T));
+    }
+
+    class PatchReader {
+      public:
+        PatchReader(const char* text) : text_(text), position_(0), valid_(true) { }
+
+        bool read(Patch* patch) {
+          bool found_settings = false;
+          readObject([&](const std::string& key) {
+            if (key == "settings") {
+              found_settings = true;
+              readSettings(patch);
+            }
+            else
+              skipValue();
+          });
+
+          skipSpace();
+          return valid_ && found_settings && peek() == 0;
+        }
+
+      private:
+        template<class ReadMember>
+        void readObject(ReadMember read_member) {
+          skipSpace();
+          if (!expect('{'))
+            return;
+
+          skipSpace();
+          if (peek() == '}') {
+            position_++;
+            return;
+          }
+
+          while (valid_) {
+            skipSpace();
+            std::string key = readString();
+            skipSpace();
+            if (!expect(':'))
+              return;
+            skipSpace();
+            read_member(key);
+
+            skipSpace();
+            if (peek() == ',')
+              position_++;
+            else {
+              expect('}');
+              return;
+            }
+          }
+        }
+
+        template<class ReadElement>
+        void readArray(ReadElement read_element) {
+          skipSpace();
+          if (!expect('['))
+            return;
+
+          skipSpace();
+          if (peek() == ']') {
+            position_++;
+            return;
+          }
+
+          while (valid_) {
+            skipSpace();
+            read_element();
+
+            skipSpace();
+            if (peek() == ',')
+              position_++;
+            else {
+              expect(']');
+              return;
+            }
+          }
+        }
+
+        void readSettings(Patch* patch) {
+          readObject([&](const std::string& key) {
+            if (key == "modulations")
+              readModulations(patch);
+            else if (peek() == '-' || isdigit(peek()))
+              patch->settings[key] = readNumber();
+            else
+              skipValue();
+          });
+        }
+
+        void readModulations(Patch* patch) {
+          readArray([&]() {
+            PatchModulation modulation = { "", "", 0.0f };
+            readObject([&](const std::string& key) {
+              if (key == "source")
+                modulation.source = readString();
+              else if (key == "destination")
+                modulation.destination = readString();
+              else if (key == "amount")
+                modulation.amount = readNumber();
+              else
+                skipValue();
+            });
+            patch->modulations.push_back(modulation);
+          });
+        }
+
+        void skipValue() {
+          char c = peek();
+          if (c == '"')
+            readString();
+          else if (c == '{')
+            readObject([&](const std::string& key) { skipValue(); });
+          else if (c == '[')
+            readArray([&]() { skipValue(); });
+          else if (c == '-' || isdigit(c))
+            readNumber();
+          else if (isalpha(c)) {
+            while (isalpha(peek()))
+              position_++;
+          }
+          else
+            valid_ = false;
+        }
+
+        std::string readString() {
+          std::string result;
+          if (!expect('"'))
+            return result;
+
+          while (peek() && peek() != '"') {
+            if (peek() == '\\')
+              position_++;
+            if (peek())
+              result += text_[position_++];
+          }
+          expect('"');
+          return result;
+        }
+
+        float readNumber() {
+          const char* start = text_ + position_;
+          char* end = nullptr;
+          double value = strtod(start, &end);
+          if (end == start)
+            valid_ = false;
+          position_ += end - start;
+          return value;
+        }
+
+        void skipSpace() {
+          while (peek() && isspace(peek()))
+            position_++;
+        }
+
+        bool expect(char c) {
+          if (peek() != c) {
+            valid_ = false;
+            return false;
+          }
+          position_++;
+          return true;
+        }
+
+        char peek() const {
+          return valid_ ? text_[position_] : 0;
+        }
+
+        const char* text_;
+        size_t position_;
+        bool valid_;
+    };
+  } // namespace
+
+  bool readPatch(const char* json, Patch* patch) {
+    if (json == nullptr)
+      return false;
+    return PatchReader(json).read(patch);
+  }
+
+  uint32_t patchLayout(const mopo::HelmEngine& engine) {
+    uint32_t hash = 2166136261u;
+    int num_parameters = mopo::Parameters::lookup_.getNumParameters();
+    for (int i = 0; i < num_parameters; ++i)
+      hash = hashString(hash, mopo::Parameters::lookup_.getDetails(i).name);
+
+    hash = hashString(hash, "");
+    for (int i = 0; i < engine.getNumModulationSources(); ++i)
+      hash = hashString(hash, engine.getModulationSourceName(i));
+
+    hash = hashString(hash, "");
+    for (int i = 0; i < engine.getNumModulationDestinations(); ++i)
+      hash = hashString(hash, engine.getModulationDestinationName(i));
+    return hash;
+  }
+
+  std::vector<char> writeBinaryPatch(const Patch& patch, const mopo::HelmEngine& engine) {
+    std::vector<float> values;
+    int num_parameters = mopo::Parameters::lookup_.getNumParameters();
+    for (int i = 0; i < num_parameters; ++i) {
+      const mopo::ValueDetails& details = mopo::Parameters::lookup_.getDetails(i);
+      float value = details.default_value;
+      auto setting = patch.settings.find(details.name);
+      if (setting != patch.settings.end() && std::isfinite(setting->second))
+        value = std::max<float>(details.min, std::min<float>(details.max, setting->second));
+      values.push_back(value);
+    }
+
+    std::vector<BinaryModulation> modulations;
+    for (const PatchModulation& modulation : patch.modulations) {
+      int source = engine.getModulationSourceIndex(modulation.source);
+      int destination = engine.getModulationDestinationIndex(modulation.destination);
+      if (source >= 0 && destination >= 0 && std::isfinite(modulation.amount)) {
+        BinaryModulation binary_modulation = { (uint32_t)source, (uint32_t)destination, modulation.amount };
+        modulations.push_back(binary_modulation);
+      }
+    }
+
+    BinaryPatchHeader header;
+    memcpy(header.magic, kPatchMagic, sizeof(kPatchMagic));
+    header.version = kBinaryPatchVersion;
+    header.layout = patchLayout(engine);
+    header.num_values = values.size();
+    header.num_modulations = modulations.size();
+
+    std::vector<char> data;
+    append(&data, header);
+    for (float value : values)
+      append(&data, value);
+    for (const BinaryModulation& modulation : modulations)
+      append(&data, modulation);
+    return data;
+  }
+
+  const BinaryPatchHeader* readBinaryPatch(const void* data, size_t size, uint32_t layout) {
+    if (data == nullptr || size < sizeof(BinaryPatchHeader))
+      return nullptr;
+
+    const BinaryPatchHeader* header = static_cast<const BinaryPatchHeader*>(data);
+    if (memcmp(header->magic, kPatchMagic, sizeof(kPatchMagic)) ||
+        header->version != kBinaryPatchVersion || header->layout != layout) {
+      return nullptr;
+    }
+
+    size_t max_values = (size - sizeof(BinaryPatchHeader)) / sizeof(float);
+    if (header->num_values > max_values)
+      return nullptr;
+
+    size_t modulations_size = size - sizeof(BinaryPatchHeader) - header->num_values * sizeof(float);
+    if (header->num_modulations > modulations_size / sizeof(BinaryModulation))
+      return nullptr;
+    return header;
+  }
+
+  std::vector<char> writePatchPack(const std::map<std::string, std::vector<char>>& patches) {
+    std::vector<BinaryPackEntry> entries;
+    size_t offset = sizeof(BinaryPackHeader) + patches.size() * sizeof(BinaryPackEntry);
+    for (auto& patch : patches) {
+      BinaryPackEntry entry;
+      entry.name_offset = offset;
+      entry.name_size = patch.first.size();
+      offset += alignedSize(patch.first.size());
+      entry.patch_offset = offset;
+      entry.patch_size = patch.second.size();
+      offset += alignedSize(patch.second.size());
+      entries.push_back(entry);
+    }
+
+    BinaryPackHeader header;
+    memcpy(header.magic, kPackMagic, sizeof(kPackMagic));
+    header.version = kPackVersion;
+    header.num_patches = patches.size();
+
+    std::vector<char> data;
+    append(&data, header);
+    for (const BinaryPackEntry& entry : entries)
+      append(&data, entry);
+    for (auto& patch : patches) {
+      data.insert(data.end(), patch.first.begin(), patch.first.end());
+      data.resize(alignedSize(data.size()), 0);
+      data.insert(data.end(), patch.second.begin(), patch.second.end());
+      data.resize(alignedSize(data.size()), 0);
+    }
+    return data;
+  }
+
+  PatchPack::PatchPack() : data_(nullptr), size_(0), entries_(nullptr), num_patches_(0), mapping_(nullptr) { }
+
+  PatchPack::~PatchPack() {
+    close();
+  }
+
+  bool PatchPack::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file)
+      return false;
+
+    buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#else
+    int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0)
+      return false;
+
+    struct stat file_stat;
+    if (fstat(file, &file_stat) == 0 && file_stat.st_size > 0) {
+      void* mapping = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+      if (mapping != MAP_FAILED) {
+        mapping_ = mapping;
+        data_ = static_cast<const char*>(mapping);
+        size_ = file_stat.st_size;
+      }
+    }
+    ::close(file);
+#endif
+
+    if (validate())
+      return true;
+
+    close();
+    return false;
+  }
+
+  void PatchPack::close() {
+#ifndef _WIN32
+    if (mapping_)
+      munmap(mapping_, size_);
+#endif
+    mapping_ = nullptr;
+    buffer_.clear();
+    data_ = nullptr;
+    size_ = 0;
+    entries_ = nullptr;
+    num_patches_ = 0;
+  }
+
+  bool PatchPack::validate() {
+    if (data_ == nullptr || size_ < sizeof(BinaryPackHeader))
+      return false;
+
+    const BinaryPackHeader* header = reinterpret_cast<const BinaryPackHeader*>(data_);
+    if (memcmp(header->magic, kPackMagic, sizeof(kPackMagic)) || header->version != kPackVersion)
+      return false;
+    if (header->num_patches > (size_ - sizeof(BinaryPackHeader)) / sizeof(BinaryPackEntry))
+      return false;
+
+    const BinaryPackEntry* entries = reinterpret_cast<const BinaryPackEntry*>(header + 1);
+    for (uint32_t i = 0; i < header->num_patches; ++i) {
+      const BinaryPackEntry& entry = entries[i];
+      if (entry.name_offset > size_ || entry.name_size > size_ - entry.name_offset ||
+          entry.patch_offset > size_ || entry.patch_size > size_ - entry.patch_offset ||
+          entry.patch_offset % sizeof(float)) {
+        return false;
+      }
+    }
+
+    entries_ = entries;
+    num_patches_ = header->num_patches;
+    return true;
+  }
+
+  std::string PatchPack::name(int index) const {
+    if (index < 0 || index >= num_patches_)
+      return "";
+    return std::string(data_ + entries_[index].name_offset, entries_[index].name_size);
+  }
+
+  int PatchPack::find(const std::string& name) const {
+    int begin = 0;
+    int end = num_patches_;
+    while (begin < end) {
+      int middle = (begin + end) / 2;
+      int compare = this->name(middle).compare(name);
+      if (compare == 0)
+        return middle;
+      if (compare < 0)
+        begin = middle + 1;
+      else
+        end = middle;
+    }
+    return -1;
+  }
+
+  const void* PatchPack::patch(int index, size_t* size) const {
+    if (index < 0 || index >= num_patches_)
+      return nullptr;
+
+    *size = entries_[index].patch_size;
+    return data_ + entries_[index].patch_offset;
+  }
+
+} // Helm
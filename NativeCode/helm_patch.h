@@ -0,0 +1,123 @@
+/* Copyright 2017 Matt Tytel */
+
+#pragma once
+#ifndef HELM_PATCH_H
+#define HELM_PATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace mopo {
+  class HelmEngine;
+} // namespace mopo
+
+namespace Helm {
+
+  struct PatchModulation {
+    std::string source;
+    std::string destination;
+    float amount;
+  };
+
+  // The settings and modulations of a .helm patch file, as written in the file.
+  struct Patch {
+    std::map<std::string, float> settings;
+    std::vector<PatchModulation> modulations;
+  };
+
+  // Reads just enough JSON for .helm patch files.
+  // Returns false if the text isn't valid JSON or has no settings object.
+  bool readPatch(const char* json, Patch* patch);
+
+  // Binary patches hold the same data with every name replaced by an index:
+  //   BinaryPatchHeader
+  //   float values[num_values]                        in ValueDetailsLookup::parameter_list order
+  //   BinaryModulation modulations[num_modulations]   HelmEngine modulation table indices
+  // layout is a hash of the parameter list and modulation tables. A patch only loads into a
+  // build with the same layout, so indices never point at the wrong control.
+  // Fields are in host byte order, little endian on every platform the plugin is built for.
+  // A big endian host would fail the version check on these files rather than misread them.
+  const uint32_t kBinaryPatchVersion = 1;
+
+  struct BinaryPatchHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t layout;
+    uint32_t num_values;
+    uint32_t num_modulations;
+  };
+
+  struct BinaryModulation {
+    uint32_t source;
+    uint32_t destination;
+    float amount;
+  };
+
+  // A pack of binary patches, each stored under a name:
+  //   BinaryPackHeader
+  //   BinaryPackEntry entries[num_patches]   sorted by name
+  //   names and patches, at offsets from the start of the pack
+  struct BinaryPackHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t num_patches;
+  };
+
+  struct BinaryPackEntry {
+    uint32_t name_offset;
+    uint32_t name_size;
+    uint32_t patch_offset;
+    uint32_t patch_size;
+  };
+
+  uint32_t patchLayout(const mopo::HelmEngine& engine);
+
+  // Unknown settings and modulations that don't name a source and destination are dropped.
+  std::vector<char> writeBinaryPatch(const Patch& patch, const mopo::HelmEngine& engine);
+
+  // Returns the patch header if size holds a whole binary patch for this layout, otherwise nullptr.
+  const BinaryPatchHeader* readBinaryPatch(const void* data, size_t size, uint32_t layout);
+
+  inline const float* binaryPatchValues(const BinaryPatchHeader* header) {
+    return reinterpret_cast<const float*>(header + 1);
+  }
+
+  inline const BinaryModulation* binaryPatchModulations(const BinaryPatchHeader* header) {
+    return reinterpret_cast<const BinaryModulation*>(binaryPatchValues(header) + header->num_values);
+  }
+
+  std::vector<char> writePatchPack(const std::map<std::string, std::vector<char>>& patches);
+
+  // Read only view of a patch pack file. The file is memory mapped where the platform allows
+  // it and read into memory otherwise.
+  class PatchPack {
+    public:
+      PatchPack();
+      ~PatchPack();
+
+      // Returns false if the file can't be read or isn't a valid pack.
+      bool open(const std::string& path);
+      void close();
+
+      int size() const { return num_patches_; }
+      std::string name(int index) const;
+      int find(const std::string& name) const;
+      const void* patch(int index, size_t* size) const;
+
+    private:
+      bool validate();
+
+      const char* data_;
+      size_t size_;
+      const BinaryPackEntry* entries_;
+      int num_patches_;
+      void* mapping_;
+      std::vector<char> buffer_;
+  };
+
+} // Helm
+
+#endif // HELM_PATCH_H
@@ -2,22 +2,35 @@
 
 #define NOMINMAX
 
+#include "fixed_point_wave.h"
 #include "helm_engine.h"
+#include "helm_engine_pool.h"
+#include "helm_midi.h"
+#include "helm_patch.h"
+#include "helm_render_pool.h"
+#include "helm_sampler.h"
 #include "helm_sequencer.h"
+#include "helm_transport.h"
+#include "helm_voice_pool.h"
 #include "AudioPluginUtil.h"
 #include "concurrentqueue.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
 namespace Helm {
   const int MAX_CHARACTERS = 15;
   const int MAX_CHANNELS = 16;
   const int MAX_NOTES = 128;
   const int MAX_MODULATIONS = 16;
+  const int MAX_SCHEDULED_EVENTS = 1024;
   const int VALUES_PER_MODULATION = 3;
   const int MAX_UNITY_CHANNELS = 2;
   const int MAX_UNITY_BUFFER_SIZE = 2048;
   const float MODULATION_RANGE = 1000000.0f;
   const double SIXTEENTHS_PER_BEAT = 4.0;
-  const double SECONDS_PER_MINUTE = 60.0;
+  const double NOTE_SAMPLE_TOLERANCE = 1e-4;
 
   const std::map<std::string, std::string> REPLACE_STRINGS = {
     {"stutter_resample", "stutter_resamp"}
@@ -28,36 +41,239 @@ namespace Helm {
     kNumParams
   };
 
+  enum HelmEventType {
+    kNoteOnEvent,
+    kNoteOffEvent,
+    kPitchWheelEvent,
+    kModWheelEvent,
+    kAftertouchEvent,
+    kParameterEvent
+  };
+
+  // An event to be played at an absolute DSP time in seconds, or at the next block if time is zero.
+  // type is a HelmEventType and key and value are used as in HelmEvent.
+  // A note on with a value of zero is a note off, matching note_events.
+  struct ScheduledEvent {
+    double time;
+    int type;
+    float key;
+    float value;
+  };
+
+  // One entry of a HelmSendEvents batch. Mirrors AudioHelm.HelmEvent on the C# side.
+  // key is the MIDI note for note and aftertouch events and the parameter index for parameter events.
+  // value is the velocity, wheel position, aftertouch or parameter value.
+  // Events with a time above zero are scheduled at that DSP time in seconds.
+  struct HelmEvent {
+    int type;
+    int channel;
+    int key;
+    float value;
+    double time;
+  };
+
+  // Who is rendering an instance's next block when parallel rendering is on.
+  enum RenderState {
+    kRenderIdle,
+    kRenderQueued,
+    kRendering,
+    kRenderDone
+  };
+
+  // Health counters of one instance. Only the thread rendering the instance writes them.
+  struct InstanceStats {
+    std::atomic<long long> blocks_rendered;
+    std::atomic<long long> chunks_rendered;
+    std::atomic<long long> silent_blocks;
+    std::atomic<long long> render_nanoseconds;
+    std::atomic<long long> last_render_nanoseconds;
+    std::atomic<long long> max_render_nanoseconds;
+    std::atomic<double> last_block_seconds;
+    std::atomic<int> active_voices;
+    std::atomic<int> note_queue_depth;
+    std::atomic<int> note_queue_high_water;
+    std::atomic<int> value_queue_depth;
+    std::atomic<int> value_queue_high_water;
+    std::atomic<int> scheduled_queue_depth;
+    std::atomic<int> scheduled_queue_high_water;
+    std::atomic<long long> late_events;
+    std::atomic<long long> scheduled_overflows;
+  };
+
+  // Health of the instances on a channel, summed over the instances.
+  // Times are the worst of any instance. Mirrors AudioHelm.HelmStats on the C# side.
+  struct HelmStats {
+    int num_instances;
+    int active_voices;
+    long long blocks_rendered;
+    long long chunks_rendered;      // Synth process calls. Blocks split at mopo::MAX_BUFFER_SIZE and where
+                                    // a sequencer note, scheduled event or transport segment starts.
+    long long silent_blocks;        // Blocks skipped because the input was silent or Unity paused.
+    double last_render_seconds;
+    double average_render_seconds;
+    double max_render_seconds;
+    double last_load;               // Last render time over the length of audio it rendered.
+    int note_queue_depth;
+    int note_queue_high_water;
+    int value_queue_depth;
+    int value_queue_high_water;
+    int scheduled_queue_depth;      // Scheduled events waiting in the queue or the pending list.
+    int scheduled_queue_high_water;
+    long long late_events;          // Scheduled events that arrived after their time and played late.
+    long long scheduled_overflows;  // Chunks that left scheduled events queued because the pending list was full.
+  };
+
   struct EffectData {
     int num_parameters;
     int num_synth_parameters;
-    HelmSequencer::Note* sequencer_events[MAX_NOTES];
+    const HelmSequencer::Event* sequencer_events[MAX_NOTES];
     mopo::ModulationConnection* modulations[MAX_MODULATIONS];
     moodycamel::ConcurrentQueue<std::pair<float, float>> note_events;
     moodycamel::ConcurrentQueue<std::pair<int, float>> value_events;
+    moodycamel::ConcurrentQueue<ScheduledEvent> scheduled_events;
+    ScheduledEvent pending_events[MAX_SCHEDULED_EVENTS];
+    int num_pending_events;
     float* parameters;
     mopo::Value** value_lookup;
     std::pair<float, float>* range_lookup;
     int instance_id;
-    mopo::HelmEngine synth_engine;
+    mopo::HelmEngine* synth_engine;
     AudioHelm::Mutex mutex;
-    double current_beat;
-    double last_global_beat_sync;
-    bool active;
+    std::atomic<bool> active;
     bool silent;
     float send_data[MAX_UNITY_CHANNELS * MAX_UNITY_BUFFER_SIZE];
     int num_send_channels;
+    std::atomic<int> render_state;
+    Transport::Block render_block;  // Copied when the render is queued, workers never read the transport.
+    int render_sample_rate;
+    mopo::mopo_float render_left[MAX_UNITY_BUFFER_SIZE];
+    mopo::mopo_float render_right[MAX_UNITY_BUFFER_SIZE];
+    InstanceStats stats;
+  };
+
+  // A Helm Sampler effect instance. It shares channels, note exports and sequencers with
+  // Helm instances and plays the keyzones set for its channel with HelmSetSamplerKeyzones.
+  struct SamplerData {
+    float parameters[kNumParams];
+    const HelmSequencer::Event* sequencer_events[MAX_NOTES];
+    moodycamel::ConcurrentQueue<std::pair<float, float>> note_events;
+    moodycamel::ConcurrentQueue<ScheduledEvent> scheduled_events;
+    ScheduledEvent pending_events[MAX_SCHEDULED_EVENTS];
+    int num_pending_events;
+    int instance_id;
+    Sampler sampler;
+    AudioHelm::Mutex mutex;
+    std::atomic<bool> active;
+    float render_left[MAX_UNITY_BUFFER_SIZE];
+    float render_right[MAX_UNITY_BUFFER_SIZE];
+    InstanceStats stats;
   };
 
+  inline mopo::HelmEngine& instrument(EffectData* data) {
+    return *data->synth_engine;
+  }
+
+  inline Sampler& instrument(SamplerData* data) {
+    return data->sampler;
+  }
+
   AudioHelm::Mutex instance_mutex;
   int instance_counter = 0;
-  double bpm = 120.0;
-  double global_beat = 0.0;
-  bool global_pause = false;
+  Transport transport;
   std::map<int, EffectData*> instance_map;
+  std::map<int, SamplerData*> sampler_map;
+
+  // Instances grouped by channel so exports only visit the instances they target.
+  // Rebuilt under instance_mutex whenever an instance is added, removed or changes channel.
+  struct ChannelInstances {
+    std::vector<EffectData*> channels[MAX_CHANNELS + 1];
+    std::vector<SamplerData*> samplers[MAX_CHANNELS + 1];
+  };
 
+  SnapshotDomain instance_snapshots;
+  std::atomic<ChannelInstances*> channel_instances(new ChannelInstances());
+
+  // Engines built ahead for new instances, opt in with HelmReserveEngines.
+  EnginePool engine_pool;
+
+  // Opt in parallel rendering. The first callback of each DSP tick hands every other active
+  // instance to render_pool so their blocks are ready by the time Unity asks for them.
+  // Mirrors AudioHelm.ParallelRenderStats on the C# side.
+  struct ParallelRenderStats {
+    long long blocks_rendered_ahead; // Blocks Unity got from a worker.
+    long long blocks_rendered_late;  // Blocks a worker hadn't started in time, rendered inline.
+    double worker_seconds;           // Time spent rendering on workers.
+    double wait_seconds;             // Time callbacks spent waiting on a worker to finish.
+    double saved_seconds;            // Mixer thread time saved, worker_seconds - wait_seconds.
+    int num_threads;
+  };
+
+  RenderPool render_pool;
+  std::atomic<bool> parallel_rendering(false);
+  std::atomic<unsigned long long> parallel_render_tick(0);
+  std::atomic_flag parallel_render_lock = ATOMIC_FLAG_INIT;
+  void* parallel_render_items[RenderPool::kMaxItems];
+  std::atomic<long long> blocks_rendered_ahead(0);
+  std::atomic<long long> blocks_rendered_late(0);
+  std::atomic<long long> worker_render_nanoseconds(0);
+  std::atomic<long long> render_wait_nanoseconds(0);
+
+  // Opt in parallel voices. Each engine splits its voices into sets it renders on voice_pool
+  // as well as its own thread once they take long enough. Changed under instance_mutex so
+  // every instance either is published before the change or picks it up when created.
+  VoicePool voice_pool;
+  mopo::VoiceWorkers* voice_workers = nullptr;
+
+  // Sequencer edits are serialized by sequencer_mutex and published through sequencer_snapshots.
+  // The audio thread only reads published data so it never waits on an edit.
   AudioHelm::Mutex sequencer_mutex;
   std::map<HelmSequencer*, bool> sequencer_lookup;
+  SnapshotDomain sequencer_snapshots;
+  std::atomic<std::vector<HelmSequencer*>*> active_sequencers(new std::vector<HelmSequencer*>());
+
+  // Samples and the sampler settings of each channel. Edits are serialized by sampler_mutex
+  // and settings are published through sampler_snapshots. Samples are only deleted once no
+  // settings point at them and no voice plays them.
+  AudioHelm::Mutex sampler_mutex;
+  int sample_counter = 0;
+  std::map<int, Sample*> samples;
+  SnapshotDomain sampler_snapshots;
+  std::atomic<SamplerSettings*> sampler_settings[MAX_CHANNELS + 1];
+
+  inline int instanceChannel(float channel) {
+    return std::max(0, std::min(MAX_CHANNELS, (int)channel));
+  }
+
+  // Must be called while holding instance_mutex.
+  void publishChannelInstances() {
+    ChannelInstances* instances = new ChannelInstances();
+    for (auto synth : instance_map) {
+      EffectData* data = synth.second;
+      instances->channels[instanceChannel(data->parameters[kChannel])].push_back(data);
+    }
+    for (auto sampler : sampler_map) {
+      SamplerData* data = sampler.second;
+      instances->samplers[instanceChannel(data->parameters[kChannel])].push_back(data);
+    }
+
+    instance_snapshots.retire(channel_instances.exchange(instances));
+  }
+
+  // Only valid inside a read section of instance_snapshots.
+  const std::vector<EffectData*>& channelInstances(int channel) {
+    static const std::vector<EffectData*> no_instances;
+    if (channel < 0 || channel > MAX_CHANNELS)
+      return no_instances;
+    return channel_instances.load()->channels[channel];
+  }
+
+  // Only valid inside a read section of instance_snapshots.
+  const std::vector<SamplerData*>& channelSamplers(int channel) {
+    static const std::vector<SamplerData*> no_samplers;
+    if (channel < 0 || channel > MAX_CHANNELS)
+      return no_samplers;
+    return channel_instances.load()->samplers[channel];
+  }
 
   std::string getValueName(std::string full_name) {
     std::string name = full_name;
@@ -129,9 +345,67 @@ namespace Helm {
     }
   }
 
+  // Oscillator tables are built the first time a waveform is used. The helpers below build
+  // the ones a setting can reach before the audio thread sees it.
+  const char* const WAVEFORM_CONTROLS[] = { "osc_1_waveform", "osc_2_waveform", "sub_waveform" };
+
+  const std::vector<int>& waveformParameters() {
+    static const std::vector<int> indices = []() {
+      std::vector<int> waveform_indices;
+      int index = kNumParams;
+      for (auto& parameter : mopo::Parameters::lookup_.getAllDetails()) {
+        for (const char* control : WAVEFORM_CONTROLS) {
+          if (parameter.first == control)
+            waveform_indices.push_back(index);
+        }
+        index++;
+      }
+      return waveform_indices;
+    }();
+    return indices;
+  }
+
+  void prepareWaveform(int index, float value) {
+    const std::vector<int>& waveform_indices = waveformParameters();
+    if (std::find(waveform_indices.begin(), waveform_indices.end(), index) != waveform_indices.end())
+      mopo::FixedPointWave::prepare(static_cast<int>(value + 0.5f));
+  }
+
+  // A modulated waveform can land on any table.
+  void prepareModulatedWaveforms(const mopo::HelmEngine& engine, int destination) {
+    if (destination < 0 || destination >= engine.getNumModulationDestinations())
+      return;
+
+    const std::string& name = engine.getModulationDestinationName(destination);
+    for (const char* control : WAVEFORM_CONTROLS) {
+      if (name == control)
+        mopo::FixedPointWave::prepareAll();
+    }
+  }
+
+  void resetStats(InstanceStats& stats) {
+    stats.blocks_rendered = 0;
+    stats.chunks_rendered = 0;
+    stats.silent_blocks = 0;
+    stats.render_nanoseconds = 0;
+    stats.last_render_nanoseconds = 0;
+    stats.max_render_nanoseconds = 0;
+    stats.last_block_seconds = 0.0;
+    stats.active_voices = 0;
+    stats.note_queue_depth = 0;
+    stats.note_queue_high_water = 0;
+    stats.value_queue_depth = 0;
+    stats.value_queue_high_water = 0;
+    stats.scheduled_queue_depth = 0;
+    stats.scheduled_queue_high_water = 0;
+    stats.late_events = 0;
+    stats.scheduled_overflows = 0;
+  }
+
   UNITY_AUDIODSP_RESULT UNITY_AUDIODSP_CALLBACK CreateCallback(UnityAudioEffectState* state) {
     EffectData* effect_data = new EffectData;
-    memset(effect_data->sequencer_events, 0, sizeof(HelmSequencer::Note*) * MAX_NOTES);
+    effect_data->synth_engine = engine_pool.take();
+    memset(effect_data->sequencer_events, 0, sizeof(HelmSequencer::Event*) * MAX_NOTES);
 
     effect_data->num_synth_parameters = mopo::Parameters::lookup_.getAllDetails().size();
     int num_params = effect_data->num_synth_parameters + kNumParams + MAX_MODULATIONS * VALUES_PER_MODULATION;
@@ -142,52 +416,71 @@ namespace Helm {
 
     effect_data->value_lookup = new mopo::Value*[num_params];
     effect_data->range_lookup = new std::pair<float, float>[num_params];
-    mopo::control_map controls = effect_data->synth_engine.getControls();
+    mopo::control_map controls = effect_data->synth_engine->getControls();
     initializeValueLookup(effect_data->value_lookup, effect_data->range_lookup, controls, num_params);
+    for (int index : waveformParameters())
+      prepareWaveform(index, effect_data->parameters[index]);
 
-    for (int i = 0; i < MAX_MODULATIONS; ++i)
+    // Mod slots start on the first source and destination like their parameters.
+    for (int i = 0; i < MAX_MODULATIONS; ++i) {
       effect_data->modulations[i] = new mopo::ModulationConnection();
+      effect_data->modulations[i]->source_index = 0;
+      effect_data->modulations[i]->destination_index = 0;
+    }
 
-    effect_data->synth_engine.setSampleRate(state->samplerate);
+    effect_data->synth_engine->setSampleRate(state->samplerate);
     effect_data->active = false;
     effect_data->silent = false;
-    effect_data->current_beat = 0.0;
-    effect_data->last_global_beat_sync = 0.0;
     effect_data->num_send_channels = 0;
+    effect_data->num_pending_events = 0;
+    effect_data->render_state = kRenderIdle;
+    memset(&effect_data->render_block, 0, sizeof(effect_data->render_block));
+    effect_data->render_sample_rate = state->samplerate;
+    resetStats(effect_data->stats);
     memset(effect_data->send_data, 0, MAX_UNITY_CHANNELS * MAX_UNITY_BUFFER_SIZE * sizeof(float));
 
     state->effectdata = effect_data;
     AudioHelm::MutexScopeLock mutex_instance_lock(instance_mutex);
+    effect_data->synth_engine->setVoiceWorkers(voice_workers);
     effect_data->instance_id = instance_counter;
     instance_map[instance_counter] = effect_data;
     instance_counter++;
+    publishChannelInstances();
     return UNITY_AUDIODSP_OK;
   }
 
   void clearInstance(int id) {
     instance_map.erase(id);
+    publishChannelInstances();
   }
 
   UNITY_AUDIODSP_RESULT UNITY_AUDIODSP_CALLBACK ReleaseCallback(UnityAudioEffectState* state) {
     EffectData* data = state->GetEffectData<EffectData>();
     data->mutex.Lock();
+    {
+      AudioHelm::MutexScopeLock mutex_instance_lock(instance_mutex);
+      data->synth_engine->allNotesOff();
+      clearInstance(data->instance_id);
 
-    AudioHelm::MutexScopeLock mutex_instance_lock(instance_mutex);
-    data->synth_engine.allNotesOff();
-    clearInstance(data->instance_id);
+      data->mutex.Unlock();
 
-    data->mutex.Unlock();
+      // Exports and render_pool may still be using this instance from the old routing.
+      // Synchronizing under instance_mutex keeps it serialized with retire().
+      instance_snapshots.synchronize();
+      render_pool.cancel();
+    }
 
     delete[] data->parameters;
     delete[] data->value_lookup;
     delete[] data->range_lookup;
 
     for (int i = 0; i < MAX_MODULATIONS; ++i) {
-      if (data->synth_engine.isModulationActive(data->modulations[i]))
-        data->synth_engine.disconnectModulation(data->modulations[i]);
+      if (data->synth_engine->isModulationActive(data->modulations[i]))
+        data->synth_engine->disconnectModulation(data->modulations[i]);
       delete data->modulations[i];
     }
 
+    delete data->synth_engine;
     delete data;
 
     return UNITY_AUDIODSP_OK;
@@ -200,59 +493,53 @@ namespace Helm {
     if (index < 0 || index >= data->num_parameters)
       return UNITY_AUDIODSP_ERR_UNSUPPORTED;
 
+    bool channel_changed = index == kChannel && (int)data->parameters[index] != (int)value;
     data->parameters[index] = value;
 
-    if (data->value_lookup[index])
+    if (channel_changed) {
+      AudioHelm::MutexScopeLock mutex_instance_lock(instance_mutex);
+      publishChannelInstances();
+    }
+
+    if (data->value_lookup[index]) {
+      prepareWaveform(index, value);
       data->value_events.enqueue(std::pair<int, float>(index, value));
+    }
 
     int modulation_start = kNumParams + data->num_synth_parameters;
     if (index >= modulation_start) {
-      AudioHelm::MutexScopeLock mutex_lock(data->mutex);
-
       int mod_param = index - modulation_start;
       int mod_index = mod_param / VALUES_PER_MODULATION;
       int mod_type = mod_param % VALUES_PER_MODULATION;
+      int num_destinations = data->synth_engine->getNumModulationDestinations();
+      if (mod_type == 1)
+        prepareModulatedWaveforms(*data->synth_engine, mopo::utils::iclamp(value, 0, num_destinations - 1));
 
+      AudioHelm::MutexScopeLock mutex_lock(data->mutex);
       mopo::ModulationConnection* connection = data->modulations[mod_index];
 
       if (mod_type == 0) {
-        if (data->synth_engine.isModulationActive(connection))
-          data->synth_engine.disconnectModulation(connection);
-
-        int source_index = value;
-        mopo::output_map sources = data->synth_engine.getModulationSources();
-        auto source = sources.begin();
-        std::advance(source, source_index);
-        connection->source = source->first;
+        if (data->synth_engine->isModulationActive(connection))
+          data->synth_engine->disconnectModulation(connection);
+
+        int num_sources = data->synth_engine->getNumModulationSources();
+        connection->source_index = mopo::utils::iclamp(value, 0, num_sources - 1);
       }
       else if (mod_type == 1) {
-        if (data->synth_engine.isModulationActive(connection))
-          data->synth_engine.disconnectModulation(connection);
-
-        mopo::output_map monoMods = data->synth_engine.getMonoModulations();
-        int dest_index = value;
-        if (dest_index < monoMods.size()) {
-          auto mod = monoMods.begin();
-          std::advance(mod, dest_index);
-          connection->destination = mod->first;
-        }
-        else {
-          dest_index -= monoMods.size();
-          mopo::output_map polyMods = data->synth_engine.getPolyModulations();
-          auto mod = polyMods.begin();
-          std::advance(mod, dest_index);
-          connection->destination = mod->first;
-        }
+        if (data->synth_engine->isModulationActive(connection))
+          data->synth_engine->disconnectModulation(connection);
+
+        connection->destination_index = mopo::utils::iclamp(value, 0, num_destinations - 1);
       }
       else {
         if (value == 0.0f) {
-          if (data->synth_engine.isModulationActive(connection))
-            data->synth_engine.disconnectModulation(connection);
+          if (data->synth_engine->isModulationActive(connection))
+            data->synth_engine->disconnectModulation(connection);
         }
         else {
           connection->amount.set(value);
-          if (!data->synth_engine.isModulationActive(connection))
-            data->synth_engine.connectModulation(connection);
+          if (!data->synth_engine->isModulationActive(connection))
+            data->synth_engine->connectModulation(connection);
         }
       }
     }
@@ -283,66 +570,225 @@ namespace Helm {
     return SIXTEENTHS_PER_BEAT * beat;
   }
 
-  inline double timeToBeat(double time, int sample_rate) {
-    return (bpm / SECONDS_PER_MINUTE) * time;
-  }
-
-  inline double timeToSixteenth(double time, int sample_rate) {
-    return beatToSixteenth(timeToBeat(time, sample_rate));
-  }
-
   double wrap(double value, double length, int& num_wraps) {
     num_wraps = value / length;
     return value - num_wraps * length;
   }
 
-  void processNotes(EffectData* data, HelmSequencer* sequencer, double current_beat, double end_beat) {
-    AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
-    double sequencer_start_beat = sequencer->start_beat();
+  // Maps sequencer positions in sixteenths to samples of the chunk being rendered.
+  struct NoteTiming {
+    double range_start;           // Unwrapped sixteenth at start_sample.
+    double samples_per_sixteenth;
+    double first;                 // First position played, unwrapped and wrapped.
+    double wrapped_first;
+    double loop_length;
+    int start_sample;
+    int end_sample;
+  };
+
+  // Finds the part of the pattern played between the beats, wrapped into the loop.
+  // Returns false if the sequencer hasn't started by end_beat.
+  bool patternRange(const HelmSequencer::Pattern* pattern, double current_beat, double end_beat,
+                    int start_sample, int end_sample, NoteTiming* timing, double* start, double* end) {
+    double sequencer_start_beat = pattern->start_beat;
 
     if (sequencer_start_beat >= end_beat)
-      return;
+      return false;
+
+    timing->range_start = beatToSixteenth(current_beat);
+    timing->samples_per_sixteenth = (end_sample - start_sample) / (beatToSixteenth(end_beat) - timing->range_start);
+    timing->loop_length = pattern->num_sixteenths;
+    timing->start_sample = start_sample;
+    timing->end_sample = end_sample;
 
     double start_beat = mopo::utils::max(sequencer_start_beat, current_beat);
-    double start = beatToSixteenth(start_beat);
-    double end = std::max(start, beatToSixteenth(end_beat));
-    if (sequencer->loop()) {
+    *start = beatToSixteenth(start_beat);
+    *end = std::max(*start, beatToSixteenth(end_beat));
+    timing->first = *start;
+    if (pattern->loop) {
       int start_num_wraps = 0;
       int end_num_wraps = 0;
-      start = wrap(start, sequencer->length(), start_num_wraps);
-      end = wrap(end, sequencer->length(), end_num_wraps);
+      *start = wrap(*start, pattern->num_sixteenths, start_num_wraps);
+      *end = wrap(*end, pattern->num_sixteenths, end_num_wraps);
 
       if (start_num_wraps == end_num_wraps)
-        end = std::max(start, end);
+        *end = std::max(*start, *end);
     }
+    timing->wrapped_first = *start;
+    return true;
+  }
+
+  // Returns the sample a note is played on, the one its time falls in. Chunk beats are taken
+  // NOTE_SAMPLE_TOLERANCE early (see segmentBeat), so a time that rounding left just short of a
+  // sample is played on that sample. Events before wrapped_first come from the next time around the loop.
+  int noteSample(const NoteTiming& timing, double time) {
+    double position = timing.first + time - timing.wrapped_first;
+    if (time < timing.wrapped_first)
+      position += timing.loop_length;
+
+    int sample = timing.start_sample + std::floor((position - timing.range_start) * timing.samples_per_sixteenth);
+    return std::max(timing.start_sample, std::min(timing.end_sample - 1, sample));
+  }
+
+  template<class Data>
+  void processNotes(Data* data, HelmSequencer* sequencer, const HelmSequencer::Pattern* pattern,
+                    double current_beat, double end_beat, int start_sample, int end_sample) {
+    NoteTiming timing;
+    double start = 0.0;
+    double end = 0.0;
+    if (!patternRange(pattern, current_beat, end_beat, start_sample, end_sample, &timing, &start, &end))
+      return;
 
-    sequencer->getNoteOffs(data->sequencer_events, start, end);
+    HelmSequencer::getNoteOffs(pattern, data->sequencer_events, start, end);
 
-    for (int i = 0; i < MAX_NOTES && data->sequencer_events[i]; ++i)
-      data->synth_engine.noteOff(data->sequencer_events[i]->midi_note);
+    for (int i = 0; i < MAX_NOTES && data->sequencer_events[i]; ++i) {
+      const HelmSequencer::Event* event = data->sequencer_events[i];
+      instrument(data).noteOff(event->midi_note, noteSample(timing, event->time));
+    }
 
-    sequencer->getNoteOns(data->sequencer_events, start, end);
+    HelmSequencer::getNoteOns(pattern, data->sequencer_events, start, end);
 
-    for (int i = 0; i < MAX_NOTES && data->sequencer_events[i]; ++i)
-      data->synth_engine.noteOn(data->sequencer_events[i]->midi_note, data->sequencer_events[i]->velocity);
+    for (int i = 0; i < MAX_NOTES && data->sequencer_events[i]; ++i) {
+      const HelmSequencer::Event* event = data->sequencer_events[i];
+      instrument(data).noteOn(event->midi_note, event->velocity, noteSample(timing, event->time));
+    }
 
     sequencer->updatePosition(end);
   }
 
-  void processSequencerNotes(EffectData* data, double current_beat, double end_beat) {
-    for (auto sequencer : sequencer_lookup) {
-      if (sequencer.second && sequencer.first->channel() == data->parameters[kChannel])
-        processNotes(data, sequencer.first, current_beat, end_beat);
+  // Returns the first sample with a note event, or end_sample if there isn't one.
+  int nextNoteSample(EffectData* data, const HelmSequencer::Pattern* pattern,
+                     double current_beat, double end_beat, int start_sample, int end_sample) {
+    NoteTiming timing;
+    double start = 0.0;
+    double end = 0.0;
+    if (!patternRange(pattern, current_beat, end_beat, start_sample, end_sample, &timing, &start, &end))
+      return end_sample;
+
+    int next = end_sample;
+    HelmSequencer::getNoteOffs(pattern, data->sequencer_events, start, end);
+    for (int i = 0; i < MAX_NOTES && data->sequencer_events[i]; ++i) {
+      next = std::min(next, noteSample(timing, data->sequencer_events[i]->time));
+    }
+
+    HelmSequencer::getNoteOns(pattern, data->sequencer_events, start, end);
+    for (int i = 0; i < MAX_NOTES && data->sequencer_events[i]; ++i) {
+      next = std::min(next, noteSample(timing, data->sequencer_events[i]->time));
+    }
+    return next;
+  }
+
+  template<class Data>
+  void processSequencerNotes(Data* data, double current_beat, double end_beat,
+                             int start_sample, int end_sample) {
+    SnapshotReadLock read_lock(sequencer_snapshots);
+    const std::vector<HelmSequencer*>* sequencers = active_sequencers.load();
+
+    for (HelmSequencer* sequencer : *sequencers) {
+      const HelmSequencer::Pattern* pattern = sequencer->pattern();
+      if (pattern->channel == data->parameters[kChannel])
+        processNotes(data, sequencer, pattern, current_beat, end_beat, start_sample, end_sample);
+    }
+  }
+
+  int nextSequencerNoteSample(EffectData* data, double current_beat, double end_beat,
+                              int start_sample, int end_sample) {
+    SnapshotReadLock read_lock(sequencer_snapshots);
+    const std::vector<HelmSequencer*>* sequencers = active_sequencers.load();
+
+    int next = end_sample;
+    for (HelmSequencer* sequencer : *sequencers) {
+      const HelmSequencer::Pattern* pattern = sequencer->pattern();
+      if (pattern->channel == data->parameters[kChannel])
+        next = std::min(next, nextNoteSample(data, pattern, current_beat, end_beat, start_sample, end_sample));
     }
+    return next;
+  }
+
+  // Beat NOTE_SAMPLE_TOLERANCE samples before offset, so a note within the tolerance of a sample
+  // falls in the chunk that starts there whatever the rounding in the beat arithmetic.
+  inline double segmentBeat(const Transport::Segment& segment, int offset) {
+    double progress = (offset - segment.offset - NOTE_SAMPLE_TOLERANCE) / segment.samples;
+    return segment.start_beat + progress * (segment.end_beat - segment.start_beat);
+  }
+
+  // Plays sequencer notes for the samples of the transport block from offset to offset + samples,
+  // each at its sample within the chunk.
+  template<class Data>
+  void processTransportNotes(Data* data, const Transport::Block& block, int offset, int samples) {
+    for (int i = 0; i < block.num_segments; ++i) {
+      const Transport::Segment& segment = block.segments[i];
+      int start = std::max(offset, segment.offset);
+      int end = std::min(offset + samples, segment.offset + segment.samples);
+      if (!segment.playing || end <= start)
+        continue;
+
+      double start_beat = segmentBeat(segment, start);
+      double end_beat = segmentBeat(segment, end);
+      if (end_beat > start_beat)
+        processSequencerNotes(data, start_beat, end_beat, start - offset, end - offset);
+    }
+  }
+
+  // Samples from start_sample to a scheduled event. Within NOTE_SAMPLE_TOLERANCE of a sample counts
+  // as on it, so rounding in the time doesn't move the event to the sample before.
+  inline double scheduledOffset(const ScheduledEvent& event, int sample_rate, unsigned long long start_sample) {
+    return event.time * sample_rate - start_sample + NOTE_SAMPLE_TOLERANCE;
+  }
+
+  // Returns the number of samples from start_sample to the sample the first pending event plays on,
+  // 0 if it is due now or late, or num_samples if there isn't one before then.
+  int nextScheduledSample(EffectData* data, int sample_rate, unsigned long long start_sample, int num_samples) {
+    if (data->num_pending_events == 0)
+      return num_samples;
+
+    double offset = scheduledOffset(data->pending_events[0], sample_rate, start_sample);
+    if (offset >= num_samples)
+      return num_samples;
+    return std::max(0, static_cast<int>(offset));
+  }
+
+  // Envelopes and voice changes only happen at the start of a synth chunk, and an envelope
+  // outputs its new value a chunk after it is triggered. So a sequencer note or scheduled event
+  // gets a one sample chunk of its own and is heard from the sample after it whatever the block
+  // size. Other chunks end where the next sequencer note, scheduled event or transport segment
+  // starts. Returns the chunk length.
+  int sequencerChunkSize(EffectData* data, const Transport::Block& block, int sample_rate,
+                         unsigned long long dsp_tick, int offset, int samples) {
+    int next = offset + samples;
+    for (int i = 0; i < block.num_segments; ++i) {
+      const Transport::Segment& segment = block.segments[i];
+      int start = std::max(offset, segment.offset);
+      int end = std::min(next, segment.offset + segment.samples);
+      if (end <= start)
+        continue;
+      if (start > offset) {
+        next = start;
+        break;
+      }
+      if (!segment.playing)
+        continue;
+
+      double start_beat = segmentBeat(segment, start);
+      double end_beat = segmentBeat(segment, end);
+      if (end_beat > start_beat)
+        next = nextSequencerNoteSample(data, start_beat, end_beat, start, end);
+    }
+    int scheduled = nextScheduledSample(data, sample_rate, dsp_tick + offset, next - offset);
+    return scheduled ? scheduled : 1;
+  }
+
+  double transportBpm(const Transport::Block& block, int offset) {
+    for (int i = block.num_segments - 1; i > 0; --i) {
+      if (block.segments[i].offset <= offset)
+        return block.segments[i].bpm;
+    }
+    return block.segments[0].bpm;
   }
 
   void processAudio(mopo::HelmEngine& engine,
                     float* in_buffer, float* out_buffer,
                     int in_channels, int out_channels, int samples, int offset) {
-    if (engine.getBufferSize() != samples)
-      engine.setBufferSize(samples);
-
-    engine.setBpm(bpm);
     engine.process();
 
     const mopo::mopo_float* engine_output_left = engine.output(0)->buffer;
@@ -359,14 +805,124 @@ namespace Helm {
     }
   }
 
-  void processQueuedNotes(EffectData* data) {
+  void storeAudio(EffectData* data, int samples, int offset) {
+    data->synth_engine->process();
+
+    memcpy(data->render_left + offset, data->synth_engine->output(0)->buffer,
+           samples * sizeof(mopo::mopo_float));
+    memcpy(data->render_right + offset, data->synth_engine->output(1)->buffer,
+           samples * sizeof(mopo::mopo_float));
+  }
+
+  void writeStoredAudio(EffectData* data, float* in_buffer, float* out_buffer,
+                        int in_channels, int out_channels, int samples) {
+    for (int channel = 0; channel < out_channels; ++channel) {
+      const mopo::mopo_float* synth_output = (channel % 2) ? data->render_right : data->render_left;
+      int in_channel = channel % in_channels;
+
+      for (int i = 0; i < samples; ++i) {
+        float mult = in_buffer[i * in_channels + in_channel];
+        out_buffer[i * out_channels + channel] = mult * synth_output[i];
+      }
+    }
+  }
+
+  template<class Data>
+  void processQueuedNotes(Data* data) {
     std::pair<float, float> event;
     while (data->note_events.try_dequeue(event)) {
       if (event.second)
-        data->synth_engine.noteOn(event.first, event.second);
+        instrument(data).noteOn(event.first, event.second);
       else
-        data->synth_engine.noteOff(event.first);
+        instrument(data).noteOff(event.first);
+    }
+  }
+
+  template<class Data>
+  void insertScheduledEvent(Data* data, const ScheduledEvent& event) {
+    int index = data->num_pending_events;
+    while (index > 0 && data->pending_events[index - 1].time > event.time) {
+      data->pending_events[index] = data->pending_events[index - 1];
+      index--;
+    }
+    data->pending_events[index] = event;
+    data->num_pending_events++;
+  }
+
+  // Moves newly scheduled events into the sorted pending list.
+  template<class Data>
+  void pullScheduledEvents(Data* data) {
+    ScheduledEvent event;
+    while (data->num_pending_events < MAX_SCHEDULED_EVENTS &&
+           data->scheduled_events.try_dequeue(event)) {
+      insertScheduledEvent(data, event);
+    }
+    if (data->num_pending_events == MAX_SCHEDULED_EVENTS && data->scheduled_events.size_approx())
+      data->stats.scheduled_overflows++;
+  }
+
+  template<class Data>
+  void playScheduledNote(Data* data, const ScheduledEvent& event, int sample) {
+    if (event.type == kNoteOnEvent && event.value)
+      instrument(data).noteOn(event.key, event.value, sample);
+    else
+      instrument(data).noteOff(event.key, sample);
+  }
+
+  void playScheduledEvent(EffectData* data, const ScheduledEvent& event, int sample) {
+    int index = event.key;
+    switch (event.type) {
+      case kPitchWheelEvent:
+        data->synth_engine->setPitchWheel(event.value);
+        break;
+      case kModWheelEvent:
+        data->synth_engine->setModWheel(event.value);
+        break;
+      case kAftertouchEvent:
+        data->synth_engine->setAftertouch(event.key, event.value, sample);
+        break;
+      case kParameterEvent:
+        data->parameters[index] = event.value;
+        data->value_lookup[index]->set(event.value);
+        break;
+      default:
+        playScheduledNote(data, event, sample);
+    }
+  }
+
+  // Samplers are only sent note events.
+  void playScheduledEvent(SamplerData* data, const ScheduledEvent& event, int sample) {
+    playScheduledNote(data, event, sample);
+  }
+
+  // Plays the pending events that fall before start_sample + num_samples. Call pullScheduledEvents first.
+  template<class Data>
+  void processScheduledNotes(Data* data, int sample_rate,
+                             unsigned long long start_sample, int num_samples) {
+    int index = 0;
+    for (; index < data->num_pending_events; ++index) {
+      const ScheduledEvent& current = data->pending_events[index];
+      double offset = scheduledOffset(current, sample_rate, start_sample);
+      if (offset >= num_samples)
+        break;
+
+      if (offset < 0.0 && current.time > 0.0)
+        data->stats.late_events++;
+
+      playScheduledEvent(data, current, mopo::utils::iclamp(offset, 0, num_samples - 1));
     }
+
+    data->num_pending_events -= index;
+    memmove(data->pending_events, data->pending_events + index,
+            data->num_pending_events * sizeof(ScheduledEvent));
+  }
+
+  template<class Data>
+  void clearScheduledNotes(Data* data) {
+    ScheduledEvent event;
+    while (data->scheduled_events.try_dequeue(event))
+      ;
+    data->num_pending_events = 0;
   }
 
   void processQueuedFloatChanges(EffectData* data) {
@@ -375,52 +931,204 @@ namespace Helm {
       data->value_lookup[event.first]->set(event.second);
   }
 
+  void recordQueueDepth(std::atomic<int>& depth, std::atomic<int>& high_water, int size) {
+    depth = size;
+    if (size > high_water.load())
+      high_water = size;
+  }
+
+  // Must be called before the block drains the queues.
+  void recordQueueDepths(EffectData* data) {
+    InstanceStats& stats = data->stats;
+    recordQueueDepth(stats.note_queue_depth, stats.note_queue_high_water,
+                     data->note_events.size_approx());
+    recordQueueDepth(stats.value_queue_depth, stats.value_queue_high_water,
+                     data->value_events.size_approx());
+    recordQueueDepth(stats.scheduled_queue_depth, stats.scheduled_queue_high_water,
+                     data->scheduled_events.size_approx() + data->num_pending_events);
+  }
+
+  template<class Data>
+  void recordRender(Data* data, long long nanoseconds, int num_samples, int sample_rate) {
+    InstanceStats& stats = data->stats;
+    stats.blocks_rendered++;
+    stats.render_nanoseconds += nanoseconds;
+    stats.last_render_nanoseconds = nanoseconds;
+    stats.last_block_seconds = (1.0 * num_samples) / sample_rate;
+    if (nanoseconds > stats.max_render_nanoseconds.load())
+      stats.max_render_nanoseconds = nanoseconds;
+    stats.active_voices = instrument(data).getNumActiveVoices();
+  }
+
+  long long nanosecondsSince(std::chrono::steady_clock::time_point start) {
+    std::chrono::steady_clock::duration time = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+  }
+
+  // Renders the transport block. Writes to out_buffer when given one, otherwise stores the
+  // synth output in the instance's render buffers for writeStoredAudio.
+  void renderBlock(EffectData* data, int sample_rate, const Transport::Block& block,
+                   float* in_buffer, float* out_buffer, int in_channels, int out_channels) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    unsigned long long dsp_tick = block.tick;
+    int num_samples = block.samples;
+
+    int synth_samples = num_samples > mopo::MAX_BUFFER_SIZE ? mopo::MAX_BUFFER_SIZE : num_samples;
+    AudioHelm::MutexScopeLock mutex_lock(data->mutex);
+    recordQueueDepths(data);
+    processQueuedFloatChanges(data);
+
+    for (int b = 0; b < num_samples;) {
+      int current_samples = std::min<int>(synth_samples, num_samples - b);
+      pullScheduledEvents(data);
+      current_samples = sequencerChunkSize(data, block, sample_rate, dsp_tick, b, current_samples);
+
+      if (data->synth_engine->getBufferSize() != current_samples)
+        data->synth_engine->setBufferSize(current_samples);
+      data->synth_engine->setBpm(transportBpm(block, b));
+
+      processTransportNotes(data, block, b, current_samples);
+      processQueuedNotes(data);
+      processScheduledNotes(data, sample_rate, dsp_tick + b, current_samples);
+
+      if (out_buffer)
+        processAudio(*data->synth_engine, in_buffer, out_buffer, in_channels, out_channels, current_samples, b);
+      else
+        storeAudio(data, current_samples, b);
+      data->stats.chunks_rendered++;
+      b += current_samples;
+    }
+
+    recordRender(data, nanosecondsSince(start), num_samples, sample_rate);
+  }
+
+  void renderAhead(void* item) {
+    EffectData* data = static_cast<EffectData*>(item);
+    int expected = kRenderQueued;
+    if (!data->render_state.compare_exchange_strong(expected, kRendering))
+      return;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    renderBlock(data, data->render_sample_rate, data->render_block, nullptr, nullptr, 0, 0);
+    worker_render_nanoseconds += nanosecondsSince(start);
+    data->render_state = kRenderDone;
+  }
+
+  // Queues this DSP tick's block of every other active instance on render_pool.
+  // Only the first callback of a tick does anything.
+  void startParallelRender(EffectData* caller, int sample_rate, const Transport::Block& block) {
+    unsigned long long dsp_tick = block.tick;
+    int num_samples = block.samples;
+    if (num_samples > MAX_UNITY_BUFFER_SIZE || parallel_render_tick.exchange(dsp_tick + 1) == dsp_tick + 1)
+      return;
+    if (parallel_render_lock.test_and_set())
+      return;
+
+    SnapshotReadLock read_lock(instance_snapshots);
+    const ChannelInstances* instances = channel_instances.load();
+    int num_items = 0;
+    for (int channel = 0; channel <= MAX_CHANNELS; ++channel) {
+      for (EffectData* data : instances->channels[channel]) {
+        if (data == caller || !data->active || num_items >= RenderPool::kMaxItems ||
+            data->render_state.load() != kRenderIdle) {
+          continue;
+        }
+
+        data->render_block = block;
+        data->render_sample_rate = sample_rate;
+        int expected = kRenderIdle;
+        if (data->render_state.compare_exchange_strong(expected, kRenderQueued))
+          parallel_render_items[num_items++] = data;
+      }
+    }
+
+    if (num_items && !render_pool.submit(renderAhead, parallel_render_items, num_items)) {
+      for (int i = 0; i < num_items; ++i) {
+        int expected = kRenderQueued;
+        EffectData* data = static_cast<EffectData*>(parallel_render_items[i]);
+        data->render_state.compare_exchange_strong(expected, kRenderIdle);
+      }
+    }
+
+    parallel_render_lock.clear();
+  }
+
+  // Takes the instance over from the workers so the callback can render or read it.
+  // Returns true if a worker already rendered the instance's next num_samples into the render
+  // buffers. That block may have been queued for an earlier DSP tick Unity skipped this instance
+  // on, but the engine has moved past it either way so it has to be played.
+  // A block that was still queued is taken back and rendered inline instead.
+  bool acquireRender(EffectData* data, int num_samples) {
+    std::chrono::steady_clock::time_point wait_start;
+    bool waited = false;
+
+    while (true) {
+      int state = data->render_state.load();
+      if (state == kRendering) {
+        if (!waited)
+          wait_start = std::chrono::steady_clock::now();
+        waited = true;
+        std::this_thread::yield();
+      }
+      else if (state == kRenderDone) {
+        data->render_state = kRendering;
+        if (waited)
+          render_wait_nanoseconds += nanosecondsSince(wait_start);
+        return data->render_block.samples == num_samples;
+      }
+      else if (data->render_state.compare_exchange_weak(state, kRendering)) {
+        if (state == kRenderQueued)
+          blocks_rendered_late++;
+        return false;
+      }
+    }
+  }
+
+  void releaseRender(EffectData* data) {
+    data->render_state = kRenderIdle;
+  }
+
   UNITY_AUDIODSP_RESULT UNITY_AUDIODSP_CALLBACK ProcessCallback(
       UnityAudioEffectState* state,
       float* in_buffer, float* out_buffer, unsigned int num_samples,
       int in_channels, int out_channels) {
     EffectData* data = state->GetEffectData<EffectData>();
+    Transport::Block block;
+    transport.advance(state->currdsptick, num_samples, state->samplerate, &block);
 
-    double last_beat = data->current_beat;
-    double delta_time = (1.0 * num_samples) / state->samplerate;
-    double delta_beat = timeToBeat(delta_time, state->samplerate);
-    double next_beat = last_beat + delta_beat;
-    if (!global_pause) {
-      if (data->last_global_beat_sync != global_beat) {
-        next_beat = global_beat + delta_beat;
-        delta_beat = next_beat - last_beat;
-        data->last_global_beat_sync = global_beat;
-      }
-
-      data->current_beat = next_beat;
-    }
+    if (parallel_rendering.load())
+      startParallelRender(data, state->samplerate, block);
+    bool rendered = acquireRender(data, num_samples);
 
+    bool paused = state->flags & UnityAudioEffectStateFlags_IsPaused;
     bool silent = mopo::utils::isSilentf(in_buffer, num_samples * out_channels);
-    if (state->flags & UnityAudioEffectStateFlags_IsPaused || silent) {
+    if (paused || silent) {
+      // A block rendered ahead has already played its notes, so it's used rather than dropped.
+      if (rendered && !paused)
+        writeStoredAudio(data, in_buffer, out_buffer, in_channels, out_channels, num_samples);
+      else
+        memset(out_buffer, 0, num_samples * out_channels * sizeof(float));
+
+      if (rendered)
+        blocks_rendered_ahead++;
+      else
+        data->stats.silent_blocks++;
+
+      releaseRender(data);
       data->active = false;
-      memset(out_buffer, 0, num_samples * out_channels * sizeof(float));
       return UNITY_AUDIODSP_OK;
     }
 
     data->active = true;
 
-    int synth_samples = num_samples > mopo::MAX_BUFFER_SIZE ? mopo::MAX_BUFFER_SIZE : num_samples;
-    AudioHelm::MutexScopeLock mutex_lock(data->mutex);
-    processQueuedFloatChanges(data);
-
-    for (int b = 0; b < num_samples; b += synth_samples) {
-      int current_samples = std::min<int>(synth_samples, num_samples - b);
-
-      double start_beat = last_beat + (delta_beat * b) / num_samples;
-      double end_beat = last_beat + (delta_beat * (b + current_samples)) / num_samples;
-      if (b + synth_samples >= num_samples)
-        end_beat = next_beat;
-
-      if (end_beat > start_beat && !global_pause)
-        processSequencerNotes(data, start_beat, end_beat);
-      processQueuedNotes(data);
-      processAudio(data->synth_engine, in_buffer, out_buffer, in_channels, out_channels, current_samples, b);
+    if (rendered) {
+      writeStoredAudio(data, in_buffer, out_buffer, in_channels, out_channels, num_samples);
+      blocks_rendered_ahead++;
+    }
+    else {
+      renderBlock(data, state->samplerate, block, in_buffer, out_buffer, in_channels, out_channels);
     }
+    releaseRender(data);
 
     data->num_send_channels = out_channels;
     memcpy(data->send_data, out_buffer, num_samples * out_channels * sizeof(float));
@@ -431,94 +1139,161 @@ namespace Helm {
     return UNITY_AUDIODSP_OK;
   }
 
-  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmNoteOn(int channel, int note, float velocity) {
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel && data->active) {
-        synth.second->note_events.enqueue(std::pair<float, float>(note, velocity));
+  // Note exports reach the Helm and sampler instances on a channel alike.
+  template<class Data>
+  void queueNoteOn(const std::vector<Data*>& instances, float note, float velocity) {
+    for (Data* data : instances) {
+      if (data->active)
+        data->note_events.enqueue(std::pair<float, float>(note, velocity));
+    }
+  }
+
+  template<class Data>
+  void queueNoteOff(const std::vector<Data*>& instances, float note) {
+    for (Data* data : instances)
+      data->note_events.enqueue(std::pair<float, float>(note, 0.0f));
+  }
+
+  template<class Data>
+  void queueScheduledNote(const std::vector<Data*>& instances, int note, float velocity,
+                          double start_time, double end_time) {
+    for (Data* data : instances) {
+      if (data->active) {
+        ScheduledEvent note_on = { start_time, kNoteOnEvent, (float)note, velocity };
+        data->scheduled_events.enqueue(note_on);
+
+        if (end_time > start_time) {
+          ScheduledEvent note_off = { end_time, kNoteOffEvent, (float)note, 0.0f };
+          data->scheduled_events.enqueue(note_off);
+        }
       }
     }
   }
 
+  template<class Data>
+  void queueScheduledNoteOff(const std::vector<Data*>& instances, int note, double time) {
+    for (Data* data : instances) {
+      ScheduledEvent note_off = { time, kNoteOffEvent, (float)note, 0.0f };
+      data->scheduled_events.enqueue(note_off);
+    }
+  }
+
+  template<class Data>
+  void allNotesOff(const std::vector<Data*>& instances) {
+    for (Data* data : instances) {
+      AudioHelm::MutexScopeLock mutex_lock(data->mutex);
+      std::pair<float, float> event;
+
+      while (data->note_events.try_dequeue(event))
+        ;
+      clearScheduledNotes(data);
+      instrument(data).allNotesOff();
+    }
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmNoteOn(int channel, int note, float velocity) {
+    SnapshotReadLock read_lock(instance_snapshots);
+    queueNoteOn(channelInstances(channel), note, velocity);
+    queueNoteOn(channelSamplers(channel), note, velocity);
+  }
+
   extern "C" UNITY_AUDIODSP_EXPORT_API void HelmFrequencyOn(int channel, float frequency,
                                                             float velocity) {
     float note = mopo::utils::frequencyToMidiNote(frequency);
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel && data->active) {
-        synth.second->note_events.enqueue(std::pair<float, float>(note, velocity));
-      }
-    }
+    SnapshotReadLock read_lock(instance_snapshots);
+    queueNoteOn(channelInstances(channel), note, velocity);
+    queueNoteOn(channelSamplers(channel), note, velocity);
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void HelmNoteOnScheduled(int channel, int note, float velocity,
                                                                 double start_time, double end_time) {
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel && data->active) {
-        synth.second->note_events.enqueue(std::pair<float, float>(note, velocity));
-      }
-    }
+    SnapshotReadLock read_lock(instance_snapshots);
+    queueScheduledNote(channelInstances(channel), note, velocity, start_time, end_time);
+    queueScheduledNote(channelSamplers(channel), note, velocity, start_time, end_time);
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmNoteOffScheduled(int channel, int note, double time) {
+    SnapshotReadLock read_lock(instance_snapshots);
+    queueScheduledNoteOff(channelInstances(channel), note, time);
+    queueScheduledNoteOff(channelSamplers(channel), note, time);
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void HelmNoteOff(int channel, int note) {
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel) {
-        synth.second->note_events.enqueue(std::pair<float, float>(note, 0.0f));
-      }
-    }
+    SnapshotReadLock read_lock(instance_snapshots);
+    queueNoteOff(channelInstances(channel), note);
+    queueNoteOff(channelSamplers(channel), note);
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void HelmFrequencyOff(int channel, float frequency) {
     float note = mopo::utils::frequencyToMidiNote(frequency);
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel && data->active) {
-        synth.second->note_events.enqueue(std::pair<float, float>(note, 0.0f));
-      }
-    }
+    SnapshotReadLock read_lock(instance_snapshots);
+    queueNoteOff(channelInstances(channel), note);
+    queueNoteOff(channelSamplers(channel), note);
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void HelmAllNotesOff(int channel) {
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel) {
-        AudioHelm::MutexScopeLock mutex_lock(synth.second->mutex);
-        std::pair<float, float> event;
+    SnapshotReadLock read_lock(instance_snapshots);
+    allNotesOff(channelInstances(channel));
+    allNotesOff(channelSamplers(channel));
+  }
 
-        while (synth.second->note_events.try_dequeue(event))
-          ;
-        synth.second->synth_engine.allNotesOff();
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmSetPitchWheel(int channel, float value) {
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel)) {
+      if (data->active) {
+        data->synth_engine->setPitchWheel(value);
       }
     }
   }
 
-  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmSetPitchWheel(int channel, float value) {
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel && data->active) {
-        synth.second->synth_engine.setPitchWheel(value);
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmSetModWheel(int channel, float value) {
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel)) {
+      if (data->active) {
+        data->synth_engine->setModWheel(value);
       }
     }
   }
 
-  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmSetModWheel(int channel, float value) {
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel && data->active) {
-        synth.second->synth_engine.setModWheel(value);
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmSetAftertouch(int channel, int note, float value) {
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel)) {
+      if (data->active) {
+        data->synth_engine->setAftertouch(note, value);
       }
     }
   }
 
-  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmSetAftertouch(int channel, int note, float value) {
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel && data->active) {
-        synth.second->synth_engine.setAftertouch(note, value);
-      }
+  bool setParameterValue(EffectData* data, int index, float value) {
+    if (index < kNumParams || index >= data->num_parameters)
+      return false;
+
+    float clamped_value = mopo::utils::clamp(value, data->range_lookup[index].first,
+                                                    data->range_lookup[index].second);
+    data->parameters[index] = clamped_value;
+    if (data->value_lookup[index]) {
+      prepareWaveform(index, clamped_value);
+      data->value_events.enqueue(std::pair<int, float>(index, clamped_value));
+    }
+    return true;
+  }
+
+  // Like setParameterValue but the audio thread changes the value at the DSP time in seconds.
+  bool scheduleParameterValue(EffectData* data, int index, float value, double time) {
+    if (index < kNumParams || index >= data->num_parameters)
+      return false;
+
+    float clamped_value = mopo::utils::clamp(value, data->range_lookup[index].first,
+                                                    data->range_lookup[index].second);
+    if (data->value_lookup[index] == nullptr) {
+      data->parameters[index] = clamped_value;
+      return true;
     }
+
+    prepareWaveform(index, clamped_value);
+    ScheduledEvent change = { time, kParameterEvent, (float)index, clamped_value };
+    data->scheduled_events.enqueue(change);
+    return true;
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API bool HelmSetParameterValue(int channel, int index, float value) {
@@ -526,38 +1301,108 @@ namespace Helm {
       return false;
 
     bool success = true;
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel && data->active) {
-        if (index >= data->num_parameters)
-          success = false;
-        else {
-          float clamped_value = mopo::utils::clamp(value, data->range_lookup[index].first,
-                                                          data->range_lookup[index].second);
-          data->parameters[index] = clamped_value;
-          if (data->value_lookup[index])
-            data->value_events.enqueue(std::pair<int, float>(index, clamped_value));
-        }
-      }
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel)) {
+      if (data->active)
+        success = setParameterValue(data, index, value) && success;
     }
     return success;
   }
 
+  // Other event types only apply to Helm instances.
+  template<class Data>
+  void sendNoteEvent(Data* data, const HelmEvent& event) {
+    bool scheduled = event.time > 0.0;
+
+    if (event.type == kNoteOnEvent && data->active) {
+      if (scheduled) {
+        ScheduledEvent note_on = { event.time, kNoteOnEvent, (float)event.key, event.value };
+        data->scheduled_events.enqueue(note_on);
+      }
+      else
+        data->note_events.enqueue(std::pair<float, float>(event.key, event.value));
+    }
+    else if (event.type == kNoteOffEvent) {
+      if (scheduled) {
+        ScheduledEvent note_off = { event.time, kNoteOffEvent, (float)event.key, 0.0f };
+        data->scheduled_events.enqueue(note_off);
+      }
+      else
+        data->note_events.enqueue(std::pair<float, float>(event.key, 0.0f));
+    }
+  }
+
+  // Wheel and aftertouch events go through the scheduled queue, untimed ones with a time of zero
+  // so the audio thread plays them at its next block.
+  void sendEvent(EffectData* data, const HelmEvent& event) {
+    bool scheduled = event.time > 0.0;
+
+    switch (event.type) {
+      case kNoteOnEvent:
+      case kNoteOffEvent:
+        sendNoteEvent(data, event);
+        break;
+      case kPitchWheelEvent:
+      case kModWheelEvent:
+      case kAftertouchEvent:
+        if (data->active) {
+          ScheduledEvent control = { scheduled ? event.time : 0.0, event.type, (float)event.key, event.value };
+          data->scheduled_events.enqueue(control);
+        }
+        break;
+      case kParameterEvent:
+        if (data->active && scheduled)
+          scheduleParameterValue(data, event.key, event.value, event.time);
+        else if (data->active)
+          setParameterValue(data, event.key, event.value);
+        break;
+    }
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmSendEvents(const HelmEvent* events, int num_events) {
+    if (events == nullptr)
+      return;
+
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (int i = 0; i < num_events; ++i) {
+      for (EffectData* data : channelInstances(events[i].channel))
+        sendEvent(data, events[i]);
+      for (SamplerData* data : channelSamplers(events[i].channel))
+        sendNoteEvent(data, events[i]);
+    }
+  }
+
   extern "C" UNITY_AUDIODSP_EXPORT_API void HelmClearModulations(int channel) {
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel && data->active) {
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel)) {
+      if (data->active) {
         AudioHelm::MutexScopeLock mutex_lock(data->mutex);
 
         for (int i = 0; i < MAX_MODULATIONS; ++i) {
           mopo::ModulationConnection* connection = data->modulations[i];
-          if (data->synth_engine.isModulationActive(connection))
-            data->synth_engine.disconnectModulation(connection);
+          if (data->synth_engine->isModulationActive(connection))
+            data->synth_engine->disconnectModulation(connection);
         }
       }
     }
   }
 
+  void addModulation(EffectData* data, int index, int source_index, int dest_index, float amount) {
+    if (source_index < 0 || source_index >= data->synth_engine->getNumModulationSources() ||
+        dest_index < 0 || dest_index >= data->synth_engine->getNumModulationDestinations()) {
+      return;
+    }
+
+    prepareModulatedWaveforms(*data->synth_engine, dest_index);
+    AudioHelm::MutexScopeLock mutex_lock(data->mutex);
+
+    mopo::ModulationConnection* connection = data->modulations[index];
+    connection->source_index = source_index;
+    connection->destination_index = dest_index;
+    connection->amount.set(amount);
+    data->synth_engine->connectModulation(connection);
+  }
+
   extern "C" UNITY_AUDIODSP_EXPORT_API void HelmAddModulation(int channel, int index,
                                                               const char* source,
                                                               const char* dest,
@@ -565,35 +1410,270 @@ namespace Helm {
     if (index < 0 || index >= MAX_MODULATIONS)
       return;
 
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel && data->active) {
-        AudioHelm::MutexScopeLock mutex_lock(data->mutex);
+    std::string source_name = source;
+    std::string dest_name = dest;
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel)) {
+      if (data->active) {
+        addModulation(data, index, data->synth_engine->getModulationSourceIndex(source_name),
+                      data->synth_engine->getModulationDestinationIndex(dest_name), amount);
+      }
+    }
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmAddModulationByIndex(int channel, int index,
+                                                                     int source_index,
+                                                                     int dest_index,
+                                                                     float amount) {
+    if (index < 0 || index >= MAX_MODULATIONS)
+      return;
+
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel)) {
+      if (data->active)
+        addModulation(data, index, source_index, dest_index, amount);
+    }
+  }
+
+  // A patch checked and resolved to plugin parameter values and modulation table indices,
+  // so applying it only needs the instance lock for one block boundary.
+  struct ResolvedPatch {
+    std::vector<float> values; // Indexed like EffectData::parameters, up to the mod slots.
+    int num_modulations;
+    int sources[MAX_MODULATIONS];
+    int destinations[MAX_MODULATIONS];
+    float amounts[MAX_MODULATIONS];
+  };
+
+  // Plugin parameter indices follow the alphabetical parameter order after kNumParams.
+  // Maps ValueDetailsLookup::parameter_list order to those indices.
+  const std::vector<int>& parameterListIndices() {
+    static const std::vector<int> indices = []() {
+      std::map<std::string, int> plugin_indices;
+      int index = kNumParams;
+      for (auto& parameter : mopo::Parameters::lookup_.getAllDetails())
+        plugin_indices[parameter.first] = index++;
+
+      std::vector<int> list_indices;
+      for (int i = 0; i < mopo::Parameters::lookup_.getNumParameters(); ++i)
+        list_indices.push_back(plugin_indices[mopo::Parameters::lookup_.getDetails(i).name]);
+      return list_indices;
+    }();
+    return indices;
+  }
+
+  void addResolvedModulation(ResolvedPatch* resolved, const mopo::HelmEngine& engine,
+                             int source, int destination, float amount) {
+    if (resolved->num_modulations >= MAX_MODULATIONS ||
+        source < 0 || source >= engine.getNumModulationSources() ||
+        destination < 0 || destination >= engine.getNumModulationDestinations() ||
+        amount == 0.0f || !std::isfinite(amount)) {
+      return;
+    }
+
+    int index = resolved->num_modulations++;
+    resolved->sources[index] = source;
+    resolved->destinations[index] = destination;
+    resolved->amounts[index] = amount;
+  }
+
+  // Settings the patch is missing or has no valid number for get their default value.
+  void resolvePatch(const Patch& patch, const mopo::HelmEngine& engine, ResolvedPatch* resolved) {
+    std::map<std::string, mopo::ValueDetails> parameters = mopo::Parameters::lookup_.getAllDetails();
+    resolved->values.assign(kNumParams + parameters.size(), 0.0f);
+
+    int index = kNumParams;
+    for (auto parameter : parameters) {
+      const mopo::ValueDetails& details = parameter.second;
+      float value = details.default_value;
+      auto setting = patch.settings.find(parameter.first);
+      if (setting != patch.settings.end() && std::isfinite(setting->second))
+        value = mopo::utils::clamp(setting->second, (float)details.min, (float)details.max);
+      resolved->values[index++] = value;
+    }
+
+    resolved->num_modulations = 0;
+    for (const PatchModulation& modulation : patch.modulations) {
+      addResolvedModulation(resolved, engine, engine.getModulationSourceIndex(modulation.source),
+                            engine.getModulationDestinationIndex(modulation.destination),
+                            modulation.amount);
+    }
+  }
 
-        mopo::ModulationConnection* connection = data->modulations[index];
-        connection->source = source;
-        connection->destination = dest;
-        connection->amount.set(amount);
-        data->synth_engine.connectModulation(connection);
+  bool resolveBinaryPatch(const void* data, size_t size, const mopo::HelmEngine& engine,
+                          ResolvedPatch* resolved) {
+    const BinaryPatchHeader* header = readBinaryPatch(data, size, patchLayout(engine));
+    const std::vector<int>& list_indices = parameterListIndices();
+    if (header == nullptr || header->num_values != list_indices.size())
+      return false;
+
+    std::vector<float> values(header->num_values);
+    memcpy(values.data(), binaryPatchValues(header), values.size() * sizeof(float));
+
+    resolved->values.assign(kNumParams + values.size(), 0.0f);
+    for (int i = 0; i < values.size(); ++i) {
+      const mopo::ValueDetails& details = mopo::Parameters::lookup_.getDetails(i);
+      float value = std::isfinite(values[i]) ? values[i] : details.default_value;
+      resolved->values[list_indices[i]] = mopo::utils::clamp(value, (float)details.min, (float)details.max);
+    }
+
+    std::vector<BinaryModulation> modulations(header->num_modulations);
+    memcpy(modulations.data(), binaryPatchModulations(header),
+           modulations.size() * sizeof(BinaryModulation));
+
+    resolved->num_modulations = 0;
+    for (const BinaryModulation& modulation : modulations) {
+      addResolvedModulation(resolved, engine, modulation.source, modulation.destination,
+                            modulation.amount);
+    }
+    return true;
+  }
+
+  void applyPatch(EffectData* data, const ResolvedPatch& patch) {
+    for (int index : waveformParameters())
+      prepareWaveform(index, patch.values[index]);
+    for (int i = 0; i < patch.num_modulations; ++i)
+      prepareModulatedWaveforms(*data->synth_engine, patch.destinations[i]);
+
+    AudioHelm::MutexScopeLock mutex_lock(data->mutex);
+
+    // Changes queued before the load would otherwise undo part of it.
+    std::pair<int, float> event;
+    while (data->value_events.try_dequeue(event))
+      ;
+
+    for (int i = kNumParams; i < patch.values.size(); ++i) {
+      data->parameters[i] = patch.values[i];
+      if (data->value_lookup[i])
+        data->value_lookup[i]->set(patch.values[i]);
+    }
+
+    int modulation_start = kNumParams + data->num_synth_parameters;
+    for (int i = 0; i < MAX_MODULATIONS; ++i) {
+      mopo::ModulationConnection* connection = data->modulations[i];
+      if (data->synth_engine->isModulationActive(connection))
+        data->synth_engine->disconnectModulation(connection);
+
+      float* slot = data->parameters + modulation_start + i * VALUES_PER_MODULATION;
+      if (i < patch.num_modulations) {
+        connection->source_index = patch.sources[i];
+        connection->destination_index = patch.destinations[i];
+        connection->amount.set(patch.amounts[i]);
+        data->synth_engine->connectModulation(connection);
+
+        slot[0] = patch.sources[i];
+        slot[1] = patch.destinations[i];
+        slot[2] = patch.amounts[i];
       }
+      else
+        slot[2] = 0.0f;
     }
   }
 
+  // Parses and checks a .helm patch, then applies all of it to each instance on the channel
+  // between two blocks. Returns false and changes nothing if there's no instance on the channel
+  // or json isn't a patch.
+  extern "C" UNITY_AUDIODSP_EXPORT_API bool HelmLoadPatch(int channel, const char* json) {
+    Patch patch;
+    if (!readPatch(json, &patch))
+      return false;
+
+    SnapshotReadLock read_lock(instance_snapshots);
+    const std::vector<EffectData*>& instances = channelInstances(channel);
+    if (instances.empty())
+      return false;
+
+    // Every engine has the same modulation tables, so one resolve serves the whole channel.
+    ResolvedPatch resolved;
+    resolvePatch(patch, *instances[0]->synth_engine, &resolved);
+    for (EffectData* data : instances)
+      applyPatch(data, resolved);
+    return true;
+  }
+
+  // Same as HelmLoadPatch for a patch made by HelmConvertPatch or a patch pack.
+  // Returns false if there's no instance on the channel or the patch doesn't match this build.
+  extern "C" UNITY_AUDIODSP_EXPORT_API bool HelmLoadBinaryPatch(int channel, const void* patch, int size) {
+    if (size <= 0)
+      return false;
+
+    SnapshotReadLock read_lock(instance_snapshots);
+    const std::vector<EffectData*>& instances = channelInstances(channel);
+    ResolvedPatch resolved;
+    if (instances.empty() || !resolveBinaryPatch(patch, size, *instances[0]->synth_engine, &resolved))
+      return false;
+
+    for (EffectData* data : instances)
+      applyPatch(data, resolved);
+    return true;
+  }
+
+  // Converts a .helm patch to the binary format. Returns the binary size, writing it to buffer
+  // if it fits, or 0 if json isn't a patch. Builds a synth to resolve names so it's for tools
+  // and load screens, not the audio loop.
+  extern "C" UNITY_AUDIODSP_EXPORT_API int HelmConvertPatch(const char* json, void* buffer, int buffer_size) {
+    Patch patch;
+    if (!readPatch(json, &patch))
+      return 0;
+
+    mopo::HelmEngine engine;
+    std::vector<char> binary = writeBinaryPatch(patch, engine);
+    if (buffer && buffer_size >= (int)binary.size())
+      memcpy(buffer, binary.data(), binary.size());
+    return binary.size();
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API PatchPack* HelmOpenPatchPack(const char* path) {
+    if (path == nullptr)
+      return nullptr;
+
+    PatchPack* pack = new PatchPack();
+    if (pack->open(path))
+      return pack;
+
+    delete pack;
+    return nullptr;
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmClosePatchPack(PatchPack* pack) {
+    delete pack;
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API int HelmGetPatchPackSize(PatchPack* pack) {
+    if (pack == nullptr)
+      return 0;
+    return pack->size();
+  }
+
+  // Returns the index of the patch stored under name, or -1.
+  extern "C" UNITY_AUDIODSP_EXPORT_API int HelmFindPackPatch(PatchPack* pack, const char* name) {
+    if (pack == nullptr || name == nullptr)
+      return -1;
+    return pack->find(name);
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API bool HelmLoadPackPatch(int channel, PatchPack* pack, int index) {
+    if (pack == nullptr)
+      return false;
+
+    size_t size = 0;
+    const void* patch = pack->patch(index, &size);
+    return patch && HelmLoadBinaryPatch(channel, patch, size);
+  }
+
   extern "C" UNITY_AUDIODSP_EXPORT_API void HelmSilence(int channel, bool silent) {
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel)
-        data->silent = silent;
-    }
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel))
+      data->silent = silent;
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void HelmGetBufferData(int channel, float* buffer, int samples, int channels) {
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel)) {
       int send_channels = data->num_send_channels;
       const float* send_buffer = data->send_data;
 
-      if (((int)data->parameters[kChannel]) == channel && data->active && send_channels > 0) {
+      if (data->active && send_channels > 0) {
 
         if (channels == send_channels)
           memcpy(buffer, data->send_data, samples * channels * sizeof(float));
@@ -622,9 +1702,9 @@ namespace Helm {
     if (index < kNumParams)
       return 0.0f;
 
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
-      if (((int)data->parameters[kChannel]) == channel && data->active) {
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel)) {
+      if (data->active) {
         if (index < data->num_parameters)
           return data->parameters[index];
       }
@@ -636,8 +1716,8 @@ namespace Helm {
     if (index < kNumParams)
       return false;
 
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel)) {
       if (index >= data->num_parameters)
         return false;
       else {
@@ -653,8 +1733,8 @@ namespace Helm {
     if (index < kNumParams)
       return 0.0f;
 
-    for (auto synth : instance_map) {
-      EffectData* data = synth.second;
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel)) {
       if (index >= data->num_parameters)
         return 0.0f;
       else {
@@ -667,37 +1747,289 @@ namespace Helm {
     return 0.0f;
   }
 
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmSetParallelRendering(bool enabled, int num_threads) {
+    parallel_rendering = false;
+    render_pool.stop();
+
+    if (enabled) {
+      render_pool.start(num_threads);
+      parallel_rendering = render_pool.numThreads() > 0;
+    }
+  }
+
+  // Engines can keep using voice_pool while it restarts, it refuses their sets until it runs.
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmSetParallelVoices(bool enabled, int num_threads) {
+    voice_pool.stop();
+    if (enabled)
+      voice_pool.start(num_threads);
+
+    mopo::VoiceWorkers* workers = voice_pool.numThreads() ? &voice_pool : nullptr;
+    {
+      AudioHelm::MutexScopeLock mutex_instance_lock(instance_mutex);
+      voice_workers = workers;
+    }
+
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (int channel = 0; channel <= MAX_CHANNELS; ++channel) {
+      for (EffectData* data : channelInstances(channel)) {
+        AudioHelm::MutexScopeLock mutex_lock(data->mutex);
+        data->synth_engine->setVoiceWorkers(workers);
+      }
+    }
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmGetParallelRenderStats(ParallelRenderStats* stats) {
+    if (stats == nullptr)
+      return;
+
+    stats->blocks_rendered_ahead = blocks_rendered_ahead.load();
+    stats->blocks_rendered_late = blocks_rendered_late.load();
+    stats->worker_seconds = worker_render_nanoseconds.load() / 1000000000.0;
+    stats->wait_seconds = render_wait_nanoseconds.load() / 1000000000.0;
+    stats->saved_seconds = stats->worker_seconds - stats->wait_seconds;
+    stats->num_threads = render_pool.numThreads();
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmResetParallelRenderStats() {
+    blocks_rendered_ahead = 0;
+    blocks_rendered_late = 0;
+    worker_render_nanoseconds = 0;
+    render_wait_nanoseconds = 0;
+  }
+
+  // Keeps num_engines engines built in the background so creating that many Helm instances
+  // doesn't build their engines on the creating thread. Zero frees the waiting engines.
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmReserveEngines(int num_engines) {
+    engine_pool.reserve(num_engines);
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API int HelmGetNumReadyEngines() {
+    return engine_pool.available();
+  }
+
+  // Returns false and leaves stats untouched if there is no instance on the channel.
+  extern "C" UNITY_AUDIODSP_EXPORT_API bool HelmGetStats(int channel, HelmStats* stats) {
+    if (stats == nullptr)
+      return false;
+
+    SnapshotReadLock read_lock(instance_snapshots);
+    const std::vector<EffectData*>& instances = channelInstances(channel);
+    if (instances.empty())
+      return false;
+
+    memset(stats, 0, sizeof(HelmStats));
+    long long render_nanoseconds = 0;
+    for (EffectData* data : instances) {
+      const InstanceStats& instance = data->stats;
+      stats->num_instances++;
+      stats->active_voices += instance.active_voices.load();
+      stats->blocks_rendered += instance.blocks_rendered.load();
+      stats->chunks_rendered += instance.chunks_rendered.load();
+      stats->silent_blocks += instance.silent_blocks.load();
+      render_nanoseconds += instance.render_nanoseconds.load();
+
+      double last_render_seconds = instance.last_render_nanoseconds.load() / 1000000000.0;
+      double max_render_seconds = instance.max_render_nanoseconds.load() / 1000000000.0;
+      double block_seconds = instance.last_block_seconds.load();
+      stats->last_render_seconds = std::max(stats->last_render_seconds, last_render_seconds);
+      stats->max_render_seconds = std::max(stats->max_render_seconds, max_render_seconds);
+      if (block_seconds > 0.0)
+        stats->last_load = std::max(stats->last_load, last_render_seconds / block_seconds);
+
+      stats->note_queue_depth += instance.note_queue_depth.load();
+      stats->note_queue_high_water = std::max(stats->note_queue_high_water,
+                                              instance.note_queue_high_water.load());
+      stats->value_queue_depth += instance.value_queue_depth.load();
+      stats->value_queue_high_water = std::max(stats->value_queue_high_water,
+                                               instance.value_queue_high_water.load());
+      stats->scheduled_queue_depth += instance.scheduled_queue_depth.load();
+      stats->scheduled_queue_high_water = std::max(stats->scheduled_queue_high_water,
+                                                   instance.scheduled_queue_high_water.load());
+      stats->late_events += instance.late_events.load();
+      stats->scheduled_overflows += instance.scheduled_overflows.load();
+    }
+
+    if (stats->blocks_rendered)
+      stats->average_render_seconds = render_nanoseconds / (1000000000.0 * stats->blocks_rendered);
+    return true;
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmResetStats(int channel) {
+    SnapshotReadLock read_lock(instance_snapshots);
+    for (EffectData* data : channelInstances(channel))
+      resetStats(data->stats);
+  }
+
+  // Must be called while holding sequencer_mutex.
+  void publishActiveSequencers() {
+    std::vector<HelmSequencer*>* sequencers = new std::vector<HelmSequencer*>();
+    for (auto sequencer : sequencer_lookup) {
+      if (sequencer.second)
+        sequencers->push_back(sequencer.first);
+    }
+
+    sequencer_snapshots.retire(active_sequencers.exchange(sequencers));
+  }
+
   extern "C" UNITY_AUDIODSP_EXPORT_API HelmSequencer* CreateSequencer() {
-    HelmSequencer* sequencer = new HelmSequencer();
     AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
+    HelmSequencer* sequencer = new HelmSequencer(&sequencer_snapshots);
     sequencer_lookup[sequencer] = false;
     return sequencer;
   }
 
+  // Jumps the transport to beat at the start of the next block.
   extern "C" UNITY_AUDIODSP_EXPORT_API void SetBeatTime(double beat) {
-    global_beat = beat;
+    transport.seek(0.0, beat);
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void Pause(bool pause) {
-    global_pause = pause;
+    if (pause)
+      transport.stop(0.0);
+    else
+      transport.start(0.0);
+  }
+
+  // Transport commands take effect at a DSP time in seconds, like scheduled notes.
+  // Times that have already passed take effect at the start of the next block.
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmTransportStart(double time) {
+    transport.start(time);
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmTransportStop(double time) {
+    transport.stop(time);
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmTransportSeek(double time, double beat) {
+    transport.seek(time, beat);
+  }
+
+  // Ramps linearly from the tempo at time to bpm over ramp_seconds, or jumps if it's 0.
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmTransportSetTempo(double time, double bpm, double ramp_seconds) {
+    transport.setTempo(time, bpm, ramp_seconds);
+  }
+
+  // Lock free read of the transport as of the last audio block.
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmGetTransportPosition(Transport::Position* position) {
+    if (position)
+      transport.position(position);
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void DeleteSequencer(HelmSequencer* sequencer) {
-    sequencer_mutex.Lock();
+    AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
     sequencer_lookup.erase(sequencer);
-    sequencer_mutex.Unlock();
-    delete sequencer;
+    publishActiveSequencers();
+    sequencer_snapshots.retire(sequencer);
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void EnableSequencer(HelmSequencer* sequencer, bool enable) {
     AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
     sequencer_lookup[sequencer] = enable;
+    publishActiveSequencers();
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API HelmSequencer::Note* CreateNote(
       HelmSequencer* sequencer, int note, float velocity, float start, float end) {
     AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
-    return sequencer->addNote(note, velocity, start, end);
+    HelmSequencer::Note* new_note = sequencer->addNote(note, velocity, start, end);
+    sequencer->publish();
+    return new_note;
+  }
+
+  // Adds num_notes notes with one publish. If references isn't null it receives the
+  // note for each entry, to edit or delete like notes from CreateNote.
+  extern "C" UNITY_AUDIODSP_EXPORT_API void LoadSequencerNotes(
+      HelmSequencer* sequencer, const HelmSequencer::NoteData* notes, int num_notes,
+      HelmSequencer::Note** references) {
+    if (notes == nullptr || num_notes <= 0)
+      return;
+
+    AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
+    sequencer->loadNotes(notes, num_notes, references);
+    sequencer->publish();
+  }
+
+  // Must be called while holding sequencer_mutex.
+  void releasePlayingNotes(HelmSequencer* sequencer) {
+    for (HelmSequencer::Note* note : sequencer->notes()) {
+      if (sequencer->isNotePlaying(note))
+        HelmNoteOff(sequencer->channel(), note->midi_note);
+    }
+  }
+
+  extern "C" UNITY_AUDIODSP_EXPORT_API void ClearSequencerNotes(HelmSequencer* sequencer) {
+    AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
+    releasePlayingNotes(sequencer);
+    sequencer->clearNotes();
+    sequencer->publish();
+  }
+
+  // Parses a standard MIDI file and adds its notes to the sequencer with one publish.
+  // See readMidiFile for how bpm applies the file's tempo map. Returns the number of notes
+  // added and the file's length in sixteenths, or -1 if the file couldn't be read.
+  extern "C" UNITY_AUDIODSP_EXPORT_API int LoadSequencerMidi(
+      HelmSequencer* sequencer, const void* data, int size, double bpm, double* length) {
+    MidiNotes midi;
+    if (size <= 0 || !readMidiFile(data, size, bpm, &midi))
+      return -1;
+
+    if (length)
+      *length = midi.length;
+    if (midi.notes.empty())
+      return 0;
+
+    AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
+    sequencer->loadNotes(midi.notes.data(), midi.notes.size(), nullptr);
+    sequencer->publish();
+    return midi.notes.size();
+  }
+
+  // Parses a standard MIDI file into notes without a sequencer. Returns the number of notes
+  // in the file and only writes them if they fit in max_notes, or -1 if it couldn't be read.
+  extern "C" UNITY_AUDIODSP_EXPORT_API int ReadMidiNotes(
+      const void* data, int size, double bpm, HelmSequencer::NoteData* notes, int max_notes, double* length) {
+    MidiNotes midi;
+    if (size <= 0 || !readMidiFile(data, size, bpm, &midi))
+      return -1;
+
+    if (length)
+      *length = midi.length;
+    int num_notes = midi.notes.size();
+    if (notes && num_notes <= max_notes)
+      std::copy(midi.notes.begin(), midi.notes.end(), notes);
+    return num_notes;
+  }
+
+  // Streams a MIDI file into a sequencer that no other code adds notes to. The file is parsed
+  // once here and UpdateMidiStream moves its notes into the sequencer as it plays.
+  extern "C" UNITY_AUDIODSP_EXPORT_API MidiStream* CreateMidiStream(
+      HelmSequencer* sequencer, const void* data, int size, double bpm, double* length) {
+    MidiStream* stream = new MidiStream(sequencer);
+    if (size <= 0 || !stream->open(data, size, bpm)) {
+      delete stream;
+      return nullptr;
+    }
+
+    if (length)
+      *length = stream->length();
+    return stream;
+  }
+
+  // Call at least once per lookahead sixteenths of playback, e.g. every frame.
+  extern "C" UNITY_AUDIODSP_EXPORT_API void UpdateMidiStream(MidiStream* stream, double lookahead) {
+    AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
+    HelmSequencer* sequencer = stream->sequencer();
+    if (stream->restarting())
+      releasePlayingNotes(sequencer);
+
+    if (stream->update(lookahead))
+      sequencer->publish();
+  }
+
+  // The sequencer keeps the notes loaded so far.
+  extern "C" UNITY_AUDIODSP_EXPORT_API void DeleteMidiStream(MidiStream* stream) {
+    AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
+    delete stream;
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void DeleteNote(
@@ -707,6 +2039,7 @@ namespace Helm {
       HelmNoteOff(sequencer->channel(), note->midi_note);
 
     sequencer->deleteNote(note);
+    sequencer->publish();
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void ChangeNoteStart(
@@ -714,6 +2047,7 @@ namespace Helm {
     AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
     bool wasPlaying = sequencer->isNotePlaying(note);
     sequencer->changeNoteStart(note, new_start);
+    sequencer->publish();
 
     if (wasPlaying && !sequencer->isNotePlaying(note))
       HelmNoteOff(sequencer->channel(), note->midi_note);
@@ -724,6 +2058,7 @@ namespace Helm {
     AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
     bool wasPlaying = sequencer->isNotePlaying(note);
     sequencer->changeNoteEnd(note, new_end);
+    sequencer->publish();
 
     if (wasPlaying && !sequencer->isNotePlaying(note))
       HelmNoteOff(sequencer->channel(), note->midi_note);
@@ -738,13 +2073,16 @@ namespace Helm {
     sequencer->changeNoteStart(note, new_start);
     sequencer->changeNoteEnd(note, new_end);
     note->velocity = new_velocity;
+    sequencer->publish();
 
     if (wasPlaying && !sequencer->isNotePlaying(note))
       HelmNoteOff(sequencer->channel(), note->midi_note);
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void ChangeNoteVelocity(HelmSequencer::Note* note, float new_velocity) {
+    AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
     note->velocity = new_velocity;
+    note->sequencer->publish();
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void ChangeNoteKey(
@@ -754,12 +2092,14 @@ namespace Helm {
       HelmNoteOff(sequencer->channel(), note->midi_note);
 
     sequencer->changeNoteKey(note, midi_key);
+    sequencer->publish();
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API bool ChangeSequencerChannel(
       HelmSequencer* sequencer, int channel) {
     AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
     sequencer->setChannel(channel);
+    sequencer->publish();
 
     for (auto sequencer : sequencer_lookup) {
       if (sequencer.first->channel() == channel)
@@ -771,23 +2111,269 @@ namespace Helm {
   extern "C" UNITY_AUDIODSP_EXPORT_API void SetSequencerStart(HelmSequencer* sequencer, double start_beat) {
     AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
     sequencer->setStartBeat(start_beat);
+    sequencer->publish();
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void ChangeSequencerLength(HelmSequencer* sequencer, float length) {
     AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
     sequencer->setLength(length);
+    sequencer->publish();
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void LoopSequencer(HelmSequencer* sequencer, bool loop) {
     AudioHelm::MutexScopeLock mutex_lock(sequencer_mutex);
     sequencer->loop(loop);
+    sequencer->publish();
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API void SetBpm(float new_bpm) {
-    bpm = new_bpm;
+    transport.setTempo(0.0, new_bpm, 0.0);
   }
 
   extern "C" UNITY_AUDIODSP_EXPORT_API float GetBpm() {
-    return bpm;
+    return transport.bpm();
+  }
+
+  // One keyzone of HelmSetSamplerKeyzones. Mirrors AudioHelm.SamplerKeyzoneData on the C# side.
+  struct SamplerKeyzoneData {
+    int sample;
+    int root_key;
+    int min_key;
+    int max_key;
+    float min_velocity;
+    float max_velocity;
+  };
+
+  void renderSamplerBlock(SamplerData* data, int sample_rate, const Transport::Block& block,
+                          float* in_buffer, float* out_buffer, int in_channels, int out_channels) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    unsigned long long dsp_tick = block.tick;
+    int num_samples = block.samples;
+
+    AudioHelm::MutexScopeLock mutex_lock(data->mutex);
+    InstanceStats& stats = data->stats;
+    recordQueueDepth(stats.note_queue_depth, stats.note_queue_high_water, data->note_events.size_approx());
+    recordQueueDepth(stats.scheduled_queue_depth, stats.scheduled_queue_high_water,
+                     data->scheduled_events.size_approx() + data->num_pending_events);
+
+    SnapshotReadLock read_lock(sampler_snapshots);
+    data->sampler.setSettings(sampler_settings[instanceChannel(data->parameters[kChannel])].load());
+
+    // Every event plays at its sample inside Sampler::process so blocks only split to fit the buffers.
+    for (int b = 0; b < num_samples;) {
+      int current_samples = std::min(MAX_UNITY_BUFFER_SIZE, num_samples - b);
+      processTransportNotes(data, block, b, current_samples);
+      processQueuedNotes(data);
+      pullScheduledEvents(data);
+      processScheduledNotes(data, sample_rate, dsp_tick + b, current_samples);
+      data->sampler.process(data->render_left, data->render_right, current_samples);
+
+      for (int channel = 0; channel < out_channels; ++channel) {
+        const float* output = (channel % 2) ? data->render_right : data->render_left;
+        int in_channel = channel % in_channels;
+
+        for (int i = 0; i < current_samples; ++i) {
+          int sample = i + b;
+          out_buffer[sample * out_channels + channel] = in_buffer[sample * in_channels + in_channel] * output[i];
+        }
+      }
+      stats.chunks_rendered++;
+      b += current_samples;
+    }
+
+    recordRender(data, nanosecondsSince(start), num_samples, sample_rate);
+  }
+
+  // Must be called while holding sampler_mutex.
+  void publishSamplerSettings(int channel, SamplerSettings* settings) {
+    sampler_snapshots.retire(sampler_settings[channel].exchange(settings));
+  }
+
+  // Copies interleaved PCM into a sample keyzones can play. Returns the sample's id,
+  // or -1 if there's no audio.
+  extern "C" UNITY_AUDIODSP_EXPORT_API int HelmLoadSample(const float* data, int num_frames,
+                                                          int num_channels, int sample_rate) {
+    if (data == nullptr || num_frames <= 0 || num_channels <= 0 || sample_rate <= 0)
+      return -1;
+
+    Sample* sample = new Sample(data, num_frames, num_channels, sample_rate);
+    AudioHelm::MutexScopeLock mutex_lock(sampler_mutex);
+    int id = sample_counter++;
+    samples[id] = sample;
+    return id;
+  }
+
+  // Drops the sample from every channel's keyzones and stops voices playing it.
+  extern "C" UNITY_AUDIODSP_EXPORT_API void HelmDeleteSample(int id) {
+    AudioHelm::MutexScopeLock mutex_lock(sampler_mutex);
+    auto found = samples.find(id);
+    if (found == samples.end())
+      return;
+
+    Sample* sample = found->second;
+    samples.erase(found);
+
+    for (int channel = 0; channel <= MAX_CHANNELS; ++channel) {
+      const SamplerSettings* settings = sampler_settings[channel].load();
+      if (settings == nullptr)
+        continue;
+
+      SamplerSettings* new_settings = new SamplerSettings(*settings);
+      new_settings->keyzones.erase(
+          std::remove_if(new_settings->keyzones.begin(), new_settings->keyzones.end(),
+                         [sample](const SamplerKeyzone& keyzone) { return keyzone.sample == sample; }),
+          new_settings->keyzones.end());
+
+      if (new_settings->keyzones.size() == settings->keyzones.size())
+        delete new_settings;
+      else {
+        new_settings->buildLookup();
+        publishSamplerSettings(channel, new_settings);
+      }
+    }
+
+    // Once every render has seen the new settings no voice can start on the sample.
+    sampler_snapshots.synchronize();
+    {
+      SnapshotReadLock read_lock(instance_snapshots);
+      for (int channel = 0; channel <= MAX_CHANNELS; ++channel) {
+        for (SamplerData* data : channelSamplers(channel)) {
+          AudioHelm::MutexScopeLock instance_lock(data->mutex);
+          data->sampler.stopSample(sample);
+        }
+      }
+    }
+    delete sample;
+  }
+
+  // Sets what the sampler instances on channel play. play_mode is a SamplerPlayMode and
+  // interpolation a SamplerInterpolation. Keyzones with an unknown sample are skipped.
+  extern "C" UNITY_AUDIODSP_EXPORT_API bool HelmSetSamplerKeyzones(
+      int channel, const SamplerKeyzoneData* keyzones, int num_keyzones, int play_mode,
+      int interpolation, float velocity_tracking, bool use_note_off, bool loop) {
+    if (channel < 0 || channel > MAX_CHANNELS || (keyzones == nullptr && num_keyzones > 0))
+      return false;
+
+    SamplerSettings* settings = new SamplerSettings();
+    settings->play_mode = play_mode;
+    settings->interpolation = interpolation;
+    settings->velocity_tracking = mopo::utils::clamp(velocity_tracking, 0.0f, 1.0f);
+    settings->use_note_off = use_note_off;
+    settings->loop = loop;
+
+    AudioHelm::MutexScopeLock mutex_lock(sampler_mutex);
+    for (int i = 0; i < num_keyzones && settings->keyzones.size() < Sampler::kMaxKeyzones; ++i) {
+      const SamplerKeyzoneData& data = keyzones[i];
+      auto sample = samples.find(data.sample);
+      if (sample == samples.end())
+        continue;
+
+      SamplerKeyzone keyzone = { sample->second, data.root_key, data.min_key, data.max_key,
+                                 data.min_velocity, data.max_velocity };
+      settings->keyzones.push_back(keyzone);
+    }
+    settings->buildLookup();
+    publishSamplerSettings(channel, settings);
+    return true;
+  }
+}
+
+// The Helm Sampler effect. It has the Helm effect's channel parameter and nothing else,
+// every other setting comes from HelmSetSamplerKeyzones for its channel.
+namespace HelmSampler {
+  using namespace Helm;
+
+  int InternalRegisterEffectDefinition(UnityAudioEffectDefinition& definition) {
+    definition.paramdefs = new UnityAudioParameterDefinition[kNumParams];
+    RegisterParameter(definition, "Channel", "", 0.0f, MAX_CHANNELS, 0.0f, 1.0f, 1.0f, kChannel);
+    return kNumParams;
+  }
+
+  UNITY_AUDIODSP_RESULT UNITY_AUDIODSP_CALLBACK CreateCallback(UnityAudioEffectState* state) {
+    SamplerData* data = new SamplerData;
+    memset(data->sequencer_events, 0, sizeof(HelmSequencer::Event*) * MAX_NOTES);
+    InitParametersFromDefinitions(InternalRegisterEffectDefinition, data->parameters);
+
+    data->sampler.setSampleRate(state->samplerate);
+    data->num_pending_events = 0;
+    data->active = false;
+    resetStats(data->stats);
+
+    state->effectdata = data;
+    AudioHelm::MutexScopeLock mutex_instance_lock(instance_mutex);
+    data->instance_id = instance_counter;
+    sampler_map[instance_counter] = data;
+    instance_counter++;
+    publishChannelInstances();
+    return UNITY_AUDIODSP_OK;
+  }
+
+  UNITY_AUDIODSP_RESULT UNITY_AUDIODSP_CALLBACK ReleaseCallback(UnityAudioEffectState* state) {
+    SamplerData* data = state->GetEffectData<SamplerData>();
+    AudioHelm::MutexScopeLock mutex_instance_lock(instance_mutex);
+    sampler_map.erase(data->instance_id);
+    publishChannelInstances();
+
+    // Exports may still be using this instance from the old routing.
+    instance_snapshots.synchronize();
+    delete data;
+    return UNITY_AUDIODSP_OK;
+  }
+
+  UNITY_AUDIODSP_RESULT UNITY_AUDIODSP_CALLBACK SetFloatParameterCallback(
+      UnityAudioEffectState* state, int index, float value) {
+    SamplerData* data = state->GetEffectData<SamplerData>();
+    if (index < 0 || index >= kNumParams)
+      return UNITY_AUDIODSP_ERR_UNSUPPORTED;
+
+    bool channel_changed = index == kChannel && (int)data->parameters[index] != (int)value;
+    data->parameters[index] = value;
+
+    if (channel_changed) {
+      AudioHelm::MutexScopeLock mutex_instance_lock(instance_mutex);
+      publishChannelInstances();
+    }
+    return UNITY_AUDIODSP_OK;
+  }
+
+  UNITY_AUDIODSP_RESULT UNITY_AUDIODSP_CALLBACK GetFloatParameterCallback(
+      UnityAudioEffectState* state, int index, float* value, char *valuestr) {
+    SamplerData* data = state->GetEffectData<SamplerData>();
+    if (index < 0 || index >= kNumParams)
+      return UNITY_AUDIODSP_ERR_UNSUPPORTED;
+
+    if (value != NULL)
+      *value = data->parameters[index];
+
+    if (valuestr != NULL)
+      valuestr[0] = 0;
+
+    return UNITY_AUDIODSP_OK;
+  }
+
+  int UNITY_AUDIODSP_CALLBACK GetFloatBufferCallback(UnityAudioEffectState* state, const char* name,
+                                                     float* buffer, int numsamples) {
+    return UNITY_AUDIODSP_OK;
+  }
+
+  UNITY_AUDIODSP_RESULT UNITY_AUDIODSP_CALLBACK ProcessCallback(
+      UnityAudioEffectState* state,
+      float* in_buffer, float* out_buffer, unsigned int num_samples,
+      int in_channels, int out_channels) {
+    SamplerData* data = state->GetEffectData<SamplerData>();
+    Transport::Block block;
+    transport.advance(state->currdsptick, num_samples, state->samplerate, &block);
+
+    bool silent = mopo::utils::isSilentf(in_buffer, num_samples * out_channels);
+    if (state->flags & UnityAudioEffectStateFlags_IsPaused || silent) {
+      data->stats.silent_blocks++;
+      data->active = false;
+      memset(out_buffer, 0, num_samples * out_channels * sizeof(float));
+      return UNITY_AUDIODSP_OK;
+    }
+
+    data->active = true;
+    renderSamplerBlock(data, state->samplerate, block, in_buffer, out_buffer, in_channels, out_channels);
+    return UNITY_AUDIODSP_OK;
   }
 }
@@ -0,0 +1,105 @@
+/* Copyright 2017 Matt Tytel */
+
+#include "helm_render_pool.h"
+
+namespace Helm {
+
+  RenderPool::RenderPool() : num_threads_(0), running_(false), generation_(0), job_(nullptr),
+                             num_items_(0), next_item_(0), working_(0) { }
+
+  RenderPool::~RenderPool() {
+    stop();
+  }
+
+  void RenderPool::start(int num_threads) {
+    std::lock_guard<std::mutex> control_lock(control_mutex_);
+    if (running_)
+      return;
+
+    if (num_threads <= 0)
+      num_threads = std::thread::hardware_concurrency() - 1;
+    if (num_threads <= 0)
+      return;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      running_ = true;
+    }
+
+    for (int i = 0; i < num_threads; ++i)
+      threads_.push_back(std::thread(&RenderPool::work, this));
+    num_threads_ = num_threads;
+  }
+
+  void RenderPool::stop() {
+    std::lock_guard<std::mutex> control_lock(control_mutex_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      running_ = false;
+      next_item_ = num_items_;
+    }
+    wake_.notify_all();
+
+    for (std::thread& thread : threads_)
+      thread.join();
+    threads_.clear();
+    num_threads_ = 0;
+  }
+
+  bool RenderPool::submit(Job job, void* const* items, int num_items) {
+    if (num_items <= 0 || num_items > kMaxItems || working_.load())
+      return false;
+
+    std::unique_lock<std::mutex> lock(mutex_, std::try_to_lock);
+    if (!lock.owns_lock() || !running_ || working_.load())
+      return false;
+
+    job_ = job;
+    for (int i = 0; i < num_items; ++i)
+      items_[i] = items[i];
+    num_items_ = num_items;
+    next_item_ = 0;
+    generation_++;
+    lock.unlock();
+
+    wake_.notify_all();
+    return true;
+  }
+
+  void RenderPool::cancel() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      next_item_ = num_items_;
+    }
+
+    while (working_.load())
+      std::this_thread::yield();
+  }
+
+  void RenderPool::work() {
+    unsigned int generation = 0;
+    while (true) {
+      int num_items = 0;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (running_ && generation == generation_)
+          wake_.wait(lock);
+
+        if (!running_)
+          return;
+        generation = generation_;
+        num_items = num_items_;
+        working_++;
+      }
+
+      runJobs(num_items);
+      working_--;
+    }
+  }
+
+  void RenderPool::runJobs(int num_items) {
+    for (int i = next_item_.fetch_add(1); i < num_items; i = next_item_.fetch_add(1))
+      job_(items_[i]);
+  }
+
+} // Helm
@@ -0,0 +1,61 @@
+/* Copyright 2017 Matt Tytel */
+
+#pragma once
+#ifndef HELM_RENDER_POOL_H
+#define HELM_RENDER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Helm {
+
+  // Worker threads that run one batch of jobs at a time.
+  // Each worker claims the next unstarted job of the batch, so a slow job on one worker
+  // doesn't hold up the rest. Jobs must tolerate never being run: jobs still unstarted
+  // when the next batch is submitted, the batch is cancelled or the pool stops are dropped.
+  class RenderPool {
+    public:
+      typedef void (*Job)(void* item);
+
+      static const int kMaxItems = 1024;
+
+      RenderPool();
+      ~RenderPool();
+
+      // Starts num_threads workers, or one fewer than the number of cores if num_threads <= 0.
+      void start(int num_threads);
+      void stop();
+      int numThreads() const { return num_threads_.load(); }
+
+      // Never blocks. Returns false and queues nothing if the pool isn't running, a worker
+      // is still running a job or another thread is using the pool.
+      bool submit(Job job, void* const* items, int num_items);
+
+      // Drops unstarted jobs and waits for running ones to finish.
+      void cancel();
+
+    private:
+      void work();
+      void runJobs(int num_items);
+
+      std::vector<std::thread> threads_;
+      std::atomic<int> num_threads_;
+      std::mutex control_mutex_;
+      std::mutex mutex_;
+      std::condition_variable wake_;
+      bool running_;
+      unsigned int generation_;
+
+      Job job_;
+      void* items_[kMaxItems];
+      int num_items_;
+      std::atomic<int> next_item_;
+      std::atomic<int> working_;
+  };
+
+} // Helm
+
+#endif // HELM_RENDER_POOL_H
@@ -0,0 +1,367 @@
+/* Copyright 2017 Matt Tytel */
+
+#include "helm_sampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Helm {
+
+  namespace {
+    const int kMaxSampleChannels = 2;
+    const int kRenderBlock = 64;
+    const float kReleaseSeconds = 0.005f;
+    const float kNotesPerOctave = 12.0f;
+
+    inline int wrapIndex(int index, int length) {
+      index %= length;
+      return index < 0 ? index + length : index;
+    }
+
+    inline float cubic(float previous, float from, float to, float next, float t) {
+      float slope = 0.5f * (to - previous);
+      float curve = previous - 2.5f * from + 2.0f * to - 0.5f * next;
+      float cube = 0.5f * (next - previous) + 1.5f * (from - to);
+      return ((cube * t + curve) * t + slope) * t + from;
+    }
+
+    // The fast paths read up to one frame before and two after each index, which the
+    // sample's padding or the checks in renderFrames keep inside the data. Reads are
+    // gathered first so the arithmetic runs as one vectorizable loop.
+    void interpolateLinear(const float* data, const int* indices, const float* fractions,
+                           float* values, int frames) {
+      float from[kRenderBlock];
+      float to[kRenderBlock];
+      for (int i = 0; i < frames; ++i) {
+        from[i] = data[indices[i]];
+        to[i] = data[indices[i] + 1];
+      }
+
+      for (int i = 0; i < frames; ++i)
+        values[i] = from[i] + fractions[i] * (to[i] - from[i]);
+    }
+
+    void interpolateCubic(const float* data, const int* indices, const float* fractions,
+                          float* values, int frames) {
+      float previous[kRenderBlock];
+      float from[kRenderBlock];
+      float to[kRenderBlock];
+      float next[kRenderBlock];
+      for (int i = 0; i < frames; ++i) {
+        const float* point = data + indices[i];
+        previous[i] = point[-1];
+        from[i] = point[0];
+        to[i] = point[1];
+        next[i] = point[2];
+      }
+
+      for (int i = 0; i < frames; ++i)
+        values[i] = cubic(previous[i], from[i], to[i], next[i], fractions[i]);
+    }
+
+    // Voices playing at the sample's own rate read consecutive frames with a fixed fraction,
+    // so there's nothing to gather.
+    void interpolateSteady(const float* data, int index, float fraction, bool cubic_interpolation,
+                           float* values, int frames) {
+      const float* point = data + index;
+      if (!cubic_interpolation) {
+        for (int i = 0; i < frames; ++i)
+          values[i] = point[i] + fraction * (point[i + 1] - point[i]);
+        return;
+      }
+
+      for (int i = 0; i < frames; ++i)
+        values[i] = cubic(point[i - 1], point[i], point[i + 1], point[i + 2], fraction);
+    }
+
+    // For looping voices next to the loop point.
+    float interpolateWrapped(const Sample* sample, int channel, int index, float fraction, bool cubic_interpolation) {
+      const float* data = sample->data(channel);
+      int length = sample->frames();
+      float from = data[wrapIndex(index, length)];
+      float to = data[wrapIndex(index + 1, length)];
+      if (!cubic_interpolation)
+        return from + fraction * (to - from);
+
+      return cubic(data[wrapIndex(index - 1, length)], from, to, data[wrapIndex(index + 2, length)], fraction);
+    }
+  } // namespace
+
+  Sample::Sample(const float* interleaved, int num_frames, int num_channels, int sample_rate) :
+      frames_(num_frames), channels_(std::min(num_channels, kMaxSampleChannels)), sample_rate_(sample_rate) {
+    for (int c = 0; c < channels_; ++c) {
+      data_[c].assign(frames_ + 2 * kPadding, 0.0f);
+      float* channel = data_[c].data() + kPadding;
+      for (int i = 0; i < frames_; ++i)
+        channel[i] = interleaved[i * num_channels + c];
+    }
+  }
+
+  void SamplerSettings::buildLookup() {
+    key_zones.clear();
+    for (int key = 0; key < kNumKeys; ++key) {
+      key_starts[key] = key_zones.size();
+      for (int i = 0; i < keyzones.size() && i < Sampler::kMaxKeyzones; ++i) {
+        const SamplerKeyzone& keyzone = keyzones[i];
+        if (keyzone.sample && keyzone.min_key <= key && key <= keyzone.max_key)
+          key_zones.push_back(i);
+      }
+    }
+    key_starts[kNumKeys] = key_zones.size();
+  }
+
+  Sampler::Sampler() :
+      settings_(nullptr), sample_rate_(44100), num_events_(0), voice_serial_(0), play_count_(0),
+      random_state_(1) {
+    memset(voices_, 0, sizeof(voices_));
+    memset(last_played_, 0, sizeof(last_played_));
+  }
+
+  void Sampler::setSettings(const SamplerSettings* settings) {
+    if (settings != settings_)
+      memset(last_played_, 0, sizeof(last_played_));
+    settings_ = settings;
+  }
+
+  void Sampler::noteOn(float note, float velocity, int sample) {
+    if (num_events_ < kMaxEvents && velocity > 0.0f) {
+      Event event = { sample, note, velocity };
+      events_[num_events_++] = event;
+    }
+  }
+
+  void Sampler::noteOff(float note, int sample) {
+    if (num_events_ < kMaxEvents) {
+      Event event = { sample, note, 0.0f };
+      events_[num_events_++] = event;
+    }
+  }
+
+  void Sampler::allNotesOff() {
+    for (Voice& voice : voices_)
+      voice.active = false;
+    num_events_ = 0;
+  }
+
+  void Sampler::stopSample(const Sample* sample) {
+    for (Voice& voice : voices_) {
+      if (voice.sample == sample)
+        voice.active = false;
+    }
+  }
+
+  int Sampler::getNumActiveVoices() const {
+    int active = 0;
+    for (const Voice& voice : voices_)
+      active += voice.active;
+    return active;
+  }
+
+  // Prefers a free voice, then the quietest releasing voice, then the oldest.
+  Sampler::Voice* Sampler::allocateVoice() {
+    Voice* quietest = nullptr;
+    Voice* oldest = &voices_[0];
+    for (Voice& voice : voices_) {
+      if (!voice.active)
+        return &voice;
+      if (voice.releasing && (quietest == nullptr || voice.release_level < quietest->release_level))
+        quietest = &voice;
+      if (voice.serial < oldest->serial)
+        oldest = &voice;
+    }
+    return quietest ? quietest : oldest;
+  }
+
+  void Sampler::startVoice(const SamplerKeyzone& keyzone, float note, float velocity) {
+    const Sample* sample = keyzone.sample;
+    Voice* voice = allocateVoice();
+    voice->sample = sample;
+    voice->note = note;
+    voice->position = 0.0;
+    voice->increment = (1.0 * sample->sample_rate() / sample_rate_) *
+                       std::pow(2.0, (note - keyzone.root_key) / kNotesPerOctave);
+    voice->gain = (1.0f - settings_->velocity_tracking) + settings_->velocity_tracking * velocity;
+    voice->loop = settings_->loop;
+    voice->cubic = settings_->interpolation == kCubicInterpolation;
+    voice->active = true;
+    voice->releasing = false;
+    voice->release_level = 1.0f;
+    voice->release_step = 0.0f;
+    voice->serial = ++voice_serial_;
+  }
+
+  void Sampler::startNote(float note, float velocity) {
+    if (settings_ == nullptr)
+      return;
+
+    int key = std::max(0, std::min(SamplerSettings::kNumKeys - 1, (int)std::lround(note)));
+    const int* zones = settings_->key_zones.data();
+    int start = settings_->key_starts[key];
+    int end = settings_->key_starts[key + 1];
+
+    int valid[kMaxKeyzones];
+    int num_valid = 0;
+    for (int i = start; i < end; ++i) {
+      const SamplerKeyzone& keyzone = settings_->keyzones[zones[i]];
+      if (keyzone.min_velocity <= velocity && velocity <= keyzone.max_velocity)
+        valid[num_valid++] = zones[i];
+    }
+    if (num_valid == 0)
+      return;
+
+    if (settings_->play_mode == kPlayAll) {
+      for (int i = 0; i < num_valid; ++i)
+        startVoice(settings_->keyzones[valid[i]], note, velocity);
+      return;
+    }
+
+    int chosen = valid[0];
+    if (settings_->play_mode == kPlayRoundRobin) {
+      for (int i = 1; i < num_valid; ++i) {
+        if (last_played_[valid[i]] < last_played_[chosen])
+          chosen = valid[i];
+      }
+    }
+    else {
+      random_state_ = random_state_ * 1664525u + 1013904223u;
+      chosen = valid[(random_state_ >> 8) % num_valid];
+    }
+
+    last_played_[chosen] = ++play_count_;
+    startVoice(settings_->keyzones[chosen], note, velocity);
+  }
+
+  void Sampler::releaseNote(float note) {
+    if (settings_ == nullptr || !settings_->use_note_off)
+      return;
+
+    for (Voice& voice : voices_) {
+      if (voice.active && !voice.releasing && voice.note == note) {
+        voice.releasing = true;
+        voice.release_step = 1.0f / (kReleaseSeconds * sample_rate_);
+      }
+    }
+  }
+
+  // Fills the scratch arrays for up to frames frames of the voice and moves it past them.
+  // Returns how many frames it filled, 0 once the voice has finished. Sets wrapped_reads
+  // when a looping voice is next to its loop point and has to render one frame at a time.
+  int Sampler::renderFrames(Voice* voice, int frames, bool* wrapped_reads) {
+    int length = voice->sample->frames();
+    double position = voice->position;
+    frames = std::min(frames, kRenderBlock);
+    *wrapped_reads = false;
+
+    if (!voice->loop) {
+      if (position >= length)
+        return 0;
+      frames = std::min<int>(frames, std::ceil((length - position) / voice->increment));
+    }
+    else if (position < 1.0 || position >= length - 2) {
+      frames = 1;
+      *wrapped_reads = true;
+    }
+    else
+      frames = std::min<int>(frames, std::ceil((length - 2 - position) / voice->increment));
+
+    if (voice->releasing) {
+      int release_frames = std::ceil(voice->release_level / voice->release_step);
+      if (release_frames <= 0)
+        return 0;
+      frames = std::min(frames, release_frames);
+    }
+
+    for (int i = 0; i < frames; ++i) {
+      double frame_position = position + i * voice->increment;
+      int index = frame_position;
+      indices_[i] = index;
+      fractions_[i] = frame_position - index;
+    }
+
+    if (voice->releasing) {
+      for (int i = 0; i < frames; ++i)
+        gains_[i] = voice->gain * std::max(0.0f, voice->release_level - i * voice->release_step);
+      voice->release_level -= frames * voice->release_step;
+    }
+    else {
+      for (int i = 0; i < frames; ++i)
+        gains_[i] = voice->gain;
+    }
+
+    position += frames * voice->increment;
+    if (voice->loop && position >= length)
+      position = std::fmod(position, length);
+    voice->position = position;
+    return frames;
+  }
+
+  void Sampler::renderVoice(Voice* voice, float* left, float* right, int start, int end) {
+    const Sample* sample = voice->sample;
+    for (int frame = start; frame < end;) {
+      bool wrapped_reads = false;
+      int frames = renderFrames(voice, end - frame, &wrapped_reads);
+      if (frames == 0) {
+        voice->active = false;
+        return;
+      }
+
+      for (int channel = 0; channel < sample->channels(); ++channel) {
+        if (wrapped_reads)
+          values_[0] = interpolateWrapped(sample, channel, indices_[0], fractions_[0], voice->cubic);
+        else if (voice->increment == 1.0)
+          interpolateSteady(sample->data(channel), indices_[0], fractions_[0], voice->cubic, values_, frames);
+        else if (voice->cubic)
+          interpolateCubic(sample->data(channel), indices_, fractions_, values_, frames);
+        else
+          interpolateLinear(sample->data(channel), indices_, fractions_, values_, frames);
+
+        // Mono samples play in both channels.
+        float* output = channel ? right : left;
+        for (int i = 0; i < frames; ++i)
+          output[frame + i] += gains_[i] * values_[i];
+        if (sample->channels() == 1) {
+          for (int i = 0; i < frames; ++i)
+            right[frame + i] += gains_[i] * values_[i];
+        }
+      }
+      frame += frames;
+    }
+  }
+
+  void Sampler::renderVoices(float* left, float* right, int start, int end) {
+    for (Voice& voice : voices_) {
+      if (voice.active)
+        renderVoice(&voice, left, right, start, end);
+    }
+  }
+
+  void Sampler::process(float* left, float* right, int num_samples) {
+    memset(left, 0, num_samples * sizeof(float));
+    memset(right, 0, num_samples * sizeof(float));
+
+    // Events at the same sample keep the order they came in, so a note off and a note on
+    // from the same sequencer step end the old note first.
+    std::stable_sort(events_, events_ + num_events_, [](const Event& a, const Event& b) {
+      return a.sample < b.sample;
+    });
+
+    int rendered = 0;
+    for (int i = 0; i < num_events_; ++i) {
+      int sample = std::max(0, std::min(num_samples - 1, events_[i].sample));
+      if (sample > rendered) {
+        renderVoices(left, right, rendered, sample);
+        rendered = sample;
+      }
+
+      if (events_[i].velocity > 0.0f)
+        startNote(events_[i].note, events_[i].velocity);
+      else
+        releaseNote(events_[i].note);
+    }
+    num_events_ = 0;
+
+    renderVoices(left, right, rendered, num_samples);
+  }
+
+} // Helm
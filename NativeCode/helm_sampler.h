@@ -0,0 +1,149 @@
+/* Copyright 2017 Matt Tytel */
+
+#pragma once
+#ifndef HELM_SAMPLER_H
+#define HELM_SAMPLER_H
+
+#include <vector>
+
+namespace Helm {
+
+  // Immutable PCM audio for the sampler, one array per channel. Each array has kPadding
+  // silent frames on both sides so interpolation past either end never needs a bounds check.
+  class Sample {
+    public:
+      static const int kPadding = 2;
+
+      // Takes interleaved audio. Only the first two channels are kept.
+      Sample(const float* interleaved, int num_frames, int num_channels, int sample_rate);
+
+      int frames() const { return frames_; }
+      int channels() const { return channels_; }
+      int sample_rate() const { return sample_rate_; }
+      const float* data(int channel) const { return data_[channel].data() + kPadding; }
+
+    private:
+      int frames_;
+      int channels_;
+      int sample_rate_;
+      std::vector<float> data_[2];
+  };
+
+  // Mirrors AudioHelm.Sampler.KeyzonePlayMode on the C# side.
+  enum SamplerPlayMode {
+    kPlayAll,
+    kPlayRoundRobin,
+    kPlayRandom
+  };
+
+  enum SamplerInterpolation {
+    kLinearInterpolation,
+    kCubicInterpolation
+  };
+
+  struct SamplerKeyzone {
+    const Sample* sample;
+    int root_key;
+    int min_key;
+    int max_key;
+    float min_velocity;
+    float max_velocity;
+  };
+
+  // Everything a sampler plays from. Built on the main thread and never changed once the
+  // audio thread can see it. buildLookup lists the keyzones of each key in key_zones, from
+  // key_starts[key] up to key_starts[key + 1], so a note on only visits keyzones for its key.
+  struct SamplerSettings {
+    static const int kNumKeys = 128;
+
+    std::vector<SamplerKeyzone> keyzones;
+    std::vector<int> key_zones;
+    int key_starts[kNumKeys + 1];
+    int play_mode;
+    int interpolation;
+    float velocity_tracking;
+    bool use_note_off;
+    bool loop;
+
+    void buildLookup();
+  };
+
+  // A polyphonic sample player with the note interface of HelmEngine. Note events are kept
+  // until process, which plays each one at its sample within the block.
+  // Only the audio thread uses it.
+  class Sampler {
+    public:
+      static const int kMaxVoices = 64;
+      static const int kMaxEvents = 512;
+      static const int kMaxKeyzones = 256;
+
+      Sampler();
+
+      void setSampleRate(int sample_rate) { sample_rate_ = sample_rate; }
+      // settings has to stay valid through the next process call. Changing them resets
+      // round robin order. Playing voices carry on.
+      void setSettings(const SamplerSettings* settings);
+
+      void noteOn(float note, float velocity = 1.0f, int sample = 0);
+      void noteOff(float note, int sample = 0);
+      // Silences every voice right away and drops queued events.
+      void allNotesOff();
+      // Silences every voice playing sample right away.
+      void stopSample(const Sample* sample);
+
+      // Overwrites left and right with the next num_samples of output.
+      void process(float* left, float* right, int num_samples);
+      int getNumActiveVoices() const;
+
+    private:
+      static const int kRenderBlock = 64;
+
+      struct Event {
+        int sample;
+        float note;
+        float velocity; // Zero for a note off.
+      };
+
+      struct Voice {
+        const Sample* sample;
+        float note;
+        double position;
+        double increment;
+        float gain;
+        bool loop;
+        bool cubic;
+        bool active;
+        bool releasing;
+        float release_level;
+        float release_step;
+        unsigned long long serial;
+      };
+
+      void startNote(float note, float velocity);
+      void startVoice(const SamplerKeyzone& keyzone, float note, float velocity);
+      void releaseNote(float note);
+      Voice* allocateVoice();
+      void renderVoices(float* left, float* right, int start, int end);
+      void renderVoice(Voice* voice, float* left, float* right, int start, int end);
+      int renderFrames(Voice* voice, int frames, bool* wrapped_reads);
+
+      const SamplerSettings* settings_;
+      int sample_rate_;
+      Voice voices_[kMaxVoices];
+      Event events_[kMaxEvents];
+      int num_events_;
+      unsigned long long voice_serial_;
+      unsigned long long last_played_[kMaxKeyzones];
+      unsigned long long play_count_;
+      unsigned int random_state_;
+
+      // Scratch space for one render block.
+      int indices_[kRenderBlock];
+      float fractions_[kRenderBlock];
+      float gains_[kRenderBlock];
+      float values_[kRenderBlock];
+  };
+
+} // Helm
+
+#endif // HELM_SAMPLER_H
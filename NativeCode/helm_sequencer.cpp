@@ -2,93 +2,193 @@
 
 #include "helm_sequencer.h"
 
+#include <algorithm>
+
 #define kDefaultNumSixteenths 16
 
 namespace Helm {
 
-  HelmSequencer::HelmSequencer() {
+  namespace {
+    bool onBefore(const HelmSequencer::Note* left, const HelmSequencer::Note* right) {
+      if (left->time_on != right->time_on)
+        return left->time_on < right->time_on;
+      return left->midi_note < right->midi_note;
+    }
+
+    bool offBefore(const HelmSequencer::Note* left, const HelmSequencer::Note* right) {
+      if (left->time_off != right->time_off)
+        return left->time_off < right->time_off;
+      return left->midi_note < right->midi_note;
+    }
+
+    typedef bool (*NoteOrder)(const HelmSequencer::Note*, const HelmSequencer::Note*);
+
+    void insertSorted(std::vector<HelmSequencer::Note*>& order, HelmSequencer::Note* note, NoteOrder before) {
+      order.insert(std::upper_bound(order.begin(), order.end(), note, before), note);
+    }
+
+    void removeSorted(std::vector<HelmSequencer::Note*>& order, HelmSequencer::Note* note, NoteOrder before) {
+      auto range = std::equal_range(order.begin(), order.end(), note, before);
+      auto iter = std::find(range.first, range.second, note);
+      if (iter != range.second)
+        order.erase(iter);
+    }
+
+    // Of several notes at the same time and key only the last added plays.
+    void buildEventList(HelmSequencer::EventList* list, const std::vector<HelmSequencer::Note*>& order,
+                        bool note_on, NoteOrder before) {
+      list->times.reserve(order.size());
+      list->events.reserve(order.size());
+      for (size_t i = 0; i < order.size(); ++i) {
+        const HelmSequencer::Note* note = order[i];
+        if (i + 1 < order.size() && !before(note, order[i + 1]))
+          continue;
+
+        HelmSequencer::Event event = { note_on ? note->time_on : note->time_off,
+                                       note->midi_note, note->velocity };
+        list->times.push_back(event.time);
+        list->events.push_back(event);
+      }
+    }
+  } // namespace
+
+  HelmSequencer::HelmSequencer(SnapshotDomain* snapshots) :
+      snapshots_(snapshots), pattern_(nullptr), current_position_(0.0) {
     channel_ = 0;
     loop_ = true;
     start_beat_ = 0.0;
     num_sixteenths_ = kDefaultNumSixteenths;
-    current_position_ = 0.0;
+    publish();
   }
 
   HelmSequencer::~HelmSequencer() {
-    for (auto note : on_events_)
-      delete note.second;
-    on_events_.clear();
-    off_events_.clear();
+    delete pattern_.load();
+  }
+
+  HelmSequencer::Note* HelmSequencer::allocateNote() {
+    if (free_notes_.empty()) {
+      Note* block = new Note[kNotesPerBlock];
+      note_blocks_.push_back(std::unique_ptr<Note[]>(block));
+      for (int i = kNotesPerBlock - 1; i >= 0; --i)
+        free_notes_.push_back(block + i);
+    }
+
+    Note* note = free_notes_.back();
+    free_notes_.pop_back();
+    note->sequencer = this;
+    return note;
+  }
+
+  void HelmSequencer::insertNote(Note* note) {
+    insertSorted(on_order_, note, onBefore);
+    insertSorted(off_order_, note, offBefore);
+  }
+
+  void HelmSequencer::removeNote(Note* note) {
+    removeSorted(on_order_, note, onBefore);
+    removeSorted(off_order_, note, offBefore);
   }
 
   HelmSequencer::Note* HelmSequencer::addNote(int midi_note, double velocity, double start, double end) {
-    Note* note = new Note();
+    Note* note = allocateNote();
     note->midi_note = midi_note;
     note->velocity = velocity;
     note->time_on = start;
     note->time_off = end;
-
-    on_events_[std::pair<double, int>(start, midi_note)] = note;
-    off_events_[std::pair<double, int>(end, midi_note)] = note;
+    insertNote(note);
     return note;
   }
 
+  // Appends then sorts once, so a batch costs one sort instead of an insert per note.
+  void HelmSequencer::loadNotes(const NoteData* notes, int num_notes, Note** references) {
+    on_order_.reserve(on_order_.size() + num_notes);
+    off_order_.reserve(off_order_.size() + num_notes);
+    for (int i = 0; i < num_notes; ++i) {
+      Note* note = allocateNote();
+      note->midi_note = notes[i].midi_note;
+      note->velocity = notes[i].velocity;
+      note->time_on = notes[i].start;
+      note->time_off = notes[i].end;
+      on_order_.push_back(note);
+      off_order_.push_back(note);
+      if (references)
+        references[i] = note;
+    }
+
+    std::stable_sort(on_order_.begin(), on_order_.end(), onBefore);
+    std::stable_sort(off_order_.begin(), off_order_.end(), offBefore);
+  }
+
   void HelmSequencer::deleteNote(Note* note) {
-    on_events_.erase(std::pair<double, int>(note->time_on, note->midi_note));
-    off_events_.erase(std::pair<double, int>(note->time_off, note->midi_note));
-    delete note;
+    removeNote(note);
+    free_notes_.push_back(note);
+  }
+
+  void HelmSequencer::clearNotes() {
+    free_notes_.insert(free_notes_.end(), on_order_.begin(), on_order_.end());
+    on_order_.clear();
+    off_order_.clear();
   }
 
   bool HelmSequencer::isNotePlaying(Note* note) {
-    return note->time_off >= current_position_ && note->time_on < current_position_;
+    double position = current_position();
+    return note->time_off >= position && note->time_on < position;
   }
 
   void HelmSequencer::changeNoteStart(Note* note, double start) {
-    on_events_.erase(std::pair<double, int>(note->time_on, note->midi_note));
+    removeSorted(on_order_, note, onBefore);
     note->time_on = start;
-    on_events_[std::pair<double, int>(start, note->midi_note)] = note;
+    insertSorted(on_order_, note, onBefore);
   }
 
   void HelmSequencer::changeNoteEnd(Note* note, double end) {
-    off_events_.erase(std::pair<double, int>(note->time_off, note->midi_note));
+    removeSorted(off_order_, note, offBefore);
     note->time_off = end;
-    off_events_[std::pair<double, int>(end, note->midi_note)] = note;
+    insertSorted(off_order_, note, offBefore);
   }
 
   void HelmSequencer::changeNoteKey(Note* note, int midi_key) {
-    on_events_.erase(std::pair<double, int>(note->time_on, note->midi_note));
-    off_events_.erase(std::pair<double, int>(note->time_off, note->midi_note));
+    removeNote(note);
     note->midi_note = midi_key;
-    on_events_[std::pair<double, int>(note->time_on, midi_key)] = note;
-    off_events_[std::pair<double, int>(note->time_off, midi_key)] = note;
+    insertNote(note);
+  }
+
+  void HelmSequencer::publish() {
+    Pattern* pattern = new Pattern();
+    pattern->num_sixteenths = num_sixteenths_;
+    pattern->start_beat = start_beat_;
+    pattern->loop = loop_;
+    pattern->channel = channel_;
+
+    buildEventList(&pattern->on_events, on_order_, true, onBefore);
+    buildEventList(&pattern->off_events, off_order_, false, offBefore);
+    snapshots_->retire(pattern_.exchange(pattern));
   }
 
-  void HelmSequencer::getNoteEvents(Note** notes, event_map& events, double start, double end) {
-    event_map::const_iterator iter = events.lower_bound(std::pair<double, int>(start, 0));
+  void HelmSequencer::getNoteEvents(const Event** events, const EventList& list, double start, double end) {
+    const std::vector<double>& times = list.times;
+    int num_events = times.size();
+    int index = std::lower_bound(times.begin(), times.end(), start) - times.begin();
 
     int note_index = 0;
-    while (iter != events.end() && (start > end || iter->first.first < end) && note_index < kMaxNotes) {
-      notes[note_index++] = (*iter).second;
-      iter++;
-    }
+    while (index < num_events && (start > end || times[index] < end) && note_index < kMaxNotes)
+      events[note_index++] = &list.events[index++];
 
     if (start > end) {
-      iter = events.lower_bound(std::pair<double, int>(0.0, 0));
+      index = std::lower_bound(times.begin(), times.end(), 0.0) - times.begin();
 
-      while (iter != events.end() && iter->first.first < end && note_index < kMaxNotes) {
-        notes[note_index++] = (*iter).second;
-        iter++;
-      }
+      while (index < num_events && times[index] < end && note_index < kMaxNotes)
+        events[note_index++] = &list.events[index++];
     }
 
-    notes[note_index] = nullptr;
+    events[note_index] = nullptr;
   }
 
-  void HelmSequencer::getNoteOns(Note** notes, double start, double end) {
-    getNoteEvents(notes, on_events_, start, end);
+  void HelmSequencer::getNoteOns(const Pattern* pattern, const Event** events, double start, double end) {
+    getNoteEvents(events, pattern->on_events, start, end);
   }
 
-  void HelmSequencer::getNoteOffs(Note** notes, double start, double end) {
-    getNoteEvents(notes, off_events_, start, end);
+  void HelmSequencer::getNoteOffs(const Pattern* pattern, const Event** events, double start, double end) {
+    getNoteEvents(events, pattern->off_events, start, end);
   }
 }
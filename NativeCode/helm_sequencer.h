@@ -4,7 +4,11 @@
 #ifndef HELM_SEQUENCER_H
 #define HELM_SEQUENCER_H
 
-#include <map>
+#include "helm_snapshot.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
 
 namespace Helm {
 
@@ -15,25 +19,67 @@ namespace Helm {
         double velocity;
         double time_on;
         double time_off;
+        HelmSequencer* sequencer;
+      };
+
+      // One note of a LoadSequencerNotes batch or ReadMidiNotes result. Mirrors AudioHelm.NoteData on the C# side.
+      struct NoteData {
+        int midi_note;
+        float velocity;
+        double start;
+        double end;
       };
 
-      typedef std::map<std::pair<double, int>, Note*> event_map;
+      // A note on or off as the audio thread sees it.
+      struct Event {
+        double time;
+        int midi_note;
+        double velocity;
+      };
+
+      // Events sorted by time, with the times also kept on their own so searches
+      // only touch the times.
+      struct EventList {
+        std::vector<double> times;
+        std::vector<Event> events;
+      };
+
+      // Immutable copy of the sequencer that the audio thread reads.
+      // Edits build a new one and publish it.
+      struct Pattern {
+        EventList on_events;
+        EventList off_events;
+        double num_sixteenths;
+        double start_beat;
+        bool loop;
+        int channel;
+      };
 
       const static int kMaxNotes = 127;
+      const static int kNotesPerBlock = 256;
 
-      HelmSequencer();
+      HelmSequencer(SnapshotDomain* snapshots);
       virtual ~HelmSequencer();
 
+      // Editing happens on the main thread. Call publish when done to make the
+      // changes visible to the audio thread.
       Note* addNote(int midi_note, double velocity, double start, double end);
+      // Adds many notes at once, writing each new Note to references if it isn't null.
+      void loadNotes(const NoteData* notes, int num_notes, Note** references);
       void deleteNote(Note* note);
+      void clearNotes();
+      const std::vector<Note*>& notes() const { return on_order_; }
       bool isNotePlaying(Note* note);
       void changeNoteStart(Note* note, double start);
       void changeNoteEnd(Note* note, double end);
       void changeNoteKey(Note* note, int midi_key);
+      void publish();
+
+      // Audio thread access. Only valid inside a read section of the SnapshotDomain.
+      const Pattern* pattern() const { return pattern_.load(); }
+      static void getNoteOns(const Pattern* pattern, const Event** events, double start, double end);
+      static void getNoteOffs(const Pattern* pattern, const Event** events, double start, double end);
 
-      void getNoteEvents(Note** notes, event_map& events, double start, double end);
-      void getNoteOns(Note* notes[kMaxNotes], double start, double end);
-      void getNoteOffs(Note* notes[kMaxNotes], double start, double end);
       double length() { return num_sixteenths_; }
       int channel() { return channel_; }
       double start_beat() { return start_beat_; }
@@ -41,21 +87,35 @@ namespace Helm {
       void loop(bool loop) { loop_ = loop; }
       bool loop() { return loop_; }
       void setChannel(int channel) { channel_ = channel; }
-      double current_position() { return current_position_; }
-      void updatePosition(double position) { current_position_ = position; }
+      double current_position() { return current_position_.load(); }
+      void updatePosition(double position) { current_position_.store(position); }
 
       void setStartBeat(double start_beat) {
         start_beat_ = start_beat;
       }
 
     private:
+      static void getNoteEvents(const Event** events, const EventList& list, double start, double end);
+
+      Note* allocateNote();
+      void insertNote(Note* note);
+      void removeNote(Note* note);
+
+      SnapshotDomain* snapshots_;
+      std::atomic<Pattern*> pattern_;
+      std::atomic<double> current_position_;
+
       int channel_;
       bool loop_;
-      event_map on_events_;
-      event_map off_events_;
+      // Notes live in fixed blocks so pointers handed out stay valid, deleted notes are reused.
+      std::vector<std::unique_ptr<Note[]>> note_blocks_;
+      std::vector<Note*> free_notes_;
+      // Every note, sorted by note on and by note off. Notes added later sort after
+      // notes with the same time and key.
+      std::vector<Note*> on_order_;
+      std::vector<Note*> off_order_;
       double num_sixteenths_;
       double start_beat_;
-      double current_position_;
   };
 
 } // Helm
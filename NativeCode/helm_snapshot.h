@@ -0,0 +1,77 @@
+/* Copyright 2017 Matt Tytel */
+
+#pragma once
+#ifndef HELM_SNAPSHOT_H
+#define HELM_SNAPSHOT_H
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Helm {
+
+  // Lets the audio thread read published data without locking or allocating.
+  // Writers publish a new copy and retire the old one. Retired copies are
+  // deleted once no reader is inside a read section.
+  // Writers must be serialized with each other.
+  class SnapshotDomain {
+    public:
+      SnapshotDomain() : readers_(0) { }
+
+      ~SnapshotDomain() {
+        collect();
+      }
+
+      void beginRead() { readers_.fetch_add(1); }
+      void endRead() { readers_.fetch_sub(1); }
+
+      template<class T>
+      void retire(T* old) {
+        if (old)
+          garbage_.push_back(Garbage(old, &destroy<T>));
+        collect();
+      }
+
+      // Deletes retired copies if no reader can still be holding one.
+      void collect() {
+        if (readers_.load() != 0)
+          return;
+
+        for (Garbage& garbage : garbage_)
+          garbage.second(garbage.first);
+        garbage_.clear();
+      }
+
+      // Waits until no read section is open.
+      // Use when something readers can reach has to be destroyed right away.
+      void synchronize() {
+        while (readers_.load() != 0)
+          std::this_thread::yield();
+        collect();
+      }
+
+    private:
+      typedef std::pair<void*, void (*)(void*)> Garbage;
+
+      template<class T>
+      static void destroy(void* object) {
+        delete static_cast<T*>(object);
+      }
+
+      std::atomic<int> readers_;
+      std::vector<Garbage> garbage_;
+  };
+
+  class SnapshotReadLock {
+    public:
+      SnapshotReadLock(SnapshotDomain& domain) : domain_(domain) { domain_.beginRead(); }
+      ~SnapshotReadLock() { domain_.endRead(); }
+
+    private:
+      SnapshotDomain& domain_;
+  };
+
+} // Helm
+
+#endif // HELM_SNAPSHOT_H
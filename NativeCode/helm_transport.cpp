@@ -0,0 +1,214 @@
+/* Copyright 2017 Matt Tytel */
+
+#include "helm_transport.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+namespace Helm {
+
+  namespace {
+    const double kDefaultBpm = 120.0;
+    const double kSecondsPerMinute = 60.0;
+  } // namespace
+
+  Transport::Transport() :
+      num_pending_(0), beat_(0.0), bpm_(kDefaultBpm), ramp_bpm_(kDefaultBpm), ramp_samples_(0.0),
+      playing_(true), samples_played_(0), block_tick_(0), sequence_(0),
+      published_beat_(0.0), published_bpm_(kDefaultBpm), published_time_(0.0),
+      published_samples_(0), published_playing_(1) {
+    memset(&block_, 0, sizeof(block_));
+    advancing_.clear();
+  }
+
+  void Transport::start(double time) {
+    queueCommand(kStart, time, 0.0, 0.0);
+  }
+
+  void Transport::stop(double time) {
+    queueCommand(kStop, time, 0.0, 0.0);
+  }
+
+  void Transport::seek(double time, double beat) {
+    queueCommand(kSeek, time, beat, 0.0);
+  }
+
+  void Transport::setTempo(double time, double bpm, double ramp_seconds) {
+    if (bpm > 0.0)
+      queueCommand(kTempo, time, bpm, std::max(0.0, ramp_seconds));
+  }
+
+  void Transport::queueCommand(int type, double time, double value, double ramp_seconds) {
+    Command command = { type, time, value, ramp_seconds };
+    commands_.enqueue(command);
+  }
+
+  // Keeps commands with the same time in the order they were queued.
+  void Transport::insertPendingCommand(const Command& command) {
+    int index = num_pending_;
+    while (index > 0 && pending_[index - 1].time > command.time) {
+      pending_[index] = pending_[index - 1];
+      index--;
+    }
+    pending_[index] = command;
+    num_pending_++;
+  }
+
+  void Transport::applyCommand(const Command& command, int sample_rate) {
+    if (command.type == kStart)
+      playing_ = true;
+    else if (command.type == kStop)
+      playing_ = false;
+    else if (command.type == kSeek)
+      beat_ = command.value;
+    else if (command.type == kTempo) {
+      ramp_bpm_ = command.value;
+      ramp_samples_ = command.ramp_seconds * sample_rate;
+      if (ramp_samples_ < 1.0) {
+        bpm_ = ramp_bpm_;
+        ramp_samples_ = 0.0;
+      }
+    }
+  }
+
+  void Transport::addSegment(int offset, int samples, int sample_rate) {
+    Segment& segment = block_.segments[block_.num_segments++];
+    segment.offset = offset;
+    segment.samples = samples;
+    segment.start_beat = beat_;
+    segment.bpm = bpm_;
+    segment.playing = playing_;
+
+    double beats_per_bpm_sample = 1.0 / (kSecondsPerMinute * sample_rate);
+    double beats = bpm_ * samples * beats_per_bpm_sample;
+    if (ramp_samples_ > 0.0) {
+      double ramp = std::min<double>(samples, ramp_samples_);
+      double end_bpm = bpm_ + (ramp_bpm_ - bpm_) * ramp / ramp_samples_;
+      beats = (0.5 * (bpm_ + end_bpm) * ramp + end_bpm * (samples - ramp)) * beats_per_bpm_sample;
+
+      ramp_samples_ -= ramp;
+      bpm_ = ramp_samples_ > 0.0 ? end_bpm : ramp_bpm_;
+    }
+
+    if (playing_) {
+      beat_ += beats;
+      samples_played_ += samples;
+    }
+    segment.end_beat = beat_;
+  }
+
+  // Adds segments from offset up to end, splitting where a running tempo ramp finishes.
+  void Transport::advanceTo(int* offset, int end, int sample_rate) {
+    if (ramp_samples_ > 0.0 && block_.num_segments < kMaxSegments - 1) {
+      int ramp_end = *offset + (int)std::ceil(ramp_samples_);
+      if (ramp_end < end) {
+        addSegment(*offset, ramp_end - *offset, sample_rate);
+        *offset = ramp_end;
+      }
+    }
+
+    if (end > *offset) {
+      addSegment(*offset, end - *offset, sample_rate);
+      *offset = end;
+    }
+  }
+
+  void Transport::fillBlock(unsigned long long dsp_tick, int num_samples, int sample_rate) {
+    Command command;
+    while (num_pending_ < kMaxPendingCommands && commands_.try_dequeue(command))
+      insertPendingCommand(command);
+
+    block_.tick = dsp_tick;
+    block_.samples = num_samples;
+    block_.num_segments = 0;
+
+    int offset = 0;
+    int applied = 0;
+    for (; applied < num_pending_; ++applied) {
+      // Leave room for the ramp split and the rest of the block, later commands wait a block.
+      if (block_.num_segments > kMaxSegments - 4)
+        break;
+
+      double command_offset = std::ceil(pending_[applied].time * sample_rate - dsp_tick);
+      if (command_offset >= num_samples)
+        break;
+
+      advanceTo(&offset, std::max<int>(offset, command_offset), sample_rate);
+      applyCommand(pending_[applied], sample_rate);
+    }
+    advanceTo(&offset, num_samples, sample_rate);
+
+    num_pending_ -= applied;
+    memmove(pending_, pending_ + applied, num_pending_ * sizeof(Command));
+  }
+
+  void Transport::publish(unsigned long long end_tick, int sample_rate) {
+    unsigned int sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    published_beat_.store(beat_, std::memory_order_relaxed);
+    published_bpm_.store(bpm_, std::memory_order_relaxed);
+    published_time_.store((1.0 * end_tick) / sample_rate, std::memory_order_relaxed);
+    published_samples_.store(samples_played_, std::memory_order_relaxed);
+    published_playing_.store(playing_, std::memory_order_relaxed);
+
+    sequence_.store(sequence + 2, std::memory_order_release);
+  }
+
+  void Transport::stoppedBlock(unsigned long long dsp_tick, int num_samples, Block* block) const {
+    block->tick = dsp_tick;
+    block->samples = num_samples;
+    block->num_segments = 1;
+
+    Segment& segment = block->segments[0];
+    segment.offset = 0;
+    segment.samples = num_samples;
+    segment.start_beat = beat_;
+    segment.end_beat = beat_;
+    segment.bpm = bpm_;
+    segment.playing = false;
+  }
+
+  void Transport::advance(unsigned long long dsp_tick, int num_samples, int sample_rate, Block* block) {
+    while (advancing_.test_and_set(std::memory_order_acquire))
+      std::this_thread::yield();
+
+    bool restarted = dsp_tick + sample_rate + 1 < block_tick_;
+    if (dsp_tick + 1 > block_tick_ || restarted) {
+      fillBlock(dsp_tick, num_samples, sample_rate);
+      publish(dsp_tick + num_samples, sample_rate);
+      block_tick_ = dsp_tick + 1;
+    }
+
+    if (dsp_tick + 1 == block_tick_)
+      *block = block_;
+    else
+      stoppedBlock(dsp_tick, num_samples, block);
+
+    advancing_.clear(std::memory_order_release);
+  }
+
+  void Transport::position(Position* position) const {
+    while (true) {
+      unsigned int sequence = sequence_.load(std::memory_order_acquire);
+      if (sequence % 2) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      position->beat = published_beat_.load(std::memory_order_relaxed);
+      position->bpm = published_bpm_.load(std::memory_order_relaxed);
+      position->time = published_time_.load(std::memory_order_relaxed);
+      position->samples = published_samples_.load(std::memory_order_relaxed);
+      position->playing = published_playing_.load(std::memory_order_relaxed);
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (sequence_.load(std::memory_order_relaxed) == sequence)
+        return;
+    }
+  }
+
+} // Helm
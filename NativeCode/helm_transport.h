@@ -0,0 +1,122 @@
+/* Copyright 2017 Matt Tytel */
+
+#pragma once
+#ifndef HELM_TRANSPORT_H
+#define HELM_TRANSPORT_H
+
+#include "concurrentqueue.h"
+
+#include <atomic>
+
+namespace Helm {
+
+  // The shared musical timeline of every Helm instance and sequencer.
+  // The audio thread owns it: the first callback of each DSP tick moves it forward by the
+  // block's samples and every other callback of that tick gets a copy of the same block.
+  // Other threads only queue commands, timed in DSP seconds like scheduled notes, and read
+  // the position published at the end of each block.
+  class Transport {
+    public:
+      static const int kMaxPendingCommands = 256;
+      static const int kMaxSegments = 16;
+
+      // A run of samples in one block with a steady play state and no jumps in beat.
+      // Segments also split where a tempo ramp ends. Start and end beats are exact, beats
+      // inside a ramping segment are close to linear.
+      struct Segment {
+        int offset;
+        int samples;
+        double start_beat;
+        double end_beat;
+        double bpm;        // Tempo at the start of the segment.
+        bool playing;
+      };
+
+      struct Block {
+        unsigned long long tick;
+        int samples;
+        int num_segments;
+        Segment segments[kMaxSegments];
+      };
+
+      // Mirrors AudioHelm.HelmTransportPosition on the C# side.
+      struct Position {
+        double beat;       // Beat at the end of the last block.
+        double bpm;        // Tempo at the end of the last block.
+        double time;       // DSP time in seconds at the end of the last block.
+        long long samples; // Samples played while running since the transport was created.
+        int playing;
+      };
+
+      Transport();
+
+      // Commands take effect at the first sample at or after time. Times in the past, like 0,
+      // take effect at the start of the next block.
+      void start(double time);
+      void stop(double time);
+      void seek(double time, double beat);
+      // Moves linearly from the tempo at time to bpm over ramp_seconds.
+      void setTempo(double time, double bpm, double ramp_seconds);
+
+      // Called by every audio callback before it renders. Copies the block for dsp_tick into
+      // block, advancing the transport if this is the first call of the tick. Ticks older than
+      // the last block never move the transport and get a stopped block at the current beat.
+      // A tick over a second older means the host restarted its clock, so it's taken as new.
+      void advance(unsigned long long dsp_tick, int num_samples, int sample_rate, Block* block);
+
+      // Lock free, safe from any thread.
+      void position(Position* position) const;
+      double bpm() const { return published_bpm_.load(std::memory_order_relaxed); }
+
+    private:
+      enum CommandType {
+        kStart,
+        kStop,
+        kSeek,
+        kTempo
+      };
+
+      struct Command {
+        int type;
+        double time;
+        double value;
+        double ramp_seconds;
+      };
+
+      void queueCommand(int type, double time, double value, double ramp_seconds);
+      void insertPendingCommand(const Command& command);
+      void applyCommand(const Command& command, int sample_rate);
+      void addSegment(int offset, int samples, int sample_rate);
+      void advanceTo(int* offset, int end, int sample_rate);
+      void fillBlock(unsigned long long dsp_tick, int num_samples, int sample_rate);
+      void stoppedBlock(unsigned long long dsp_tick, int num_samples, Block* block) const;
+      void publish(unsigned long long end_tick, int sample_rate);
+
+      moodycamel::ConcurrentQueue<Command> commands_;
+      Command pending_[kMaxPendingCommands];
+      int num_pending_;
+
+      // Audio thread state.
+      double beat_;
+      double bpm_;
+      double ramp_bpm_;
+      double ramp_samples_;
+      bool playing_;
+      long long samples_played_;
+      // The last block and its tick plus one, only touched while holding advancing_.
+      Block block_;
+      unsigned long long block_tick_;
+      std::atomic_flag advancing_;
+
+      // Position, published with a sequence count so readers can retry torn reads.
+      std::atomic<unsigned int> sequence_;
+      std::atomic<double> published_beat_;
+      std::atomic<double> published_bpm_;
+      std::atomic<double> published_time_;
+      std::atomic<long long> published_samples_;
+      std::atomic<int> published_playing_;
+  };
+
+} // Helm
+
+#endif // HELM_TRANSPORT_H
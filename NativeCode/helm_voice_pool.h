@@ -0,0 +1,59 @@
+/* Copyright 2017 Matt Tytel */
+
+#pragma once
+#ifndef HELM_VOICE_POOL_H
+#define HELM_VOICE_POOL_H
+
+#include "mopo.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Helm {
+
+  // Worker threads that render voice sets for any engine, one engine at a time.
+  // The engine's own thread renders sets alongside the workers and waits for the rest
+  // before it returns, so it keeps the sets of a block from straying into the next one.
+  class VoicePool : public mopo::VoiceWorkers {
+    public:
+      static const int kMaxItems = mopo::MAX_POLYPHONY;
+
+      VoicePool();
+      ~VoicePool();
+
+      // Starts num_threads workers, or one fewer than the number of cores if num_threads <= 0.
+      void start(int num_threads);
+      void stop();
+      int numThreads() const override { return num_threads_.load(); }
+
+      // Never blocks on another engine. Returns false and runs nothing if the pool isn't
+      // running, a worker is still finishing the last run or another engine is using it.
+      bool run(Job job, void* const* items, int num_items) override;
+
+    private:
+      void work();
+      void runJobs(int num_items);
+
+      std::vector<std::thread> threads_;
+      std::atomic<int> num_threads_;
+      std::mutex control_mutex_;
+      std::mutex mutex_;
+      std::condition_variable wake_;
+      bool running_;
+      bool busy_;
+      unsigned int generation_;
+
+      Job job_;
+      void* items_[kMaxItems];
+      int num_items_;
+      std::atomic<int> next_item_;
+      std::atomic<int> done_;
+      std::atomic<int> working_;
+  };
+
+} // Helm
+
+#endif // HELM_VOICE_POOL_H
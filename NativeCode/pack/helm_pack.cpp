@@ -0,0 +1,109 @@
+/* Copyright 2017 Matt Tytel */
+
+// Converts .helm patches into one binary patch pack for HelmOpenPatchPack.
+// Patches are stored under their path relative to the folder they were found in,
+// without the .helm extension, e.g. "Bass/MT Filtered Bass 1".
+// Build and run on Linux with:
+//   make -f Makefile.pack
+//   out/helm_pack presets.helmpack ../Assets/AudioHelm/Presets
+
+#include <cstdint>
+#include "helm_engine.h"
+#include "helm_patch.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <dirent.h>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+  const std::string kPatchExtension = ".helm";
+
+  bool hasPatchExtension(const std::string& name) {
+    return name.size() > kPatchExtension.size() &&
+           name.substr(name.size() - kPatchExtension.size()) == kPatchExtension;
+  }
+
+  std::string patchName(const std::string& path) {
+    return path.substr(0, path.size() - kPatchExtension.size());
+  }
+
+  // Fills files with patch name to file path for every patch under directory.
+  void findPatches(const std::string& directory, const std::string& prefix,
+                   std::map<std::string, std::string>* files) {
+    DIR* dir = opendir(directory.c_str());
+    if (dir == nullptr)
+      return;
+
+    std::vector<std::string> entries;
+    while (dirent* entry = readdir(dir)) {
+      std::string name = entry->d_name;
+      if (name != "." && name != "..")
+        entries.push_back(name);
+    }
+    closedir(dir);
+
+    for (const std::string& name : entries) {
+      std::string path = directory + "/" + name;
+      if (hasPatchExtension(name))
+        (*files)[patchName(prefix + name)] = path;
+      else if (name.find('.') == std::string::npos)
+        findPatches(path, prefix + name + "/", files);
+    }
+  }
+
+  bool readFile(const std::string& path, std::string* text) {
+    std::ifstream file(path.c_str());
+    if (!file)
+      return false;
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    *text = buffer.str();
+    return true;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    printf("Usage: helm_pack output.helmpack (folder | patch.helm) ...\n");
+    return 1;
+  }
+
+  std::map<std::string, std::string> files;
+  for (int i = 2; i < argc; ++i) {
+    std::string path = argv[i];
+    if (hasPatchExtension(path)) {
+      size_t slash = path.find_last_of('/');
+      files[patchName(slash == std::string::npos ? path : path.substr(slash + 1))] = path;
+    }
+    else
+      findPatches(path, "", &files);
+  }
+
+  mopo::HelmEngine engine;
+  std::map<std::string, std::vector<char>> patches;
+  for (auto& file : files) {
+    std::string text;
+    Helm::Patch patch;
+    if (readFile(file.second, &text) && Helm::readPatch(text.c_str(), &patch))
+      patches[file.first] = Helm::writeBinaryPatch(patch, engine);
+    else
+      fprintf(stderr, "Couldn't read patch %s\n", file.second.c_str());
+  }
+
+  std::vector<char> pack = Helm::writePatchPack(patches);
+  std::ofstream output(argv[1], std::ios::binary);
+  output.write(pack.data(), pack.size());
+  if (!output) {
+    fprintf(stderr, "Couldn't write %s\n", argv[1]);
+    return 1;
+  }
+
+  printf("Packed %d patches into %s, %d bytes.\n", (int)patches.size(), argv[1], (int)pack.size());
+  return 0;
+}
@@ -0,0 +1,192 @@
+/* Copyright 2017 Matt Tytel */
+
+// Generates the mopo and Helm lookup tables as source so they're constant data instead of
+// being filled by static constructors when the library loads. Each table is computed the way
+// those constructors did and written with enough digits to read back to the same bits.
+// Build and run on Linux with:
+//   make -f Makefile.tables generate   rewrites the tables in the tree
+//   make -f Makefile.tables check      fails if the tree's tables differ from computed ones, or
+//                                      computed ones differ from what the old constructors built
+//                                      by more than the accepted ulps
+
+#include <cstdint>
+#include "helm_tables_reference.h"
+#include "detune_lookup.h"
+#include "magnitude_lookup.h"
+#include "midi_lookup.h"
+#include "resonance_lookup.h"
+#include "sample_decay_lookup.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+  const int kValuesPerLine = 4;
+
+  const char* kLicense =
+      "/* Copyright 2013-2017 Matt Tytel\n"
+      " *\n"
+      " * mopo is free software: you can redistribute it and/or modify\n"
+      " * it under the terms of the GNU General Public License as published by\n"
+      " * the Free Software Foundation, either version 3 of the License, or\n"
+      " * (at your option) any later version.\n"
+      " *\n"
+      " * mopo is distributed in the hope that it will be useful,\n"
+      " * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+      " * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+      " * GNU General Public License for more details.\n"
+      " *\n"
+      " * You should have received a copy of the GNU General Public License\n"
+      " * along with mopo.  If not, see <http://www.gnu.org/licenses/>.\n"
+      " */\n";
+
+  struct Table {
+    std::string path;
+    std::string header;
+    std::string definition;
+    std::vector<double> values;
+    void (*reference)(mopo::mopo_float* values);
+    // The most the old constructors' values may differ by. They were auto-vectorized onto glibc's
+    // vector exp on Linux, which rounds differently from the scalar libm the generator uses.
+    long long accepted_ulps;
+  };
+
+  // The loops push values one at a time so they aren't vectorized. Every value comes from the
+  // scalar libm functions instead of vector versions that round differently on each platform.
+  std::vector<double> magnitudeValues() {
+    std::vector<double> values;
+    for (int i = 0; i < mopo::MAGNITUDE_LOOKUP_RESOLUTION + 2; ++i) {
+      mopo::mopo_float t = (1.0 * i) / mopo::MAGNITUDE_LOOKUP_RESOLUTION;
+      mopo::mopo_float decibels = mopo::utils::interpolate(mopo::MIN_DB_LOOKUP, mopo::MAX_DB_LOOKUP, t);
+      values.push_back(mopo::utils::dbToGain(decibels));
+    }
+    return values;
+  }
+
+  std::vector<double> resonanceValues() {
+    std::vector<double> values;
+    for (int i = 0; i < mopo::Q_RESOLUTION + 2; ++i)
+      values.push_back(mopo::utils::magnitudeToQ((1.0 * i) / mopo::Q_RESOLUTION));
+    return values;
+  }
+
+  std::vector<double> midiValues() {
+    std::vector<double> values;
+    for (int i = 0; i < mopo::MAX_CENTS + 2; ++i)
+      values.push_back(mopo::utils::midiCentsToFrequency(i));
+    return values;
+  }
+
+  std::vector<double> sampleDecayValues() {
+    std::vector<double> values;
+    for (int i = 0; i < mopo::SAMPLE_DECAY_LOOKUP_RESOLUTION + 3; ++i) {
+      mopo::mopo_float percent = (1.0 * i) / mopo::SAMPLE_DECAY_LOOKUP_RESOLUTION;
+      values.push_back(pow(mopo::CLOSE_ENOUGH, percent));
+    }
+    return values;
+  }
+
+  std::vector<double> detuneValues() {
+    std::vector<double> values;
+    for (int i = 0; i < mopo::DETUNE_LOOKUP_RESOLUTION + 2; ++i) {
+      mopo::mopo_float t = (1.0 * i) / mopo::DETUNE_LOOKUP_RESOLUTION;
+      mopo::mopo_float cents = mopo::utils::interpolate(mopo::MIN_LOOKUP_CENTS, mopo::MAX_LOOKUP_CENTS, t);
+      values.push_back(mopo::utils::centsToRatio(cents));
+    }
+    return values;
+  }
+
+  long long ulps(double a, double b) {
+    int64_t a_bits = 0;
+    int64_t b_bits = 0;
+    memcpy(&a_bits, &a, sizeof(a));
+    memcpy(&b_bits, &b, sizeof(b));
+    return std::abs(a_bits - b_bits);
+  }
+
+  // Compares the table with what the old constructor built. Returns false if any value differs
+  // by more than the table's accepted ulps.
+  bool compareReference(const Table& table) {
+    std::vector<mopo::mopo_float> reference(table.values.size());
+    table.reference(reference.data());
+
+    int num_different = 0;
+    long long worst_ulps = 0;
+    for (size_t i = 0; i < table.values.size(); ++i) {
+      long long difference = ulps(table.values[i], reference[i]);
+      num_different += difference != 0;
+      worst_ulps = std::max(worst_ulps, difference);
+    }
+
+    bool passed = worst_ulps <= table.accepted_ulps;
+    printf("%-40s %8zu %10d %11lld %9lld%s\n", table.path.c_str(), table.values.size(), num_different,
+           worst_ulps, table.accepted_ulps, passed ? "" : "  FAILED");
+    return passed;
+  }
+
+  bool writeTable(const std::string& root, const Table& table) {
+    std::string path = root + "/" + table.path;
+    FILE* file = fopen(path.c_str(), "w");
+    if (file == nullptr) {
+      fprintf(stderr, "Couldn't write %s\n", path.c_str());
+      return false;
+    }
+
+    fprintf(file, "%s\n#include \"%s\"\n\nnamespace mopo {\n\n", kLicense, table.header.c_str());
+    fprintf(file, "  // Generated by tables/helm_tables.cpp, regenerate with make -f Makefile.tables generate.\n");
+    fprintf(file, "  const mopo_float %s = {\n", table.definition.c_str());
+    for (size_t i = 0; i < table.values.size(); ++i) {
+      bool line_start = i % kValuesPerLine == 0;
+      bool line_end = i % kValuesPerLine == kValuesPerLine - 1 || i == table.values.size() - 1;
+      fprintf(file, "%s%.17g,%s", line_start ? "    " : "", table.values[i], line_end ? "\n" : " ");
+    }
+    fprintf(file, "  };\n} // namespace mopo\n");
+    fclose(file);
+    return true;
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s <NativeCode directory to write the tables into>\n"
+                    "       %s --reference   compare the tables with the old constructors\n",
+            argv[0], argv[0]);
+    return 1;
+  }
+
+  std::vector<Table> tables = {
+    { "helm/mopo/src/magnitude_lookup.cpp", "magnitude_lookup.h",
+      "MagnitudeLookup::lookup_[MAGNITUDE_LOOKUP_RESOLUTION + 2]", magnitudeValues(),
+      reference::magnitudeValues, 10 },
+    { "helm/mopo/src/resonance_lookup.cpp", "resonance_lookup.h",
+      "ResonanceLookup::lookup_[Q_RESOLUTION + 2]", resonanceValues(),
+      reference::resonanceValues, 4 },
+    { "helm/mopo/src/midi_lookup.cpp", "midi_lookup.h",
+      "MidiLookup::lookup_[MAX_CENTS + 2]", midiValues(),
+      reference::midiValues, 15 },
+    { "helm/mopo/src/sample_decay_lookup.cpp", "sample_decay_lookup.h",
+      "SampleDecayLookup::lookup_[SAMPLE_DECAY_LOOKUP_RESOLUTION + 3]", sampleDecayValues(),
+      reference::sampleDecayValues, 6 },
+    { "helm/src/synthesis/detune_lookup.cpp", "detune_lookup.h",
+      "DetuneLookup::lookup_[DETUNE_LOOKUP_RESOLUTION + 2]", detuneValues(),
+      reference::detuneValues, 2 }
+  };
+
+  if (strcmp(argv[1], "--reference") == 0) {
+    bool passed = true;
+    printf("%-40s %8s %10s %11s %9s\n", "table", "entries", "different", "worst ulps", "accepted");
+    for (const Table& table : tables)
+      passed = compareReference(table) && passed;
+    return passed ? 0 : 1;
+  }
+
+  for (const Table& table : tables) {
+    if (!writeTable(argv[1], table))
+      return 1;
+  }
+  return 0;
+}
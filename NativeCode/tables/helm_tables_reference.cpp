@@ -0,0 +1,49 @@
+/* Copyright 2017 Matt Tytel */
+
+// The loops of the old lookup table constructors, unchanged. Built with the flags of
+// Makefile.build like they were, so the compiler is free to vectorize them the same way.
+
+#include <cstdint>
+#include "helm_tables_reference.h"
+#include "detune_lookup.h"
+#include "magnitude_lookup.h"
+#include "midi_lookup.h"
+#include "resonance_lookup.h"
+#include "sample_decay_lookup.h"
+
+#include <cmath>
+
+namespace reference {
+  void magnitudeValues(mopo::mopo_float* values) {
+    for (int i = 0; i < mopo::MAGNITUDE_LOOKUP_RESOLUTION + 2; ++i) {
+      mopo::mopo_float t = (1.0 * i) / mopo::MAGNITUDE_LOOKUP_RESOLUTION;
+      mopo::mopo_float decibels = mopo::utils::interpolate(mopo::MIN_DB_LOOKUP, mopo::MAX_DB_LOOKUP, t);
+      values[i] = mopo::utils::dbToGain(decibels);
+    }
+  }
+
+  void resonanceValues(mopo::mopo_float* values) {
+    for (int i = 0; i < mopo::Q_RESOLUTION + 2; ++i)
+      values[i] = mopo::utils::magnitudeToQ((1.0 * i) / mopo::Q_RESOLUTION);
+  }
+
+  void midiValues(mopo::mopo_float* values) {
+    for (int i = 0; i < mopo::MAX_CENTS + 2; ++i)
+      values[i] = mopo::utils::midiCentsToFrequency(i);
+  }
+
+  void sampleDecayValues(mopo::mopo_float* values) {
+    for (int i = 0; i < mopo::SAMPLE_DECAY_LOOKUP_RESOLUTION + 3; ++i) {
+      mopo::mopo_float percent = (1.0 * i) / mopo::SAMPLE_DECAY_LOOKUP_RESOLUTION;
+      values[i] = pow(mopo::CLOSE_ENOUGH, percent);
+    }
+  }
+
+  void detuneValues(mopo::mopo_float* values) {
+    for (int i = 0; i < mopo::DETUNE_LOOKUP_RESOLUTION + 2; ++i) {
+      mopo::mopo_float t = (1.0 * i) / mopo::DETUNE_LOOKUP_RESOLUTION;
+      mopo::mopo_float cents = mopo::utils::interpolate(mopo::MIN_LOOKUP_CENTS, mopo::MAX_LOOKUP_CENTS, t);
+      values[i] = mopo::utils::centsToRatio(cents);
+    }
+  }
+} // namespace reference
@@ -0,0 +1,19 @@
+/* Copyright 2017 Matt Tytel */
+
+#pragma once
+#ifndef HELM_TABLES_REFERENCE_H
+#define HELM_TABLES_REFERENCE_H
+
+#include "common.h"
+
+// The lookup tables as the static constructors filled them before they were generated.
+// Each fills values with the table's full length.
+namespace reference {
+  void magnitudeValues(mopo::mopo_float* values);
+  void resonanceValues(mopo::mopo_float* values);
+  void midiValues(mopo::mopo_float* values);
+  void sampleDecayValues(mopo::mopo_float* values);
+  void detuneValues(mopo::mopo_float* values);
+} // namespace reference
+
+#endif // HELM_TABLES_REFERENCE_H